@@ -0,0 +1,119 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Runs addBatch, mulRelinBatch and rotateBatch over 64 ciphertexts on one worker and on
+// one worker per CPU. The first call with several workers creates the evaluator's shallow
+// copies, so it is not timed; later calls reuse them. Before timing, the batch operations
+// are run in place (ctOut[i] is ct0[i]) and their results are checked.
+
+#include "common.h"
+#include "latticpp/latticpp.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+const int CIPHERTEXTS = 64;
+const int REPETITIONS = 4;
+const double TOLERANCE = 1e-4;
+
+// Decrypt every ciphertext in cts and compare it with `expected`.
+bool matches(EncoderRef encoder, DecryptorRef decryptor, uint64_t logSlots, const vector<Ciphertext> &cts, const vector<double> &expected) {
+    for (const Ciphertext &ct : cts) {
+        vector<double> result = decode(encoder, decryptNew(decryptor, ct), logSlots);
+        for (size_t i = 0; i < expected.size(); i++) {
+            if (abs(result[i] - expected[i]) > TOLERANCE) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Each output may be the input at the same index, so the batch operations can run in place.
+bool checkInPlace(EvaluatorRef eval, EncoderRef encoder, EncryptorRef encryptor, DecryptorRef decryptor, ParametersRef params) {
+    size_t slots = numSlots(params);
+    vector<double> values(slots);
+    for (size_t i = 0; i < slots; i++) {
+        values[i] = double(i) / slots;
+    }
+    vector<Ciphertext> cts, other;
+    for (int i = 0; i < CIPHERTEXTS; i++) {
+        cts.push_back(encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), scale(params))));
+        other.push_back(copyNew(cts.back()));
+    }
+
+    vector<double> expected(slots);
+    addBatch(eval, cts, other, cts);
+    for (size_t i = 0; i < slots; i++) {
+        expected[i] = 2 * values[i];
+    }
+    if (!matches(encoder, decryptor, logSlots(params), cts, expected)) {
+        cout << "in-place addBatch gave wrong results" << endl;
+        return false;
+    }
+
+    rotateBatch(eval, cts, 1, cts);
+    for (size_t i = 0; i < slots; i++) {
+        expected[i] = 2 * values[(i + 1) % slots];
+    }
+    if (!matches(encoder, decryptor, logSlots(params), cts, expected)) {
+        cout << "in-place rotateBatch gave wrong results" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    Parameters params = getDefaultClassicalParams(PN14QP438);
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    RelinearizationKey rlk = genRelinKey(kgen, sk);
+    RotationKeys rotKeys = genRotationKeysForRotations(kgen, sk, vector<int>{1});
+    Evaluator eval = newEvaluator(params, makeEvaluationKey(rlk, rotKeys));
+    Encryptor encryptor = newEncryptor(params, sk);
+    Decryptor decryptor = newDecryptor(params, sk);
+    Encoder encoder = newEncoder(params);
+    double s = scale(params);
+
+    if (!checkInPlace(eval, encoder, encryptor, decryptor, params)) {
+        return EXIT_FAILURE;
+    }
+
+    vector<double> values(numSlots(params), 0.5);
+    vector<Ciphertext> ct0, ct1, ctOut;
+    for (int i = 0; i < CIPHERTEXTS; i++) {
+        ct0.push_back(encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), s)));
+        ct1.push_back(encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), s)));
+        ctOut.push_back(newCiphertext(params, 1, maxLevel(params)));
+    }
+
+    vector<pair<string, function<void(uint64_t)>>> operations = {
+        {"addBatch", [&](uint64_t workers) { addBatch(eval, ct0, ct1, ctOut, workers); }},
+        {"mulRelinBatch", [&](uint64_t workers) { mulRelinBatch(eval, ct0, ct1, ctOut, workers); }},
+        {"rotateBatch", [&](uint64_t workers) { rotateBatch(eval, ct0, 1, ctOut, workers); }},
+    };
+
+    cout << CIPHERTEXTS << " ciphertexts" << endl;
+    cout << setw(16) << "operation" << setw(10) << "workers" << setw(12) << "ms" << setw(10) << "speedup" << endl;
+    for (auto &operation : operations) {
+        double serial = 0;
+        for (uint64_t workers : {uint64_t(1), uint64_t(thread::hardware_concurrency())}) {
+            operation.second(workers);
+            double secs = timeIt([&]() { operation.second(workers); }, REPETITIONS);
+            if (workers == 1) {
+                serial = secs;
+            }
+            cout << setw(16) << operation.first << setw(10) << workers << fixed << setprecision(1) << setw(12)
+                 << 1e3 * secs << setw(9) << setprecision(2) << serial / secs << "x" << endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Bootstraps a batch of ciphertexts with a BootstrapperPool and reports the latency of each
+// bootstrapping operation and the aggregate throughput. Usage:
+//   bootstrappoolbench [memory budget in GiB] [number of ciphertexts]
+
+#include "latticpp/latticpp.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+int main(int argc, char **argv) {
+    double budgetGiB = 8;
+    int numCts = 8;
+    if (argc > 1) {
+        budgetGiB = atof(argv[1]);
+    }
+    if (argc > 2) {
+        numCts = max(1, atoi(argv[2]));
+    }
+
+    BootstrappingParameters btpParams = getBootstrappingParams(N15QP880H16384H32);
+    Parameters params = genParams(N15QP880H16384H32);
+
+    KeyGenerator kgen = newKeyGenerator(params);
+    struct KeyPairHandle kp = genKeyPairSparse(kgen, ephemeralSecretWeight(btpParams));
+    Encoder encoder = newEncoder(params);
+    Encryptor encryptor = newEncryptor(params, kp.pk);
+
+    RelinearizationKey relinKey = genRelinKey(kgen, kp.sk);
+    RotationKeys rotKeys = genRotationKeysForRotations(kgen, kp.sk, vector<int>());
+    BootstrappingKey btpKey = genBootstrappingKey(kgen, params, btpParams, kp.sk, relinKey, rotKeys);
+    Bootstrapper btp = newBootstrapper(params, btpParams, btpKey);
+
+    vector<double> values(numSlots(params), 0.5);
+    vector<Ciphertext> cts;
+    for (int i = 0; i < numCts; i++) {
+        cts.push_back(encryptNew(encryptor, encodeNew(encoder, values, 0, scale(params))));
+    }
+
+    BootstrapperPool pool(btp, static_cast<uint64_t>(budgetGiB * (1ULL << 30)));
+    cout << "Scratch space per bootstrapper: " << shallowCopyBytes(btp) / double(1 << 20) << " MiB" << endl;
+    cout << "Pool capacity for a " << budgetGiB << " GiB budget: " << pool.capacity() << endl;
+
+    BootstrapStats stats;
+    pool.bootstrapMany(cts, &stats);
+
+    cout << fixed << setprecision(3);
+    for (int i = 0; i < stats.latencies.size(); i++) {
+        cout << setw(6) << i << setw(12) << stats.latencies[i] << " s" << endl;
+    }
+    cout << "bootstrappers used: " << pool.size() << endl;
+    cout << "mean latency:       " << stats.meanLatency() << " s" << endl;
+    cout << "max latency:        " << *max_element(stats.latencies.begin(), stats.latencies.end()) << " s" << endl;
+    cout << "wall time:          " << stats.wallSeconds << " s" << endl;
+    cout << "throughput:         " << stats.throughput() << " ciphertexts/s" << endl;
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Runs a circuit of independent per-feature polynomials (x^3 + x^2 for each of 32 inputs,
+// then the sum of all of them) with the Circuit executor, on one worker and on one worker
+// per CPU.
+
+#include "common.h"
+#include "latticpp/latticpp.h"
+
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+const int FEATURES = 32;
+const int REPETITIONS = 4;
+
+int main() {
+    Parameters params = getDefaultClassicalParams(PN14QP438);
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    RelinearizationKey rlk = genRelinKey(kgen, sk);
+    Evaluator eval = newEvaluator(params, makeEvaluationKey(rlk));
+    EvaluatorPool pool(eval);
+    Encryptor encryptor = newEncryptor(params, sk);
+    Encoder encoder = newEncoder(params);
+    double s = scale(params);
+
+    Circuit circuit;
+    Circuit::Value total = 0;
+    for (int i = 0; i < FEATURES; i++) {
+        Circuit::Value x = circuit.input();
+        Circuit::Value x2 = circuit.rescale(circuit.mulRelin(x, x), s);
+        Circuit::Value x3 = circuit.rescale(circuit.mulRelin(x2, circuit.dropLevel(x, 1)), s);
+        Circuit::Value term = circuit.add(x3, circuit.dropLevel(x2, 1));
+        total = i == 0 ? term : circuit.add(total, term);
+    }
+    circuit.output(total);
+
+    vector<double> values(numSlots(params), 0.5);
+    vector<Ciphertext> inputs;
+    for (int i = 0; i < FEATURES; i++) {
+        inputs.push_back(encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), s)));
+    }
+
+    cout << circuit.numNodes() << " nodes" << endl;
+    cout << setw(10) << "workers" << setw(12) << "ms" << setw(10) << "speedup" << endl;
+    double serial = 0;
+    for (size_t workers : {size_t(1), size_t(thread::hardware_concurrency())}) {
+        double secs = timeIt([&]() { circuit.execute(params, pool, inputs, workers); }, REPETITIONS);
+        if (workers == 1) {
+            serial = secs;
+        }
+        cout << setw(10) << workers << fixed << setprecision(1) << setw(12) << 1e3 * secs
+             << setw(9) << setprecision(2) << serial / secs << "x" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Encode/decode throughput for each logSlots, comparing the real-valued std::vector API
+// with the complex-valued API, which reads and writes caller buffers in place and packs
+// two values into each slot. Throughput is reported in millions of doubles per second.
+
+#include "common.h"
+#include "latticpp/latticpp.h"
+
+#include <complex>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+const int REPETITIONS = 32;
+
+int main() {
+    Parameters params = getDefaultClassicalParams(PN15QP880);
+    Encoder encoder = newEncoder(params);
+    Plaintext pt = newPlaintext(params, maxLevel(params));
+
+    cout << setw(10) << "logSlots" << setw(14) << "encode real" << setw(16) << "encode complex"
+         << setw(14) << "decode real" << setw(16) << "decode complex" << "   (Mdoubles/s)" << endl;
+
+    for (uint64_t ls = 4; ls <= logSlots(params); ls++) {
+        size_t slots = ((size_t)1) << ls;
+        vector<double> realValues(slots, 0.25);
+        vector<complex<double>> complexValues(slots, complex<double>(0.25, -0.5));
+        vector<complex<double>> complexOut(slots);
+
+        double encReal = timeIt([&]() { encode(encoder, realValues, pt); }, REPETITIONS);
+        double encComplex = timeIt([&]() { encode(encoder, complexValues.data(), slots, pt); }, REPETITIONS);
+        double decReal = timeIt([&]() { decode(encoder, pt, ls); }, REPETITIONS);
+        double decComplex = timeIt([&]() { decode(encoder, pt, complexOut.data(), slots); }, REPETITIONS);
+
+        // the complex API moves two doubles per slot
+        cout << fixed << setprecision(2)
+             << setw(10) << ls
+             << setw(14) << slots / encReal / 1e6 << setw(16) << 2 * slots / encComplex / 1e6
+             << setw(14) << slots / decReal / 1e6 << setw(16) << 2 * slots / decComplex / 1e6 << endl;
+    }
+
+    return 0;
+}
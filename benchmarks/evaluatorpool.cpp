@@ -0,0 +1,82 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures mulRelin throughput when each thread borrows its own evaluator from an
+// EvaluatorPool. All evaluators share one set of evaluation keys, so throughput
+// should scale nearly linearly with the number of threads.
+
+#include "latticpp/latticpp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using namespace latticpp;
+
+const int OPS_PER_THREAD = 64;
+
+int main(int argc, char **argv) {
+    unsigned maxThreads = max(1u, thread::hardware_concurrency());
+    if (argc > 1) {
+        maxThreads = max(1, atoi(argv[1]));
+    }
+
+    Parameters params = getDefaultClassicalParams(PN13QP218);
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    RelinearizationKey rlk = genRelinKey(kgen, sk);
+    Encryptor encryptor = newEncryptor(params, sk);
+    Encoder encoder = newEncoder(params);
+
+    EvaluatorPool pool(params, makeEvaluationKey(rlk));
+
+    vector<double> values(numSlots(params), 0.5);
+    Ciphertext ct = encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), scale(params)));
+
+    vector<unsigned> threadCounts;
+    for (unsigned t = 1; t < maxThreads; t *= 2) {
+        threadCounts.push_back(t);
+    }
+    threadCounts.push_back(maxThreads);
+
+    cout << setw(8) << "threads" << setw(16) << "mulRelin/s" << setw(10) << "speedup" << setw(12) << "pool size" << endl;
+
+    double base = 0;
+    for (unsigned t : threadCounts) {
+        // one output ciphertext per thread, allocated up front
+        vector<Ciphertext> outputs;
+        for (unsigned i = 0; i < t; i++) {
+            outputs.push_back(newCiphertext(params, 2, maxLevel(params)));
+        }
+
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        vector<thread> threads;
+        for (unsigned i = 0; i < t; i++) {
+            threads.emplace_back([&, i]() {
+                EvaluatorPool::Lease eval = pool.checkout();
+                for (int j = 0; j < OPS_PER_THREAD; j++) {
+                    mulRelin(eval, ct, ct, outputs[i]);
+                }
+            });
+        }
+        for (thread &th : threads) {
+            th.join();
+        }
+        double secs = duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+
+        double throughput = t * OPS_PER_THREAD / secs;
+        if (t == 1) {
+            base = throughput;
+        }
+        cout << fixed << setprecision(2)
+             << setw(8) << t << setw(16) << throughput << setw(10) << throughput / base << setw(12) << pool.size() << endl;
+    }
+
+    return 0;
+}
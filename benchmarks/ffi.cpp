@@ -0,0 +1,210 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures the fixed cost of calling into Go, separately from any Lattigo work: an empty
+// cgo call, a registry lookup, incref and decref, creating and releasing a handle, copying
+// a GoHandle in C++, and the trivial getters level() and scale(). Each operation is timed
+// with 1, 2, 4, ... threads, once with every thread using the same handle (so they contend
+// for one registry slot) and once with a handle per thread. Usage:
+//   ffibench [max threads (default 64)] [csv]
+// aliasHandle is only exported by a Go library built with LATTICPP_BUILD_BENCHMARKS.
+
+#include "cgo/bench.h"
+#include "latticpp/latticpp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using namespace latticpp;
+
+// operations timed together; each thread runs one untimed batch first
+const size_t BATCH = 1024;
+// operations performed by each thread for each measurement
+const size_t OPS_PER_THREAD = 256 * BATCH;
+
+// keeps the calls below from being optimized away
+atomic<uint64_t> sink(0);
+
+struct Context {
+    Ciphertext ct;
+    // handles created by aliasHandle, released by the next phase
+    vector<uint64_t> aliases = vector<uint64_t>(BATCH);
+    uint64_t sum = 0;
+};
+
+struct Workload {
+    const char *name;
+    // one operation on the thread's context; i is its index within the batch
+    void (*op)(Context &, size_t i);
+    // if set, undoes `op` for the whole batch and is reported as a separate operation
+    const char *undoName;
+    void (*undo)(Context &, size_t i);
+};
+
+const Workload WORKLOADS[] = {
+    // increfCount is an export which only reads a counter, i.e. the cost of crossing itself
+    {"cgo call", [](Context &c, size_t) { c.sum += increfCount(); }, nullptr, nullptr},
+    // refCount resolves the handle like CrossLangObjMap.Get
+    {"lookup", [](Context &c, size_t) { c.sum += refCount(c.ct.getRawHandle()); }, nullptr, nullptr},
+    {"incref", [](Context &c, size_t) { incref(c.ct.getRawHandle()); },
+     "decref", [](Context &c, size_t) { decref(c.ct.getRawHandle()); }},
+    // Add (plus the lookup of the aliased handle), and releasing the new handle
+    {"add handle", [](Context &c, size_t i) { c.aliases[i] = aliasHandle(c.ct.getRawHandle()); },
+     "release handle", [](Context &c, size_t i) { decref(c.aliases[i]); }},
+    // the copy constructor and destructor of GoHandle, i.e. incref and decref
+    {"GoHandle copy", [](Context &c, size_t) { Ciphertext copy(c.ct); }, nullptr, nullptr},
+    {"level()", [](Context &c, size_t) { c.sum += level(c.ct); }, nullptr, nullptr},
+    {"scale()", [](Context &c, size_t) { c.sum += scale(c.ct) > 0; }, nullptr, nullptr},
+};
+
+struct Timing {
+    // mean time per operation seen by each thread, in nanoseconds
+    double opNanos;
+    double undoNanos;
+};
+
+// Run `workload` on `contexts.size()` threads, thread t using contexts[t]
+Timing run(const Workload &workload, vector<Context> &contexts) {
+    size_t numThreads = contexts.size();
+    vector<double> opSeconds(numThreads), undoSeconds(numThreads);
+    atomic<size_t> ready(0);
+    atomic<bool> go(false);
+    vector<thread> threads;
+
+    for (size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            Context &c = contexts[t];
+            auto batch = [&](bool timed) {
+                steady_clock::time_point start = steady_clock::now();
+                for (size_t i = 0; i < BATCH; i++) {
+                    workload.op(c, i);
+                }
+                steady_clock::time_point middle = steady_clock::now();
+                if (workload.undo != nullptr) {
+                    for (size_t i = 0; i < BATCH; i++) {
+                        workload.undo(c, i);
+                    }
+                }
+                if (timed) {
+                    opSeconds[t] += duration<double>(middle - start).count();
+                    undoSeconds[t] += duration<double>(steady_clock::now() - middle).count();
+                }
+            };
+            // the first call from a new thread also binds it to a Go runtime thread
+            batch(false);
+            ready++;
+            while (!go) {
+                this_thread::yield();
+            }
+            for (size_t n = 0; n < OPS_PER_THREAD; n += BATCH) {
+                batch(true);
+            }
+            sink += c.sum;
+        });
+    }
+
+    while (ready != numThreads) {
+        this_thread::yield();
+    }
+    go = true;
+    for (thread &th : threads) {
+        th.join();
+    }
+
+    double totalOps = double(numThreads) * OPS_PER_THREAD;
+    Timing timing;
+    timing.opNanos = 1e9 * accumulate(opSeconds.begin(), opSeconds.end(), 0.0) / totalOps;
+    timing.undoNanos = 1e9 * accumulate(undoSeconds.begin(), undoSeconds.end(), 0.0) / totalOps;
+    return timing;
+}
+
+struct Row {
+    string operation;
+    bool shared;
+    size_t threads;
+    double nanos;
+
+    // aggregate throughput, assuming the threads' operations overlap
+    double mops() const {
+        return threads * 1e3 / nanos;
+    }
+};
+
+int main(int argc, char **argv) {
+    size_t maxThreads = 64;
+    if (argc > 1) {
+        maxThreads = max(1, atoi(argv[1]));
+    }
+    bool csv = argc > 2 && string(argv[2]) == "csv";
+
+    Parameters params = getDefaultClassicalParams(PN12QP109);
+    Ciphertext ct = newCiphertext(params, 1, maxLevel(params));
+
+    vector<size_t> threadCounts;
+    for (size_t t = 1; t < maxThreads; t *= 2) {
+        threadCounts.push_back(t);
+    }
+    threadCounts.push_back(maxThreads);
+
+    vector<string> operations;
+    vector<Row> rows;
+    for (const Workload &workload : WORKLOADS) {
+        operations.push_back(workload.name);
+        if (workload.undo != nullptr) {
+            operations.push_back(workload.undoName);
+        }
+        for (bool shared : {true, false}) {
+            for (size_t t : threadCounts) {
+                vector<Context> contexts(t);
+                for (Context &c : contexts) {
+                    c.ct = shared ? ct : copyNew(ct);
+                }
+                Timing timing = run(workload, contexts);
+                rows.push_back({workload.name, shared, t, timing.opNanos});
+                if (workload.undo != nullptr) {
+                    rows.push_back({workload.undoName, shared, t, timing.undoNanos});
+                }
+            }
+        }
+    }
+
+    if (csv) {
+        cout << "operation,handles,threads,ns_per_op,mops_per_s" << endl;
+        for (const Row &r : rows) {
+            cout << r.operation << "," << (r.shared ? "shared" : "private") << "," << r.threads << ","
+                 << r.nanos << "," << r.mops() << endl;
+        }
+        return 0;
+    }
+
+    // ns/op is the mean latency seen by each thread, so flat columns mean no contention
+    cout << fixed << setprecision(1);
+    for (const string &operation : operations) {
+        cout << operation << endl;
+        cout << setw(8) << "threads" << setw(16) << "shared ns/op" << setw(16) << "private ns/op"
+             << setw(16) << "shared Mops/s" << setw(16) << "private Mops/s" << endl;
+        for (size_t t : threadCounts) {
+            const Row *shared = nullptr;
+            const Row *perThread = nullptr;
+            for (const Row &r : rows) {
+                if (r.operation == operation && r.threads == t) {
+                    (r.shared ? shared : perThread) = &r;
+                }
+            }
+            cout << setw(8) << t << setw(16) << shared->nanos << setw(16) << perThread->nanos
+                 << setw(16) << shared->mops() << setw(16) << perThread->mops() << endl;
+        }
+        cout << endl;
+    }
+    return 0;
+}
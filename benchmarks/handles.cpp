@@ -0,0 +1,119 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Counts the incref/decref calls which cross into Go while running the workload
+// from examples/euler.cpp, and while growing, reversing and erasing from a
+// std::vector<Ciphertext>. The container workloads run twice: once with GoHandle,
+// whose moves never call into Go, and once with CopyOnMove, which reproduces the
+// old GoHandle moves (incref on the new handle, decref when the moved-from handle
+// is destroyed), so the two columns compare the old and new paths.
+
+#include "latticpp/latticpp.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+const int CIPHERTEXTS = 64;
+
+// A handle whose moves copy, like GoHandle's moves did before they were made free
+template<GoType t>
+struct CopyOnMove {
+    explicit CopyOnMove(GoHandle<t> &&other) : handle(other) { }
+
+    CopyOnMove(const CopyOnMove &other) = default;
+
+    CopyOnMove(CopyOnMove &&other) noexcept : handle(other.handle) { }
+
+    CopyOnMove& operator= (const CopyOnMove &other) = default;
+
+    CopyOnMove& operator= (CopyOnMove &&other) noexcept {
+        handle = other.handle;
+        return *this;
+    }
+
+    GoHandle<t> handle;
+};
+
+struct RefOps {
+    uint64_t incref;
+    uint64_t decref;
+};
+
+// Run f with freshly reset counters and return the calls it made
+template<typename F>
+RefOps count(F f) {
+    setRefOpCounting(true);
+    f();
+    RefOps ops = {increfCount(), decrefCount()};
+    setRefOpCounting(false);
+    return ops;
+}
+
+// Every reallocation, reversal and erasure moves the existing elements
+template<typename H>
+void containerWorkload(CiphertextRef ct) {
+    vector<H> cts;
+    for (int i = 0; i < CIPHERTEXTS; i++) {
+        cts.push_back(H(copyNew(ct)));
+    }
+    reverse(cts.begin(), cts.end());
+    while (!cts.empty()) {
+        cts.erase(cts.begin());
+    }
+}
+
+void report(const string &phase, RefOps before, RefOps after) {
+    cout << setw(28) << left << phase << right
+         << setw(12) << before.incref << setw(12) << before.decref
+         << setw(12) << after.incref << setw(12) << after.decref << endl;
+}
+
+int main() {
+    uint64_t logNVal = 14;
+    vector<uint8_t> logQi = {55, 40, 40, 40, 40, 40, 40, 40};
+    vector<uint8_t> logPi = {45, 45};
+    uint8_t logScale = 40;
+    Parameters params = newParametersFromLogModuli(logNVal, logQi, logPi, logScale);
+
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    RelinearizationKey rlk = genRelinKey(kgen, sk);
+    Encryptor encryptor = newEncryptor(params, sk);
+    Decryptor decryptor = newDecryptor(params, sk);
+    Encoder encoder = newEncoder(params);
+    Evaluator evaluator = newEvaluator(params, makeEvaluationKey(rlk));
+
+    double r = 16;
+    double pi = 3.141592653589793;
+    vector<double> values(numSlots(params), 2 * pi);
+
+    // The euler.cpp workload only initializes handles from returned values, which C++17
+    // never moves, so both kinds of moves give the same counts and it is run once.
+    RefOps euler = count([&]() {
+        Plaintext plaintext = newPlaintext(params, maxLevel(params));
+        setScale(plaintext, scale(plaintext) / r);
+        encode(encoder, values, plaintext);
+        Ciphertext ciphertext = encryptNew(encryptor, plaintext);
+        multByConst(evaluator, ciphertext, 2, ciphertext);
+        setScale(ciphertext, scale(ciphertext) * r);
+        decode(encoder, decryptNew(decryptor, ciphertext), logSlots(params));
+    });
+
+    Ciphertext ciphertext = encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), scale(params)));
+    RefOps oldContainer = count([&]() { containerWorkload<CopyOnMove<GoType::Ciphertext>>(ciphertext); });
+    RefOps newContainer = count([&]() { containerWorkload<Ciphertext>(ciphertext); });
+
+    cout << setw(28) << "" << setw(24) << "copying moves" << setw(24) << "free moves" << endl;
+    cout << setw(28) << left << "workload" << right << setw(12) << "incref" << setw(12) << "decref"
+         << setw(12) << "incref" << setw(12) << "decref" << endl;
+    report("euler workload", euler, euler);
+    report("vector<Ciphertext> moves", oldContainer, newContainer);
+
+    return 0;
+}
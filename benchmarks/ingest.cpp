@@ -0,0 +1,64 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures how ingest rate (encoding and encrypting rows) scales with the number of
+// workers, comparing encodeNew+encryptNew per row with encodeEncryptBatch.
+
+#include "latticpp/latticpp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using namespace latticpp;
+
+const int NUM_ROWS = 256;
+
+int main(int argc, char **argv) {
+    unsigned maxWorkers = max(1u, thread::hardware_concurrency());
+    if (argc > 1) {
+        maxWorkers = max(1, atoi(argv[1]));
+    }
+
+    Parameters params = getDefaultClassicalParams(PN14QP438);
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    Encoder encoder = newEncoder(params);
+    Encryptor encryptor = newEncryptor(params, sk);
+
+    vector<vector<double>> rows(NUM_ROWS, vector<double>(numSlots(params), 0.5));
+
+    high_resolution_clock::time_point start = high_resolution_clock::now();
+    for (const vector<double> &row : rows) {
+        encryptNew(encryptor, encodeNew(encoder, row, maxLevel(params), scale(params)));
+    }
+    double baseline = NUM_ROWS / duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+    cout << "encodeNew + encryptNew: " << fixed << setprecision(2) << baseline << " rows/s" << endl;
+
+    vector<Ciphertext> outputs;
+    for (int i = 0; i < NUM_ROWS; i++) {
+        outputs.push_back(newCiphertext(params, 1, maxLevel(params)));
+    }
+
+    vector<unsigned> workerCounts;
+    for (unsigned w = 1; w < maxWorkers; w *= 2) {
+        workerCounts.push_back(w);
+    }
+    workerCounts.push_back(maxWorkers);
+
+    cout << setw(8) << "workers" << setw(14) << "rows/s" << setw(10) << "speedup" << endl;
+    for (unsigned w : workerCounts) {
+        start = high_resolution_clock::now();
+        encodeEncryptBatch(params, encoder, encryptor, rows, maxLevel(params), scale(params), outputs, w);
+        double rate = NUM_ROWS / duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+        cout << setw(8) << w << setw(14) << rate << setw(10) << rate / baseline << endl;
+    }
+
+    return 0;
+}
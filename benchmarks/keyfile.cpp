@@ -0,0 +1,101 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compares loading a full set of power-of-two rotation keys with unmarshalBinaryRotationKeys
+// against opening the same keys as a memory-mapped key file and loading only the few which
+// are used. Reports the load time and how much the resident set size grew. Each way of
+// loading runs in its own child process, so that neither reuses heap the other has grown.
+// Linux only.
+
+#include "common.h"
+#include "latticpp/latticpp.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using namespace latticpp;
+
+const string PATH = "keyfilebench.keys";
+
+template<typename F>
+void measure(const string &name, F load) {
+    uint64_t rssBefore = procStatusKiB("VmRSS");
+    high_resolution_clock::time_point start = high_resolution_clock::now();
+    load();
+    double secs = duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+    uint64_t rssAfter = procStatusKiB("VmRSS");
+
+    cout << setw(32) << left << name << right << fixed << setprecision(3)
+         << setw(10) << secs << " s" << setw(12) << setprecision(1)
+         << (rssAfter - rssBefore) / 1024.0 << " MiB RSS growth" << endl;
+}
+
+Parameters benchParams() {
+    return getDefaultClassicalParams(PN15QP880);
+}
+
+// Load the keys in the way named by `mode`; run by the child processes
+int load(const string &mode) {
+    Parameters params = benchParams();
+    if (mode == "unmarshal") {
+        measure("unmarshalBinaryRotationKeys", [&]() {
+            ifstream blob(PATH + ".bin", ios::binary);
+            RotationKeys rotKeys = unmarshalBinaryRotationKeys(blob);
+        });
+        return 0;
+    }
+    if (mode == "mmap") {
+        vector<uint64_t> used;
+        for (int k : {1, 2, 4, 8}) {
+            used.push_back(galoisElementForColumnRotationBy(params, k));
+        }
+        RotationKeyFile file;
+        measure("openRotationKeyFile", [&]() { file = openRotationKeyFile(PATH); });
+        measure("loadRotationKeys (4 keys)", [&]() { RotationKeys rotKeys = loadRotationKeys(file, used); });
+        return 0;
+    }
+    cerr << "unknown mode " << mode << endl;
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        return load(argv[1]);
+    }
+
+    Parameters params = benchParams();
+    vector<int> shifts;
+    for (uint64_t k = 1; k < numSlots(params); k *= 2) {
+        shifts.push_back(k);
+    }
+    {
+        KeyGenerator kgen = newKeyGenerator(params);
+        SecretKey sk = genSecretKey(kgen);
+        RotationKeys rotKeys = genRotationKeysForRotations(kgen, sk, shifts);
+        ofstream blob(PATH + ".bin", ios::binary);
+        marshalBinaryRotationKeys(rotKeys, blob);
+        ofstream file(PATH, ios::binary);
+        writeRotationKeyFile(rotKeys, file);
+    }
+    cout << shifts.size() << " rotation keys" << endl;
+
+    int status = 0;
+    for (const char *mode : {"unmarshal", "mmap"}) {
+        cout.flush();
+        if (system(("'" + string(argv[0]) + "' " + mode).c_str()) != 0) {
+            status = 1;
+        }
+    }
+
+    remove(PATH.c_str());
+    remove((PATH + ".bin").c_str());
+    return status;
+}
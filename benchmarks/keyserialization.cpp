@@ -0,0 +1,79 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Serializes N15QP880 bootstrapping keys to a stream which discards its input, and reports
+// the serialization throughput and how much the peak resident set size grew while doing so.
+// Linux only: the peak RSS is read from /proc/self/status, after resetting it through
+// /proc/self/clear_refs.
+
+#include "common.h"
+#include "latticpp/latticpp.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using namespace latticpp;
+
+// A streambuf which counts and discards everything written to it
+class CountingBuf : public streambuf {
+public:
+    uint64_t count = 0;
+
+protected:
+    streamsize xsputn(const char*, streamsize n) override {
+        count += n;
+        return n;
+    }
+
+    int overflow(int c) override {
+        count++;
+        return c;
+    }
+};
+
+void resetPeakRSS() {
+    ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+}
+
+template<typename F>
+void measure(const string &name, F serialize) {
+    CountingBuf buf;
+    ostream stream(&buf);
+
+    resetPeakRSS();
+    uint64_t rssBefore = procStatusKiB("VmRSS");
+    high_resolution_clock::time_point start = high_resolution_clock::now();
+    serialize(stream);
+    double secs = duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+    uint64_t peak = procStatusKiB("VmHWM");
+
+    double sizeMiB = buf.count / double(1 << 20);
+    cout << setw(20) << left << name << right << fixed << setprecision(1)
+         << setw(12) << sizeMiB << " MiB" << setw(10) << sizeMiB / secs << " MiB/s"
+         << setw(12) << (peak - rssBefore) / 1024.0 << " MiB peak RSS growth" << endl;
+}
+
+int main() {
+    BootstrappingParameters btpParams = getBootstrappingParams(N15QP880H16384H32);
+    Parameters params = genParams(N15QP880H16384H32);
+
+    KeyGenerator kgen = newKeyGenerator(params);
+    struct KeyPairHandle kp = genKeyPairSparse(kgen, ephemeralSecretWeight(btpParams));
+    RelinearizationKey relinKey = genRelinKey(kgen, kp.sk);
+    RotationKeys rotKeys = genRotationKeysForRotations(kgen, kp.sk, vector<int>());
+    BootstrappingKey btpKey = genBootstrappingKey(kgen, params, btpParams, kp.sk, relinKey, rotKeys);
+
+    measure("relinearization key", [&](ostream &s) { marshalBinaryRelinearizationKey(relinKey, s); });
+    measure("bootstrapping key", [&](ostream &s) { marshalBinaryBootstrappingKey(btpKey, s); });
+
+    return 0;
+}
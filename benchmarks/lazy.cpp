@@ -0,0 +1,69 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Inner products of n ciphertext pairs, computed eagerly (mul, relinearize and rescale after
+// every product, then sum) and with LazyCiphertext (one relinearization and one rescale after
+// the sum).
+
+#include "common.h"
+#include "latticpp/latticpp.h"
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+const int REPETITIONS = 4;
+const vector<int> TERM_COUNTS = {4, 16, 64};
+
+int main() {
+    Parameters params = getDefaultClassicalParams(PN14QP438);
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    RelinearizationKey rlk = genRelinKey(kgen, sk);
+    Evaluator eval = newEvaluator(params, makeEvaluationKey(rlk));
+    Encryptor encryptor = newEncryptor(params, sk);
+    Encoder encoder = newEncoder(params);
+
+    vector<double> values(numSlots(params), 0.5);
+    uint64_t top = maxLevel(params);
+    vector<Ciphertext> xs, ys;
+    for (int i = 0; i < TERM_COUNTS.back(); i++) {
+        xs.push_back(encryptNew(encryptor, encodeNew(encoder, values, top, scale(params))));
+        ys.push_back(encryptNew(encryptor, encodeNew(encoder, values, top, scale(params))));
+    }
+
+    cout << setw(8) << "terms" << setw(12) << "eager ms" << setw(12) << "lazy ms" << setw(10) << "speedup" << endl;
+
+    for (int n : TERM_COUNTS) {
+        double eager = timeIt([&]() {
+            Ciphertext sum = newCiphertext(params, 1, top - 1);
+            Ciphertext prod = newCiphertext(params, 1, top);
+            Ciphertext term = newCiphertext(params, 1, top);
+            for (int i = 0; i < n; i++) {
+                mul(eval, xs[i], ys[i], prod);
+                relinearize(eval, prod, prod);
+                rescale(eval, prod, scale(params), term);
+                if (i == 0) {
+                    sum = copyNew(term);
+                } else {
+                    add(eval, sum, term, sum);
+                }
+            }
+        }, REPETITIONS);
+
+        double lazy = timeIt([&]() {
+            LazyCiphertext sum = LazyCiphertext(params, eval, xs[0]) * LazyCiphertext(params, eval, ys[0]);
+            for (int i = 1; i < n; i++) {
+                sum = sum + LazyCiphertext(params, eval, xs[i]) * LazyCiphertext(params, eval, ys[i]);
+            }
+            sum.materialize();
+        }, REPETITIONS);
+
+        cout << setw(8) << n << fixed << setprecision(1) << setw(12) << 1e3 * eager << setw(12) << 1e3 * lazy
+             << setw(9) << setprecision(2) << eager / lazy << "x" << endl;
+    }
+    return 0;
+}
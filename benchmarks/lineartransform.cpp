@@ -0,0 +1,119 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compares multiplying an encrypted vector by a plaintext matrix with k non-zero diagonals
+// using one rotate(), mulPlain() and add() per diagonal against a LinearTransform, which
+// needs a single call into Go and roughly 2 sqrt(k) key switches. Both results are checked
+// against the product computed in the clear.
+
+#include "common.h"
+#include "latticpp/latticpp.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+const int REPETITIONS = 4;
+const vector<int> DIAGONAL_COUNTS = {8, 32, 128};
+const double TOLERANCE = 1e-3;
+
+double maxError(EncoderRef encoder, DecryptorRef decryptor, uint64_t logSlots, CiphertextRef ct, const vector<double> &expected) {
+    vector<double> result = decode(encoder, decryptNew(decryptor, ct), logSlots);
+    double err = 0;
+    for (size_t i = 0; i < expected.size(); i++) {
+        err = max(err, abs(result[i] - expected[i]));
+    }
+    return err;
+}
+
+int main() {
+    Parameters params = getDefaultClassicalParams(PN13QP218);
+    size_t slots = numSlots(params);
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    RelinearizationKey rlk = genRelinKey(kgen, sk);
+    Encryptor encryptor = newEncryptor(params, sk);
+    Decryptor decryptor = newDecryptor(params, sk);
+    Encoder encoder = newEncoder(params);
+
+    vector<double> values(slots);
+    for (size_t i = 0; i < slots; i++) {
+        values[i] = double(i % 7) / 7;
+    }
+    Ciphertext ct = encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), scale(params)));
+
+    cout << setw(10) << "diagonals" << setw(18) << "per-diagonal ms" << setw(12) << "BSGS ms" << setw(10) << "speedup" << endl;
+
+    for (int count : DIAGONAL_COUNTS) {
+        map<int, vector<double>> diagonals;
+        for (int d = 0; d < count; d++) {
+            diagonals[d] = vector<double>(slots, 1.0 / count);
+        }
+        vector<double> expected(slots, 0);
+        for (const auto &diag : diagonals) {
+            for (size_t i = 0; i < slots; i++) {
+                expected[i] += diag.second[i] * values[(i + diag.first) % slots];
+            }
+        }
+
+        LinearTransform lt = newLinearTransform(params, encoder, diagonals, maxLevel(params), scale(params));
+        vector<Plaintext> encoded;
+        set<int> keyRotations;
+        for (const auto &diag : diagonals) {
+            encoded.push_back(encodeNew(encoder, diag.second, maxLevel(params), scale(params)));
+            keyRotations.insert(diag.first);
+        }
+        for (int k : rotations(lt)) {
+            keyRotations.insert(k);
+        }
+        keyRotations.erase(0);
+        RotationKeys rotKeys = genRotationKeysForRotations(kgen, sk, vector<int>(keyRotations.begin(), keyRotations.end()));
+        Evaluator eval = newEvaluator(params, makeEvaluationKey(rlk, rotKeys));
+
+        Ciphertext rotated = newCiphertext(params, 1, maxLevel(params));
+        Ciphertext term = newCiphertext(params, 1, maxLevel(params));
+        Ciphertext naiveOut = newCiphertext(params, 1, maxLevel(params));
+        Ciphertext bsgsOut = newCiphertext(params, 1, maxLevel(params));
+
+        double naive = timeIt([&]() {
+            size_t i = 0;
+            for (const auto &diag : diagonals) {
+                // the first product initializes the sum
+                Ciphertext &product = i == 0 ? naiveOut : term;
+                if (diag.first == 0) {
+                    mulPlain(eval, ct, encoded[i], product);
+                } else {
+                    rotate(eval, ct, diag.first, rotated);
+                    mulPlain(eval, rotated, encoded[i], product);
+                }
+                if (i > 0) {
+                    add(eval, naiveOut, term, naiveOut);
+                }
+                i++;
+            }
+        }, REPETITIONS);
+
+        double bsgs = timeIt([&]() { linearTransform(eval, lt, ct, bsgsOut); }, REPETITIONS);
+
+        double naiveErr = maxError(encoder, decryptor, logSlots(params), naiveOut, expected);
+        double bsgsErr = maxError(encoder, decryptor, logSlots(params), bsgsOut, expected);
+        if (naiveErr > TOLERANCE || bsgsErr > TOLERANCE) {
+            cout << "wrong result for " << count << " diagonals (max error " << naiveErr << " per diagonal, "
+                 << bsgsErr << " BSGS)" << endl;
+            return EXIT_FAILURE;
+        }
+
+        cout << fixed << setprecision(2)
+             << setw(10) << count << setw(18) << 1e3 * naive << setw(12) << 1e3 * bsgs << setw(10) << naive / bsgs << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compares the size of the bit-packed ciphertext wire format with marshalBinaryCiphertext for
+// the default parameter sets, for fresh ciphertexts at level 0, level 1 and the top level, and
+// for top-level ciphertexts truncated to level 0 when they are packed. Also reports the time
+// to pack and unpack one ciphertext.
+
+#include "common.h"
+#include "latticpp/latticpp.h"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+const int REPETITIONS = 16;
+
+void report(const string &name, ParametersRef params, EncoderRef encoder, EncryptorRef encryptor,
+            uint64_t level, uint64_t packLevel) {
+    vector<double> values(numSlots(params), 0.25);
+    Plaintext pt = encodeNew(encoder, values, level, scale(params));
+    Ciphertext ct = encryptNew(encryptor, pt);
+
+    uint64_t fullSize = marshalBinarySize(ct);
+    uint64_t packedSize = marshalBinarySizePacked(params, ct, packLevel);
+    vector<char> buffer(packedSize);
+    double packTime = timeIt([&]() { marshalIntoPacked(params, ct, buffer.data(), buffer.size(), packLevel); },
+                             REPETITIONS);
+    double unpackTime = timeIt([&]() { unmarshalBinaryPackedCiphertext(params, buffer.data(), buffer.size()); },
+                               REPETITIONS);
+
+    string levels = to_string(level) + (packLevel < level ? "->" + to_string(packLevel) : "");
+    cout << setw(12) << left << name << right << setw(8) << levels << fixed << setprecision(1)
+         << setw(12) << fullSize / 1024.0 << setw(12) << packedSize / 1024.0
+         << setw(10) << 100.0 * (1.0 - double(packedSize) / fullSize) << "%"
+         << setw(10) << setprecision(3) << 1e3 * packTime << setw(10) << 1e3 * unpackTime << endl;
+}
+
+int main() {
+    cout << setw(12) << left << "params" << right << setw(8) << "level" << setw(12) << "full KiB"
+         << setw(12) << "packed KiB" << setw(11) << "saved" << setw(10) << "pack ms" << setw(10) << "unpack ms" << endl;
+
+    vector<pair<string, NamedClassicalParams>> paramSets = {
+        {"PN12QP109", PN12QP109}, {"PN13QP218", PN13QP218}, {"PN14QP438", PN14QP438}, {"PN15QP880", PN15QP880}};
+    for (const auto &named : paramSets) {
+        Parameters params = getDefaultClassicalParams(named.second);
+        KeyGenerator kgen = newKeyGenerator(params);
+        SecretKey sk = genSecretKey(kgen);
+        Encoder encoder = newEncoder(params);
+        Encryptor encryptor = newEncryptor(params, sk);
+        uint64_t top = maxLevel(params);
+
+        report(named.first, params, encoder, encryptor, 0, KEEP_LEVEL);
+        report(named.first, params, encoder, encryptor, 1, KEEP_LEVEL);
+        report(named.first, params, encoder, encryptor, top, KEEP_LEVEL);
+        report(named.first, params, encoder, encryptor, top, 0);
+    }
+    return 0;
+}
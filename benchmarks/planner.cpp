@@ -0,0 +1,73 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Plans the levels and bootstraps of an iterated map (x <- 0.5 x^2 + 0.25, two levels per
+// iteration) on a few ciphertexts, prints the plan and its predicted cost, then executes it
+// and compares the measured time with the prediction. Usage:
+//   plannerbench [iterations]
+
+#include "latticpp/latticpp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using namespace latticpp;
+
+const int NUM_INPUTS = 4;
+
+int main(int argc, char **argv) {
+    int iterations = 8;
+    if (argc > 1) {
+        iterations = max(1, atoi(argv[1]));
+    }
+
+    BootstrappingParameters btpParams = getBootstrappingParams(N15QP880H16384H32);
+    Parameters params = genParams(N15QP880H16384H32);
+
+    KeyGenerator kgen = newKeyGenerator(params);
+    struct KeyPairHandle kp = genKeyPairSparse(kgen, ephemeralSecretWeight(btpParams));
+    Encoder encoder = newEncoder(params);
+    Encryptor encryptor = newEncryptor(params, kp.pk);
+
+    RelinearizationKey relinKey = genRelinKey(kgen, kp.sk);
+    RotationKeys rotKeys = genRotationKeysForRotations(kgen, kp.sk, vector<int>());
+    BootstrappingKey btpKey = genBootstrappingKey(kgen, params, btpParams, kp.sk, relinKey, rotKeys);
+    Bootstrapper btp = newBootstrapper(params, btpParams, btpKey);
+    Evaluator eval = newEvaluator(params, makeEvaluationKey(relinKey));
+
+    Circuit circuit;
+    for (int i = 0; i < NUM_INPUTS; i++) {
+        Circuit::Value x = circuit.input();
+        for (int it = 0; it < iterations; it++) {
+            x = circuit.addConst(circuit.multByConst(circuit.mulRelin(x, x), 0.5), 0.25);
+        }
+        circuit.output(x);
+    }
+
+    CostModel costs = measureCosts(params, eval, btp);
+    LevelPlan plan = planLevels(circuit, params, btpParams, maxLevel(params), costs);
+    cout << plan.listing << endl;
+    cout << "levels: " << maxLevel(params) << " at input, " << outputLevel(btpParams) << " after bootstrapping" << endl;
+    cout << "bootstraps: " << plan.bootstraps << ", rescales: " << plan.rescales
+         << ", level drops: " << plan.levelDrops << endl;
+    cout << "predicted: " << plan.predictedSeconds << " s (" << plan.bootstrapSeconds << " s bootstrapping)" << endl;
+
+    vector<double> values(numSlots(params), 0.5);
+    vector<Ciphertext> inputs;
+    for (int i = 0; i < NUM_INPUTS; i++) {
+        inputs.push_back(encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), scale(params))));
+    }
+
+    EvaluatorPool evaluators(eval);
+    BootstrapperPool bootstrappers(btp, 8ULL << 30);
+    high_resolution_clock::time_point start = high_resolution_clock::now();
+    plan.circuit.execute(params, evaluators, bootstrappers, inputs, 1);
+    double secs = duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+    cout << "measured:  " << secs << " s on one thread" << endl;
+    return 0;
+}
@@ -0,0 +1,103 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Multithreaded stress benchmark for the Go handle registry (marshal/storage.go).
+// Every exported lattigo_* function resolves its operands through the registry,
+// so lookup throughput should scale linearly with the number of threads.
+
+#include "latticpp/latticpp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using namespace latticpp;
+
+// number of distinct live handles the threads look up
+const size_t NUM_HANDLES = 4096;
+// operations performed by each thread for each measurement
+const uint64_t OPS_PER_THREAD = 1 << 21;
+
+enum class Workload { Lookup, IncrefDecref };
+
+// Run `numThreads` threads which each perform OPS_PER_THREAD operations on the handles,
+// and return the aggregate throughput in millions of operations per second.
+double run(Workload workload, const vector<PRNG> &handles, unsigned numThreads) {
+    atomic<unsigned> ready(0);
+    atomic<bool> go(false);
+    vector<thread> threads;
+
+    for (unsigned t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            // each thread walks the handles with a different stride so that threads do not
+            // hit the same slots in lock-step
+            uint64_t idx = t * 7919;
+            ready++;
+            while (!go) { }
+            for (uint64_t i = 0; i < OPS_PER_THREAD; i++) {
+                uint64_t h = handles[idx % NUM_HANDLES].getRawHandle();
+                if (workload == Workload::Lookup) {
+                    refCount(h);
+                } else {
+                    incref(h);
+                    decref(h);
+                }
+                idx += 2 * t + 1;
+            }
+        });
+    }
+
+    while (ready != numThreads) { }
+    high_resolution_clock::time_point start = high_resolution_clock::now();
+    go = true;
+    for (thread &th : threads) {
+        th.join();
+    }
+    double secs = duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+
+    return (numThreads * OPS_PER_THREAD) / secs / 1e6;
+}
+
+int main(int argc, char **argv) {
+    unsigned maxThreads = max(1u, thread::hardware_concurrency());
+    if (argc > 1) {
+        maxThreads = max(1, atoi(argv[1]));
+    }
+
+    vector<PRNG> handles;
+    for (size_t i = 0; i < NUM_HANDLES; i++) {
+        handles.push_back(newPRNG());
+    }
+
+    vector<unsigned> threadCounts;
+    for (unsigned t = 1; t < maxThreads; t *= 2) {
+        threadCounts.push_back(t);
+    }
+    threadCounts.push_back(maxThreads);
+
+    cout << setw(8) << "threads" << setw(16) << "lookup Mops/s" << setw(10) << "speedup"
+         << setw(20) << "inc/dec Mops/s" << setw(10) << "speedup" << endl;
+
+    double baseLookup = 0;
+    double baseRef = 0;
+    for (unsigned t : threadCounts) {
+        double lookup = run(Workload::Lookup, handles, t);
+        double ref = run(Workload::IncrefDecref, handles, t);
+        if (t == 1) {
+            baseLookup = lookup;
+            baseRef = ref;
+        }
+        cout << fixed << setprecision(2)
+             << setw(8) << t << setw(16) << lookup << setw(10) << lookup / baseLookup
+             << setw(20) << ref << setw(10) << ref / baseRef << endl;
+    }
+
+    return 0;
+}
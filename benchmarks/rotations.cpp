@@ -0,0 +1,75 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compares computing k rotations of one ciphertext with k calls to rotate() against a
+// RotationPlan, which decomposes the ciphertext once and reuses the decomposition for
+// every rotation.
+
+#include "latticpp/latticpp.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using namespace latticpp;
+
+const int REPETITIONS = 4;
+const vector<int> ROTATION_COUNTS = {8, 32, 128};
+
+int main() {
+    Parameters params = getDefaultClassicalParams(PN13QP218);
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    RelinearizationKey rlk = genRelinKey(kgen, sk);
+
+    int maxRotations = ROTATION_COUNTS.back();
+    vector<int> rotations;
+    for (int k = 1; k <= maxRotations; k++) {
+        rotations.push_back(k);
+    }
+    RotationKeys rotKeys = genRotationKeysForRotations(kgen, sk, rotations);
+    EvaluationKey evalKey = makeEvaluationKey(rlk, rotKeys);
+
+    Evaluator eval = newEvaluator(params, evalKey);
+    RotationPlan plan = newRotationPlan(params, evalKey);
+    Encryptor encryptor = newEncryptor(params, sk);
+    Encoder encoder = newEncoder(params);
+
+    vector<double> values(numSlots(params), 0.5);
+    Ciphertext ct = encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), scale(params)));
+
+    vector<Ciphertext> outputs;
+    for (int i = 0; i < maxRotations; i++) {
+        outputs.push_back(newCiphertext(params, 1, maxLevel(params)));
+    }
+
+    cout << setw(10) << "rotations" << setw(16) << "rotate() ms" << setw(16) << "plan ms" << setw(10) << "speedup" << endl;
+
+    for (int count : ROTATION_COUNTS) {
+        vector<uint64_t> ks(rotations.begin(), rotations.begin() + count);
+        vector<Ciphertext> out(outputs.begin(), outputs.begin() + count);
+
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        for (int r = 0; r < REPETITIONS; r++) {
+            for (int i = 0; i < count; i++) {
+                rotate(eval, ct, ks[i], out[i]);
+            }
+        }
+        double naive = duration_cast<duration<double, milli>>(high_resolution_clock::now() - start).count() / REPETITIONS;
+
+        start = high_resolution_clock::now();
+        for (int r = 0; r < REPETITIONS; r++) {
+            decompose(plan, ct);
+            rotateHoisted(plan, ks, out);
+        }
+        double hoisted = duration_cast<duration<double, milli>>(high_resolution_clock::now() - start).count() / REPETITIONS;
+
+        cout << fixed << setprecision(2)
+             << setw(10) << count << setw(16) << naive << setw(16) << hoisted << setw(10) << naive / hoisted << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compares the size and the serialization/deserialization latency of the regular format with
+// the seeded format, which stores a PRNG seed in place of the uniformly random half of each
+// ciphertext and key.
+
+#include "common.h"
+#include "latticpp/latticpp.h"
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+const int REPETITIONS = 8;
+
+void compare(const string &name,
+             function<void(ostream&)> marshal, function<void(istream&)> unmarshal,
+             function<void(ostream&)> marshalSeeded, function<void(istream&)> unmarshalSeeded) {
+    stringstream full, seeded;
+    marshal(full);
+    marshalSeeded(seeded);
+    string fullBytes = full.str();
+    string seededBytes = seeded.str();
+
+    double fullWrite = timeIt([&]() { ostringstream s; marshal(s); }, REPETITIONS);
+    double seededWrite = timeIt([&]() { ostringstream s; marshalSeeded(s); }, REPETITIONS);
+    double fullRead = timeIt([&]() { istringstream s(fullBytes); unmarshal(s); }, REPETITIONS);
+    double seededRead = timeIt([&]() { istringstream s(seededBytes); unmarshalSeeded(s); }, REPETITIONS);
+
+    cout << setw(22) << left << name << right << fixed << setprecision(2)
+         << setw(12) << fullBytes.size() / 1024.0 << setw(12) << seededBytes.size() / 1024.0
+         << setw(10) << 1e3 * fullWrite << setw(10) << 1e3 * seededWrite
+         << setw(10) << 1e3 * fullRead << setw(10) << 1e3 * seededRead << endl;
+}
+
+int main() {
+    Parameters params = getDefaultClassicalParams(PN14QP438);
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    Encoder encoder = newEncoder(params);
+    Encryptor encryptor = newEncryptor(params, sk);
+
+    vector<double> values(numSlots(params), 0.5);
+    Plaintext pt = encodeNew(encoder, values, maxLevel(params), scale(params));
+    Ciphertext ct = encryptSeededNew(params, encryptor, sk, pt);
+    PublicKey pk = genPublicKeySeeded(params, kgen, sk);
+    RelinearizationKey relinKey = genRelinKeySeeded(params, kgen, sk);
+    RotationKeys rotKeys = genRotationKeysForRotationsSeeded(params, kgen, sk, {1, 2, 4, 8});
+
+    cout << setw(22) << left << "" << right << setw(24) << "size (KiB)"
+         << setw(20) << "write (ms)" << setw(20) << "read (ms)" << endl;
+    cout << setw(22) << left << "" << right << setw(12) << "full" << setw(12) << "seeded"
+         << setw(10) << "full" << setw(10) << "seeded" << setw(10) << "full" << setw(10) << "seeded" << endl;
+
+    compare("ciphertext",
+            [&](ostream &s) { marshalBinaryCiphertext(ct, s); },
+            [&](istream &s) { unmarshalBinaryCiphertext(s); },
+            [&](ostream &s) { marshalBinarySeededCiphertext(ct, s); },
+            [&](istream &s) { unmarshalBinarySeededCiphertext(params, s); });
+    compare("public key",
+            [&](ostream &s) { marshalBinaryPublicKey(pk, s); },
+            [&](istream &s) { unmarshalBinaryPublicKey(s); },
+            [&](ostream &s) { marshalBinarySeededPublicKey(pk, s); },
+            [&](istream &s) { unmarshalBinarySeededPublicKey(params, s); });
+    compare("relinearization key",
+            [&](ostream &s) { marshalBinaryRelinearizationKey(relinKey, s); },
+            [&](istream &s) { unmarshalBinaryRelinearizationKey(s); },
+            [&](ostream &s) { marshalBinarySeededRelinearizationKey(relinKey, s); },
+            [&](istream &s) { unmarshalBinarySeededRelinearizationKey(params, s); });
+    compare("rotation keys (4)",
+            [&](ostream &s) { marshalBinaryRotationKeys(rotKeys, s); },
+            [&](istream &s) { unmarshalBinaryRotationKeys(s); },
+            [&](ostream &s) { marshalBinarySeededRotationKeys(rotKeys, s); },
+            [&](istream &s) { unmarshalBinarySeededRotationKeys(params, s); });
+
+    return 0;
+}
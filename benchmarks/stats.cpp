@@ -0,0 +1,73 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures the overhead of per-call statistics on a cheap call into Go, with statistics off
+// and on, then runs a short CKKS workload with statistics on and prints them. Usage:
+//   statsbench [prometheus|json]
+
+#include "latticpp/latticpp.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using namespace latticpp;
+
+const int CHEAP_CALLS = 1000000;
+
+// keeps the calls below from being optimized away
+volatile uint64_t sink;
+
+// nanoseconds per call of level(), which does almost nothing in Go
+double cheapCallNanos(const Ciphertext &ct) {
+    uint64_t sum = 0;
+    high_resolution_clock::time_point start = high_resolution_clock::now();
+    for (int i = 0; i < CHEAP_CALLS; i++) {
+        sum += level(ct);
+    }
+    sink = sum;
+    return duration_cast<duration<double, nano>>(high_resolution_clock::now() - start).count() / CHEAP_CALLS;
+}
+
+int main(int argc, char **argv) {
+    bool json = argc > 1 && string(argv[1]) == "json";
+
+    Parameters params = getDefaultClassicalParams(PN14QP438);
+    KeyGenerator kgen = newKeyGenerator(params);
+    SecretKey sk = genSecretKey(kgen);
+    RelinearizationKey rlk = genRelinKey(kgen, sk);
+    Evaluator eval = newEvaluator(params, makeEvaluationKey(rlk));
+    Encryptor encryptor = newEncryptor(params, sk);
+    Decryptor decryptor = newDecryptor(params, sk);
+    Encoder encoder = newEncoder(params);
+
+    vector<double> values(numSlots(params), 0.5);
+    Ciphertext ct = encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), scale(params)));
+
+    setStatsCollection(false);
+    double off = cheapCallNanos(ct);
+    setStatsCollection(true, 0);
+    double on = cheapCallNanos(ct);
+    setStatsCollection(true);
+    double sampled = cheapCallNanos(ct);
+    cerr << fixed << setprecision(1)
+         << "level() with statistics off:                 " << off << " ns" << endl
+         << "level() with statistics on:                  " << on << " ns" << endl
+         << "level() with statistics and alloc sampling:  " << sampled << " ns" << endl;
+
+    setStatsCollection(true);
+    for (int i = 0; i < 16; i++) {
+        Ciphertext x = encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), scale(params)));
+        Ciphertext y = mulRelinNew(eval, x, ct);
+        Ciphertext z = newCiphertext(params, 1, level(y) - 1);
+        rescale(eval, y, scale(params), z);
+        decode(encoder, decryptNew(decryptor, z), logSlots(params));
+    }
+    Stats s = stats();
+    cout << (json ? s.toJson() : s.toPrometheus()) << endl;
+    return 0;
+}
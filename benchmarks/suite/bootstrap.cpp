@@ -0,0 +1,39 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Benchmarks of bootstrap.h, run only for the bootstrapping presets
+
+#include "harness.h"
+
+#include <memory>
+
+using namespace std;
+
+namespace suite {
+
+    void addBootstrapBenchmarks(Suite &suite) {
+        // BATCH_SIZE ciphertexts at level 0, as they would be when they need bootstrapping
+        auto exhausted = make_shared<vector<Ciphertext>>();
+        auto prepare = [exhausted](Fixture &f) {
+            f.ensureBootstrapper();
+            exhausted->clear();
+            for (size_t i = 0; i < BATCH_SIZE; i++) {
+                exhausted->push_back(encryptNew(f.encryptor, encodeNew(f.encoder, f.values, 0, scale(f.params))));
+            }
+        };
+        auto add = [&suite, prepare](const string &name, function<void(Fixture &)> run) {
+            Benchmark &b = suite.add("bootstrap", name, run);
+            b.prepare = prepare;
+            b.needsBootstrapping = true;
+        };
+
+        add("newBootstrapper", [](Fixture &f) { newBootstrapper(f.params, f.btpParams, f.btpKey); });
+        add("bootstrap", [exhausted](Fixture &f) { bootstrap(f.btp, exhausted->front()); });
+        add("bootstrapAsync", [exhausted](Fixture &f) { bootstrapAsync(f.btp, exhausted->front()).get(); });
+        add("shallowCopy", [](Fixture &f) { shallowCopy(f.btp); });
+        add("shallowCopyBytes", [](Fixture &f) { shallowCopyBytes(f.btp); });
+        // two copies show the overlap without the memory of one copy per CPU
+        add("bootstrapMany", [exhausted](Fixture &f) { bootstrapMany(f.btp, *exhausted, 2); });
+    }
+
+}  // namespace suite
@@ -0,0 +1,78 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Benchmarks of encoder.h, encryptor.h and decryptor.h
+
+#include "harness.h"
+
+#include <memory>
+
+using namespace std;
+
+namespace suite {
+
+    void addEncodingBenchmarks(Suite &suite) {
+        suite.add("encoder", "newEncoder", [](Fixture &f) { newEncoder(f.params); });
+        // encode overwrites a plaintext allocated ahead of time
+        auto pt = make_shared<Plaintext>();
+        auto newTopLevelPlaintext = [pt](Fixture &f) { *pt = newPlaintext(f.params, maxLevel(f.params)); };
+        suite.add("encoder", "encode(real)", [pt](Fixture &f) {
+            encode(f.encoder, f.values, *pt);
+        }).prepare = newTopLevelPlaintext;
+        suite.add("encoder", "encodeNew(real)", [](Fixture &f) {
+            encodeNew(f.encoder, f.values, maxLevel(f.params), scale(f.params));
+        });
+        suite.add("encoder", "encode(complex vector)", [pt](Fixture &f) {
+            encode(f.encoder, f.complexValues, *pt);
+        }).prepare = newTopLevelPlaintext;
+        suite.add("encoder", "encode(complex pointer)", [pt](Fixture &f) {
+            encode(f.encoder, f.complexValues.data(), f.complexValues.size(), *pt);
+        }).prepare = newTopLevelPlaintext;
+        suite.add("encoder", "encodeNew(complex vector)", [](Fixture &f) {
+            encodeNew(f.encoder, f.complexValues, maxLevel(f.params), scale(f.params));
+        });
+        suite.add("encoder", "encodeNew(complex pointer)", [](Fixture &f) {
+            encodeNew(f.encoder, f.complexValues.data(), f.complexValues.size(), maxLevel(f.params), scale(f.params));
+        });
+        suite.add("encoder", "decode(real)", [](Fixture &f) { decode(f.encoder, f.pt, logSlots(f.params)); });
+        suite.add("encoder", "decodeComplex", [](Fixture &f) { decodeComplex(f.encoder, f.pt, logSlots(f.params)); });
+        auto decoded = make_shared<vector<complex<double>>>();
+        suite.add("encoder", "decode(complex pointer)", [decoded](Fixture &f) {
+            decode(f.encoder, f.pt, decoded->data(), decoded->size());
+        }).prepare = [decoded](Fixture &f) { decoded->resize(numSlots(f.params)); };
+        suite.add("encoder", "encodeBatch", [](Fixture &f) {
+            encodeBatch(f.encoder, f.rows, maxLevel(f.params), scale(f.params));
+        });
+        auto pts = make_shared<vector<Plaintext>>();
+        Benchmark &encodeInto = suite.add("encoder", "encodeBatch(into)", [pts](Fixture &f) {
+            encodeBatch(f.encoder, f.rows, *pts);
+        });
+        encodeInto.prepare = [pts](Fixture &f) {
+            pts->clear();
+            for (size_t i = 0; i < BATCH_SIZE; i++) {
+                pts->push_back(newPlaintext(f.params, maxLevel(f.params)));
+            }
+        };
+        suite.add("encoder", "encodeEncryptBatch", [](Fixture &f) {
+            encodeEncryptBatch(f.params, f.encoder, f.encryptor, f.rows, maxLevel(f.params), scale(f.params));
+        });
+        suite.add("encoder", "encodeEncryptBatch(into)", [](Fixture &f) {
+            encodeEncryptBatch(f.params, f.encoder, f.encryptor, f.rows, maxLevel(f.params), scale(f.params), f.outs);
+        });
+
+        suite.add("encryptor", "newEncryptor(sk)", [](Fixture &f) { newEncryptor(f.params, f.sk); });
+        suite.add("encryptor", "newEncryptor(pk)", [](Fixture &f) { newEncryptor(f.params, f.pk); });
+        suite.add("encryptor", "encryptNew(sk)", [](Fixture &f) { encryptNew(f.skEncryptor, f.pt); });
+        suite.add("encryptor", "encryptNew(pk)", [](Fixture &f) { encryptNew(f.encryptor, f.pt); });
+        suite.add("encryptor", "encryptBatch", [](Fixture &f) { encryptBatch(f.encryptor, f.pts); });
+        suite.add("encryptor", "encryptBatch(into)", [](Fixture &f) { encryptBatch(f.encryptor, f.pts, f.outs); });
+        auto ctQP = make_shared<CiphertextQP>();
+        suite.add("encryptor", "encryptZeroQP", [ctQP](Fixture &f) {
+            encryptZeroQP(f.params, f.sk, *ctQP);
+        }).prepare = [ctQP](Fixture &f) { *ctQP = newCiphertextQP(f.params); };
+
+        suite.add("decryptor", "newDecryptor", [](Fixture &f) { newDecryptor(f.params, f.sk); });
+        suite.add("decryptor", "decryptNew", [](Fixture &f) { decryptNew(f.decryptor, f.ct0); });
+    }
+
+}  // namespace suite
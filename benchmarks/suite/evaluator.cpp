@@ -0,0 +1,124 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Benchmarks of evaluator.h
+
+#include "harness.h"
+
+#include <cmath>
+#include <memory>
+
+using namespace std;
+
+namespace suite {
+
+    // Degrees of the polynomials evaluated by evaluatePoly and evaluateChebyshev
+    const uint64_t POLY_DEGREE = 7;
+    const uint64_t CHEBYSHEV_DEGREE = 15;
+
+    static vector<uint64_t> hoistedRotations() {
+        return vector<uint64_t>(ROTATIONS.begin(), ROTATIONS.end());
+    }
+
+    void addEvaluatorBenchmarks(Suite &suite) {
+        suite.add("evaluator", "newEvaluator", [](Fixture &f) { newEvaluator(f.params, f.evalKey); });
+        suite.add("evaluator", "evaluatorWithKey", [](Fixture &f) { evaluatorWithKey(f.eval, f.evalKey); });
+        suite.add("evaluator", "shallowCopy", [](Fixture &f) { shallowCopy(f.eval); });
+
+        suite.add("evaluator", "rotate", [](Fixture &f) { rotate(f.eval, f.ct0, 1, f.out); });
+        suite.add("evaluator", "rotateHoisted", [](Fixture &f) { rotateHoisted(f.eval, f.ct0, hoistedRotations()); });
+        suite.add("evaluator", "newRotationPlan", [](Fixture &f) { newRotationPlan(f.params, f.evalKey); });
+        auto plan = make_shared<RotationPlan>();
+        auto planOuts = make_shared<vector<Ciphertext>>();
+        auto decomposedPlan = [plan, planOuts](Fixture &f) {
+            *plan = newRotationPlan(f.params, f.evalKey);
+            decompose(*plan, f.ct0);
+            planOuts->clear();
+            for (size_t i = 0; i < ROTATIONS.size(); i++) {
+                planOuts->push_back(newCiphertext(f.params, 1, maxLevel(f.params)));
+            }
+        };
+        suite.add("evaluator", "decompose", [plan](Fixture &f) { decompose(*plan, f.ct0); }).prepare = decomposedPlan;
+        suite.add("evaluator", "rotateHoisted(plan)", [plan](Fixture &f) {
+            rotateHoisted(*plan, 1, f.out);
+        }).prepare = decomposedPlan;
+        suite.add("evaluator", "rotateHoisted(plan batch)", [plan, planOuts](Fixture &) {
+            rotateHoisted(*plan, hoistedRotations(), *planOuts);
+        }).prepare = decomposedPlan;
+
+        suite.add("evaluator", "multByConst", [](Fixture &f) { multByConst(f.eval, f.ct0, 0.5, f.out); });
+        suite.add("evaluator", "addConst", [](Fixture &f) { addConst(f.eval, f.ct0, 0.5, f.out); });
+        suite.add("evaluator", "rescale", [](Fixture &f) {
+            rescale(f.eval, f.product, scale(f.params), f.out);
+        }).minLevels = 1;
+        suite.add("evaluator", "polyDepth", [](Fixture &) { polyDepth(POLY_DEGREE); });
+        vector<double> coeffs(POLY_DEGREE + 1);
+        for (uint64_t i = 0; i <= POLY_DEGREE; i++) {
+            coeffs[i] = 1.0 / (i + 1);
+        }
+        suite.add("evaluator", "evaluatePoly(monomial)", [coeffs](Fixture &f) {
+            evaluatePoly(f.eval, f.ct0, coeffs, PolyBasis::Monomial, scale(f.params));
+        }).minLevels = polyDepth(POLY_DEGREE);
+        // mapping the input from the interval to [-1, 1] takes one more level
+        suite.add("evaluator", "evaluatePoly(chebyshev)", [coeffs](Fixture &f) {
+            evaluatePoly(f.eval, f.ct0, coeffs, PolyBasis::Chebyshev, scale(f.params), {-2, 2});
+        }).minLevels = polyDepth(POLY_DEGREE, PolyBasis::Chebyshev, {-2, 2});
+        suite.add("evaluator", "evaluateChebyshev", [](Fixture &f) {
+            evaluateChebyshev(f.eval, f.ct0, [](double x) { return tanh(x); }, {-2, 2}, CHEBYSHEV_DEGREE);
+        }).minLevels = polyDepth(CHEBYSHEV_DEGREE, PolyBasis::Chebyshev, {-2, 2});
+
+        suite.add("evaluator", "mulRelinNew", [](Fixture &f) { mulRelinNew(f.eval, f.ct0, f.ct1); });
+        suite.add("evaluator", "mulRelin", [](Fixture &f) { mulRelin(f.eval, f.ct0, f.ct1, f.out); });
+        // a degree 2 output for mul, and a degree 2 input for relinearize
+        auto quadratic = make_shared<Ciphertext>();
+        suite.add("evaluator", "mul", [quadratic](Fixture &f) {
+            mul(f.eval, f.ct0, f.ct1, *quadratic);
+        }).prepare = [quadratic](Fixture &f) { *quadratic = newCiphertext(f.params, 2, maxLevel(f.params)); };
+        suite.add("evaluator", "relinearize", [quadratic](Fixture &f) {
+            relinearize(f.eval, *quadratic, f.out);
+        }).prepare = [quadratic](Fixture &f) {
+            *quadratic = newCiphertext(f.params, 2, maxLevel(f.params));
+            mul(f.eval, f.ct0, f.ct1, *quadratic);
+        };
+        suite.add("evaluator", "mulPlain", [](Fixture &f) { mulPlain(f.eval, f.ct0, f.pt, f.out); });
+        suite.add("evaluator", "add", [](Fixture &f) { add(f.eval, f.ct0, f.ct1, f.out); });
+        suite.add("evaluator", "addPlain", [](Fixture &f) { addPlain(f.eval, f.ct0, f.pt, f.out); });
+        suite.add("evaluator", "neg", [](Fixture &f) { neg(f.eval, f.ct0, f.out); });
+        suite.add("evaluator", "sub", [](Fixture &f) { sub(f.eval, f.ct0, f.ct1, f.out); });
+        suite.add("evaluator", "subPlain", [](Fixture &f) { subPlain(f.eval, f.ct0, f.pt, f.out); });
+        // accumulates into `out`, which must have the scale of the input
+        suite.add("evaluator", "multByGaussianIntegerAndAdd", [](Fixture &f) {
+            multByGaussianIntegerAndAdd(f.eval, f.ct0, 1, 1, f.out);
+        }).prepare = [](Fixture &f) { f.out = copyNew(f.ct1); };
+        // drops a level of a fresh copy of ct0 each time
+        Benchmark &drop = suite.add("evaluator", "dropLevel", [](Fixture &f) { dropLevel(f.eval, f.out, 1); });
+        drop.setup = [](Fixture &f) { f.out = copyNew(f.ct0); };
+        drop.minLevels = 1;
+
+        suite.add("evaluator", "addBatch", [](Fixture &f) { addBatch(f.eval, f.cts0, f.cts1, f.outs); });
+        suite.add("evaluator", "mulRelinBatch", [](Fixture &f) { mulRelinBatch(f.eval, f.cts0, f.cts1, f.outs); });
+        suite.add("evaluator", "multByConstBatch", [](Fixture &f) { multByConstBatch(f.eval, f.cts0, 0.5, f.outs); });
+        suite.add("evaluator", "rotateBatch", [](Fixture &f) { rotateBatch(f.eval, f.cts0, 1, f.outs); });
+        suite.add("evaluator", "rescaleBatch", [](Fixture &f) {
+            rescaleBatch(f.eval, f.products, scale(f.params), f.outs);
+        }).minLevels = 1;
+        suite.add("evaluator", "addBatchAsync", [](Fixture &f) {
+            addBatchAsync(f.eval, f.cts0, f.cts1, f.outs).get();
+        });
+        suite.add("evaluator", "mulRelinBatchAsync", [](Fixture &f) {
+            mulRelinBatchAsync(f.eval, f.cts0, f.cts1, f.outs).get();
+        });
+        suite.add("evaluator", "multByConstBatchAsync", [](Fixture &f) {
+            multByConstBatchAsync(f.eval, f.cts0, 0.5, f.outs).get();
+        });
+        suite.add("evaluator", "rotateBatchAsync", [](Fixture &f) {
+            rotateBatchAsync(f.eval, f.cts0, 1, f.outs).get();
+        });
+        suite.add("evaluator", "rescaleBatchAsync", [](Fixture &f) {
+            rescaleBatchAsync(f.eval, f.products, scale(f.params), f.outs).get();
+        }).minLevels = 1;
+
+        suite.add("evaluator", "switchKeys", [](Fixture &f) { switchKeys(f.eval, f.ct0, f.swk, f.out); });
+    }
+
+}  // namespace suite
@@ -0,0 +1,253 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "harness.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+
+namespace suite {
+
+    // Stop timing a benchmark after this many calls, even if the minimum time has not been reached
+    const uint64_t MAX_ITERATIONS = 100000;
+
+    const vector<Preset> &allPresets() {
+        static const vector<Preset> presets = []() {
+            vector<Preset> p;
+            const pair<const char *, NamedClassicalParams> classical[] = {
+                {"PN12QP109", PN12QP109}, {"PN13QP218", PN13QP218}, {"PN14QP438", PN14QP438},
+                {"PN15QP880", PN15QP880}, {"PN16QP1761", PN16QP1761}};
+            for (const auto &c : classical) {
+                NamedClassicalParams id = c.second;
+                p.push_back({c.first, [id]() { return getDefaultClassicalParams(id); }});
+            }
+            const pair<const char *, NamedPQParams> pq[] = {
+                {"PN12QP101pq", PN12QP101pq}, {"PN13QP202pq", PN13QP202pq}, {"PN14QP411pq", PN14QP411pq},
+                {"PN15QP827pq", PN15QP827pq}, {"PN16QP1654pq", PN16QP1654pq}};
+            for (const auto &c : pq) {
+                NamedPQParams id = c.second;
+                p.push_back({c.first, [id]() { return getDefaultPQParams(id); }});
+            }
+            const pair<const char *, NamedBootstrappingParams> btp[] = {
+                {"N16QP1767H32768H32", N16QP1767H32768H32}, {"N16QP1788H32768H32", N16QP1788H32768H32},
+                {"N16QP1793H32768H32", N16QP1793H32768H32}, {"N15QP880H16384H32", N15QP880H16384H32}};
+            for (const auto &c : btp) {
+                NamedBootstrappingParams id = c.second;
+                p.push_back({c.first, [id]() { return genParams(id); }, true, id});
+            }
+            return p;
+        }();
+        return presets;
+    }
+
+    Fixture::Fixture(const Preset &preset)
+        : name(preset.name), params(preset.params()), bootstrappable(preset.bootstrappable) {
+        kgen = newKeyGenerator(params);
+        KeyPairHandle kp;
+        if (bootstrappable) {
+            btpParams = getBootstrappingParams(preset.bootstrapping);
+            kp = genKeyPairSparse(kgen, ephemeralSecretWeight(btpParams));
+        } else {
+            kp = genKeyPair(kgen);
+        }
+        sk = kp.sk;
+        pk = kp.pk;
+        rlk = genRelinKey(kgen, sk);
+        rotKeys = genRotationKeysForRotations(kgen, sk, ROTATIONS);
+        swk = getSwitchingKey(rotKeys, galoisElementForColumnRotationBy(params, 1));
+        evalKey = makeEvaluationKey(rlk, rotKeys);
+        eval = newEvaluator(params, evalKey);
+        encoder = newEncoder(params);
+        encryptor = newEncryptor(params, pk);
+        skEncryptor = newEncryptor(params, sk);
+        decryptor = newDecryptor(params, sk);
+
+        uint64_t slots = numSlots(params);
+        for (uint64_t i = 0; i < slots; i++) {
+            double x = double(i) / slots - 0.5;
+            values.push_back(x);
+            complexValues.emplace_back(x, 0.5 - x);
+        }
+        rows.assign(BATCH_SIZE, values);
+
+        pt = encodeNew(encoder, values, maxLevel(params), scale(params));
+        ct0 = encryptNew(encryptor, pt);
+        ct1 = encryptNew(encryptor, encodeNew(encoder, complexValues, maxLevel(params), scale(params)));
+        product = mulRelinNew(eval, ct0, ct1);
+        for (size_t i = 0; i < BATCH_SIZE; i++) {
+            pts.push_back(pt);
+            cts0.push_back(copyNew(ct0));
+            cts1.push_back(copyNew(ct1));
+            products.push_back(copyNew(product));
+        }
+        resetOutputs();
+    }
+
+    void Fixture::ensureBootstrapper() {
+        if (btp.getRawHandle() != 0) {
+            return;
+        }
+        // the bootstrapping key holds its own rotation keys
+        RotationKeys noRotations = genRotationKeysForRotations(kgen, sk, vector<int>());
+        btpKey = genBootstrappingKey(kgen, params, btpParams, sk, rlk, noRotations);
+        btp = newBootstrapper(params, btpParams, btpKey);
+    }
+
+    void Fixture::resetOutputs() {
+        out = newCiphertext(params, 1, maxLevel(params));
+        outs.clear();
+        for (size_t i = 0; i < BATCH_SIZE; i++) {
+            outs.push_back(newCiphertext(params, 1, maxLevel(params)));
+        }
+    }
+
+    Benchmark &Suite::add(const string &group, const string &name, function<void(Fixture &)> run) {
+        Benchmark b;
+        b.group = group;
+        b.name = name;
+        b.run = move(run);
+        benchmarks.push_back(move(b));
+        return benchmarks.back();
+    }
+
+    Result measure(Fixture &fixture, const Benchmark &benchmark, double minSeconds) {
+        using clock = chrono::steady_clock;
+        auto timeOnce = [&]() {
+            if (benchmark.setup) {
+                benchmark.setup(fixture);
+            }
+            clock::time_point start = clock::now();
+            benchmark.run(fixture);
+            return chrono::duration<double, nano>(clock::now() - start).count();
+        };
+
+        vector<double> samples;
+        double first = timeOnce();
+        double minNs = minSeconds * 1e9;
+        if (first >= minNs) {
+            samples.push_back(first);
+        } else {
+            double total = 0;
+            while (total < minNs && samples.size() < MAX_ITERATIONS) {
+                samples.push_back(timeOnce());
+                total += samples.back();
+            }
+        }
+
+        Result r;
+        r.params = fixture.name;
+        r.group = benchmark.group;
+        r.name = benchmark.name;
+        r.iterations = samples.size();
+        r.meanNs = accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+        double squares = 0;
+        for (double s : samples) {
+            squares += (s - r.meanNs) * (s - r.meanNs);
+        }
+        r.stddevNs = sqrt(squares / samples.size());
+        sort(samples.begin(), samples.end());
+        size_t mid = samples.size() / 2;
+        r.medianNs = samples.size() % 2 == 1 ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2;
+        r.minNs = samples.front();
+        return r;
+    }
+
+    const char *const CSV_HEADER = "params,group,name,iterations,mean_ns,median_ns,min_ns,stddev_ns,baseline_median_ns,ratio";
+
+    static double ratio(const Result &r) {
+        return r.baselineMedianNs > 0 ? r.medianNs / r.baselineMedianNs : 0;
+    }
+
+    vector<Result> readCsv(istream &in) {
+        vector<Result> results;
+        string line;
+        while (getline(in, line)) {
+            if (line.empty() || line == CSV_HEADER) {
+                continue;
+            }
+            vector<string> fields;
+            istringstream cells(line);
+            string cell;
+            while (getline(cells, cell, ',')) {
+                fields.push_back(cell);
+            }
+            if (fields.size() < 8) {
+                throw invalid_argument("malformed benchmark results line: " + line);
+            }
+            Result r;
+            r.params = fields[0];
+            r.group = fields[1];
+            r.name = fields[2];
+            r.iterations = stoull(fields[3]);
+            r.meanNs = stod(fields[4]);
+            r.medianNs = stod(fields[5]);
+            r.minNs = stod(fields[6]);
+            r.stddevNs = stod(fields[7]);
+            results.push_back(r);
+        }
+        return results;
+    }
+
+    void writeTable(ostream &out, const vector<Result> &results) {
+        size_t width = 9;
+        bool baseline = false;
+        for (const Result &r : results) {
+            width = max(width, r.params.size() + r.group.size() + r.name.size() + 2);
+            baseline = baseline || r.baselineMedianNs > 0;
+        }
+        out << left << setw(width) << "benchmark" << right << setw(12) << "iterations" << setw(16) << "median (us)"
+            << setw(16) << "mean (us)" << setw(16) << "stddev (us)";
+        if (baseline) {
+            out << setw(16) << "baseline (us)" << setw(10) << "ratio";
+        }
+        out << "\n" << fixed << setprecision(3);
+        for (const Result &r : results) {
+            out << left << setw(width) << r.params + "/" + r.group + "/" + r.name << right << setw(12)
+                << r.iterations << setw(16) << r.medianNs / 1e3 << setw(16) << r.meanNs / 1e3 << setw(16)
+                << r.stddevNs / 1e3;
+            if (baseline) {
+                if (r.baselineMedianNs > 0) {
+                    out << setw(16) << r.baselineMedianNs / 1e3 << setw(10) << ratio(r);
+                } else {
+                    out << setw(16) << "-" << setw(10) << "-";
+                }
+            }
+            out << "\n";
+        }
+        out << defaultfloat;
+    }
+
+    void writeCsv(ostream &out, const vector<Result> &results) {
+        out << CSV_HEADER << "\n" << setprecision(9);
+        for (const Result &r : results) {
+            out << r.params << "," << r.group << "," << r.name << "," << r.iterations << "," << r.meanNs << ","
+                << r.medianNs << "," << r.minNs << "," << r.stddevNs << "," << r.baselineMedianNs << ","
+                << ratio(r) << "\n";
+        }
+    }
+
+    // Benchmark names contain parentheses and spaces but no characters which need escaping
+    void writeJson(ostream &out, const vector<Result> &results) {
+        out << "{\"benchmarks\":[" << setprecision(9);
+        for (size_t i = 0; i < results.size(); i++) {
+            const Result &r = results[i];
+            out << (i > 0 ? "," : "") << "\n  {\"params\":\"" << r.params << "\",\"group\":\"" << r.group
+                << "\",\"name\":\"" << r.name << "\",\"iterations\":" << r.iterations
+                << ",\"mean_ns\":" << r.meanNs << ",\"median_ns\":" << r.medianNs << ",\"min_ns\":" << r.minNs
+                << ",\"stddev_ns\":" << r.stddevNs;
+            if (r.baselineMedianNs > 0) {
+                out << ",\"baseline_median_ns\":" << r.baselineMedianNs << ",\"ratio\":" << ratio(r);
+            }
+            out << "}";
+        }
+        out << "\n]}\n";
+    }
+
+}  // namespace suite
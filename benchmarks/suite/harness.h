@@ -0,0 +1,138 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// The latticpp_bench microbenchmark suite: benchmarks of the public API, run against each
+// selected parameter preset and reported as a table, CSV or JSON.
+
+#pragma once
+
+#include "latticpp/latticpp.h"
+
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace suite {
+
+    using namespace latticpp;
+
+    // Number of ciphertexts or plaintexts passed to the batch APIs
+    const size_t BATCH_SIZE = 8;
+
+    // Rotations with keys in every fixture
+    const std::vector<int> ROTATIONS = {1, 2, 3, 4, 8, 16};
+
+    struct Preset {
+        std::string name;
+        std::function<Parameters()> params;
+        bool bootstrappable = false;
+        NamedBootstrappingParams bootstrapping = N15QP880H16384H32;
+    };
+
+    // Every NamedClassicalParams, NamedPQParams and NamedBootstrappingParams preset
+    const std::vector<Preset> &allPresets();
+
+    // Keys and inputs for one preset, shared by all benchmarks run against it. Benchmarks may
+    // overwrite `out` and `outs`, but must leave everything else as they found it.
+    struct Fixture {
+        explicit Fixture(const Preset &preset);
+
+        // Generate the bootstrapping key and bootstrapper on first use, which takes a while
+        void ensureBootstrapper();
+
+        // Replace `out` and `outs` with fresh degree 1 ciphertexts at the top level
+        void resetOutputs();
+
+        std::string name;
+        Parameters params;
+        bool bootstrappable;
+        BootstrappingParameters btpParams;
+
+        KeyGenerator kgen;
+        SecretKey sk;
+        PublicKey pk;
+        RelinearizationKey rlk;
+        RotationKeys rotKeys;
+        // the switching key for a rotation by one slot
+        SwitchingKey swk;
+        EvaluationKey evalKey;
+        Evaluator eval;
+        Encoder encoder;
+        Encryptor encryptor;
+        Encryptor skEncryptor;
+        Decryptor decryptor;
+
+        std::vector<double> values;
+        std::vector<std::complex<double>> complexValues;
+        // BATCH_SIZE copies of values
+        std::vector<std::vector<double>> rows;
+        Plaintext pt;
+        // fresh encryptions at the top level
+        Ciphertext ct0, ct1;
+        // ct0 * ct1, relinearized but not rescaled
+        Ciphertext product;
+        // BATCH_SIZE copies of pt, ct0, ct1 and product
+        std::vector<Plaintext> pts;
+        std::vector<Ciphertext> cts0, cts1, products;
+        Ciphertext out;
+        std::vector<Ciphertext> outs;
+
+        BootstrappingKey btpKey;
+        Bootstrapper btp;
+    };
+
+    struct Benchmark {
+        std::string group;
+        std::string name;
+        // Untimed; run once per fixture before the benchmark, after Fixture::resetOutputs
+        std::function<void(Fixture &)> prepare;
+        // Untimed; run before each timed call
+        std::function<void(Fixture &)> setup;
+        std::function<void(Fixture &)> run;
+        // Minimum number of levels the preset must have
+        uint64_t minLevels = 0;
+        // Only run for bootstrapping presets
+        bool needsBootstrapping = false;
+    };
+
+    class Suite {
+    public:
+        Benchmark &add(const std::string &group, const std::string &name, std::function<void(Fixture &)> run);
+
+        std::vector<Benchmark> benchmarks;
+    };
+
+    void addEncodingBenchmarks(Suite &suite);
+    void addEvaluatorBenchmarks(Suite &suite);
+    void addKeygenBenchmarks(Suite &suite);
+    void addMarshalerBenchmarks(Suite &suite);
+    void addBootstrapBenchmarks(Suite &suite);
+
+    struct Result {
+        std::string params;
+        std::string group;
+        std::string name;
+        uint64_t iterations;
+        double meanNs;
+        double medianNs;
+        double minNs;
+        double stddevNs;
+        // median of the same benchmark in the baseline, or 0 if it has none
+        double baselineMedianNs = 0;
+    };
+
+    // Time `benchmark` until `minSeconds` have been spent in it (at least one call). A first
+    // call faster than `minSeconds` is treated as a warm-up and not recorded.
+    Result measure(Fixture &fixture, const Benchmark &benchmark, double minSeconds);
+
+    // Results previously written with writeCsv
+    std::vector<Result> readCsv(std::istream &in);
+
+    void writeTable(std::ostream &out, const std::vector<Result> &results);
+    void writeCsv(std::ostream &out, const std::vector<Result> &results);
+    void writeJson(std::ostream &out, const std::vector<Result> &results);
+
+}  // namespace suite
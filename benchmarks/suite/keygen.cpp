@@ -0,0 +1,100 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Benchmarks of keygen.h
+
+#include "harness.h"
+
+#include <memory>
+
+using namespace std;
+
+namespace suite {
+
+    // Hamming weight of the sparse keys generated for presets without bootstrapping parameters
+    const uint64_t SPARSE_WEIGHT = 192;
+
+    static uint64_t rotationByOne(Fixture &f) {
+        return galoisElementForColumnRotationBy(f.params, 1);
+    }
+
+    void addKeygenBenchmarks(Suite &suite) {
+        suite.add("keygen", "newKeyGenerator", [](Fixture &f) { newKeyGenerator(f.params); });
+        suite.add("keygen", "galoisElementForColumnRotationBy", [](Fixture &f) { rotationByOne(f); });
+        suite.add("keygen", "getSwitchingKey", [](Fixture &f) { getSwitchingKey(f.rotKeys, rotationByOne(f)); });
+        // puts back the key which is already there
+        suite.add("keygen", "setSwitchingKey", [](Fixture &f) { setSwitchingKey(f.rotKeys, f.swk, rotationByOne(f)); });
+        suite.add("keygen", "switchingKeyExist", [](Fixture &f) { switchingKeyExist(f.rotKeys, rotationByOne(f)); });
+        suite.add("keygen", "getGaloisElementsOfRotationKeys", [](Fixture &f) {
+            getGaloisElementsOfRotationKeys(f.rotKeys);
+        });
+        suite.add("keygen", "copyNew(SwitchingKey)", [](Fixture &f) { copyNew(f.swk); });
+        suite.add("keygen", "numOfDecomp", [](Fixture &f) { numOfDecomp(f.swk); });
+        suite.add("keygen", "switchingKeyIsCorrect", [](Fixture &f) {
+            switchingKeyIsCorrect(f.swk, rotationByOne(f), f.sk, f.params, 64);
+        });
+        suite.add("keygen", "getCiphertextQP", [](Fixture &f) { getCiphertextQP(f.swk, 0, 0); });
+        // writes into a copy, so that the fixture's rotation keys are left alone
+        auto swk = make_shared<SwitchingKey>();
+        auto ctQP = make_shared<CiphertextQP>();
+        suite.add("keygen", "setCiphertextQP", [swk, ctQP](Fixture &) {
+            setCiphertextQP(*swk, *ctQP, 0, 0);
+        }).prepare = [swk, ctQP](Fixture &f) {
+            *swk = copyNew(f.swk);
+            *ctQP = copyNew(getCiphertextQP(f.swk, 0, 0));
+        };
+        suite.add("keygen", "newSwitchingKey", [](Fixture &f) {
+            newSwitchingKey(f.params, maxLevel(f.params), piCount(f.params) - 1);
+        });
+
+        suite.add("keygen", "newSecretKey", [](Fixture &f) { newSecretKey(f.params); });
+        suite.add("keygen", "copyNewSecretKey", [](Fixture &f) { copyNewSecretKey(f.sk); });
+        suite.add("keygen", "polyQP", [](Fixture &f) { polyQP(f.sk); });
+        suite.add("keygen", "newPublicKey", [](Fixture &f) { newPublicKey(f.params); });
+        suite.add("keygen", "newRelinearizationKey", [](Fixture &f) { newRelinearizationKey(f.params); });
+        suite.add("keygen", "newRotationKeys", [](Fixture &f) {
+            newRotationKeys(f.params, getGaloisElementsOfRotationKeys(f.rotKeys));
+        });
+
+        suite.add("keygen", "genSecretKey", [](Fixture &f) { genSecretKey(f.kgen); });
+        suite.add("keygen", "genPublicKey", [](Fixture &f) { genPublicKey(f.kgen, f.sk); });
+        suite.add("keygen", "genKeyPair", [](Fixture &f) { genKeyPair(f.kgen); });
+        suite.add("keygen", "genKeyPairSparse", [](Fixture &f) {
+            genKeyPairSparse(f.kgen, f.bootstrappable ? ephemeralSecretWeight(f.btpParams) : SPARSE_WEIGHT);
+        });
+        suite.add("keygen", "genRelinKey", [](Fixture &f) { genRelinKey(f.kgen, f.sk); });
+        suite.add("keygen", "genRotationKeysForRotations", [](Fixture &f) {
+            genRotationKeysForRotations(f.kgen, f.sk, {1});
+        });
+        suite.add("keygen", "genRotationKeysForRotationsAsync", [](Fixture &f) {
+            genRotationKeysForRotationsAsync(f.kgen, f.sk, {1}).get();
+        });
+
+        suite.add("keygen", "makeEvaluationKey(relin)", [](Fixture &f) { makeEvaluationKey(f.rlk); });
+        suite.add("keygen", "makeEvaluationKey(relin rotations)", [](Fixture &f) {
+            makeEvaluationKey(f.rlk, f.rotKeys);
+        });
+        suite.add("keygen", "makeEmptyEvaluationKey", [](Fixture &) { makeEmptyEvaluationKey(); });
+        auto evalKey = make_shared<EvaluationKey>();
+        auto emptyEvaluationKey = [evalKey](Fixture &) { *evalKey = makeEmptyEvaluationKey(); };
+        suite.add("keygen", "setRelinKeyForEvaluationKey", [evalKey](Fixture &f) {
+            setRelinKeyForEvaluationKey(*evalKey, f.rlk);
+        }).prepare = emptyEvaluationKey;
+        suite.add("keygen", "setRotKeysForEvaluationKey", [evalKey](Fixture &f) {
+            setRotKeysForEvaluationKey(*evalKey, f.rotKeys);
+        }).prepare = emptyEvaluationKey;
+
+        auto noRotations = make_shared<RotationKeys>();
+        Benchmark &btpKey = suite.add("keygen", "genBootstrappingKey", [noRotations](Fixture &f) {
+            genBootstrappingKey(f.kgen, f.params, f.btpParams, f.sk, f.rlk, *noRotations);
+        });
+        btpKey.prepare = [noRotations](Fixture &f) {
+            *noRotations = genRotationKeysForRotations(f.kgen, f.sk, vector<int>());
+        };
+        btpKey.needsBootstrapping = true;
+        suite.add("keygen", "genBootstrappingKeyAsync", [](Fixture &f) {
+            genBootstrappingKeyAsync(f.params, f.btpParams, f.sk).get();
+        }).needsBootstrapping = true;
+    }
+
+}  // namespace suite
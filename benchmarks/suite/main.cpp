@@ -0,0 +1,165 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Microbenchmarks of the public API in evaluator.h, encoder.h, encryptor.h, decryptor.h,
+// marshaler.h, keygen.h and bootstrap.h, run against parameter presets. Usage:
+//   latticpp_bench [--params=PN14QP438,...|all] [--filter=substring] [--min-time=seconds]
+//                  [--format=table|csv|json] [--out=file] [--baseline=results.csv] [--list]
+//
+// To compare two commits, save the results of one with --format=csv --out=base.csv, then run
+// the other with --baseline=base.csv: each result gains the median of the same benchmark in
+// the baseline and the ratio of the two medians. Progress is written to stderr.
+
+#include "harness.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+using namespace suite;
+
+const char *const DEFAULT_PRESETS = "PN14QP438,PN14QP411pq,N15QP880H16384H32";
+
+// Parse `arg` as --name=value
+bool option(const string &arg, const string &name, string &value) {
+    string prefix = "--" + name + "=";
+    if (arg.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    value = arg.substr(prefix.size());
+    return true;
+}
+
+vector<Preset> selectPresets(const string &names) {
+    if (names == "all") {
+        return allPresets();
+    }
+    vector<Preset> selected;
+    istringstream list(names);
+    string name;
+    while (getline(list, name, ',')) {
+        auto preset = find_if(allPresets().begin(), allPresets().end(),
+                              [&](const Preset &p) { return p.name == name; });
+        if (preset == allPresets().end()) {
+            throw invalid_argument("unknown parameter preset " + name);
+        }
+        selected.push_back(*preset);
+    }
+    return selected;
+}
+
+int main(int argc, char **argv) {
+    string presets = DEFAULT_PRESETS;
+    string filter;
+    string format = "table";
+    string outPath;
+    string baselinePath;
+    double minSeconds = 0.5;
+    bool list = false;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        string value;
+        if (option(arg, "params", value)) {
+            presets = value;
+        } else if (option(arg, "filter", value)) {
+            filter = value;
+        } else if (option(arg, "min-time", value)) {
+            minSeconds = stod(value);
+        } else if (option(arg, "format", value) && (value == "table" || value == "csv" || value == "json")) {
+            format = value;
+        } else if (option(arg, "out", value)) {
+            outPath = value;
+        } else if (option(arg, "baseline", value)) {
+            baselinePath = value;
+        } else if (arg == "--list") {
+            list = true;
+        } else {
+            cerr << "unknown argument " << arg << endl;
+            return 1;
+        }
+    }
+
+    Suite suite;
+    addEncodingBenchmarks(suite);
+    addEvaluatorBenchmarks(suite);
+    addKeygenBenchmarks(suite);
+    addMarshalerBenchmarks(suite);
+    addBootstrapBenchmarks(suite);
+
+    vector<const Benchmark *> selected;
+    for (const Benchmark &b : suite.benchmarks) {
+        if ((b.group + "/" + b.name).find(filter) != string::npos) {
+            selected.push_back(&b);
+        }
+    }
+    if (list) {
+        for (const Benchmark *b : selected) {
+            cout << b->group << "/" << b->name << (b->needsBootstrapping ? " (bootstrapping presets only)" : "")
+                 << endl;
+        }
+        return 0;
+    }
+
+    map<tuple<string, string, string>, double> baseline;
+    if (!baselinePath.empty()) {
+        ifstream in(baselinePath);
+        if (!in) {
+            cerr << "cannot open " << baselinePath << endl;
+            return 1;
+        }
+        for (const Result &r : readCsv(in)) {
+            baseline[make_tuple(r.params, r.group, r.name)] = r.medianNs;
+        }
+    }
+
+    vector<Result> results;
+    for (const Preset &preset : selectPresets(presets)) {
+        cerr << preset.name << ": generating keys" << endl;
+        Fixture fixture(preset);
+        for (const Benchmark *b : selected) {
+            if ((b->needsBootstrapping && !fixture.bootstrappable) || maxLevel(fixture.params) < b->minLevels) {
+                continue;
+            }
+            cerr << preset.name << "/" << b->group << "/" << b->name << endl;
+            try {
+                fixture.resetOutputs();
+                if (b->prepare) {
+                    b->prepare(fixture);
+                }
+                Result r = measure(fixture, *b, minSeconds);
+                auto base = baseline.find(make_tuple(r.params, r.group, r.name));
+                if (base != baseline.end()) {
+                    r.baselineMedianNs = base->second;
+                }
+                results.push_back(r);
+            } catch (const exception &e) {
+                cerr << "  skipped: " << e.what() << endl;
+            }
+        }
+    }
+
+    ofstream file;
+    if (!outPath.empty()) {
+        file.open(outPath);
+        if (!file) {
+            cerr << "cannot open " << outPath << endl;
+            return 1;
+        }
+    }
+    ostream &out = outPath.empty() ? cout : file;
+    if (format == "csv") {
+        writeCsv(out, results);
+    } else if (format == "json") {
+        writeJson(out, results);
+    } else {
+        writeTable(out, results);
+    }
+    return 0;
+}
@@ -0,0 +1,270 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Benchmarks of marshaler.h
+
+#include "harness.h"
+
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+
+using namespace std;
+
+namespace suite {
+
+    // marshalBinary<type> into a string stream, and unmarshalBinary<type> from one. `prepare`, if
+    // set, creates the object before it is serialized.
+    static void addStreamBenchmarks(Suite &suite, const string &type, function<void(Fixture &, ostream &)> marshal,
+                                    function<void(Fixture &, istream &)> unmarshal,
+                                    function<void(Fixture &)> prepare = nullptr, bool needsBootstrapping = false) {
+        Benchmark &write = suite.add("marshaler", "marshalBinary" + type, [marshal](Fixture &f) {
+            ostringstream stream;
+            marshal(f, stream);
+        });
+        write.prepare = prepare;
+        write.needsBootstrapping = needsBootstrapping;
+
+        auto bytes = make_shared<string>();
+        Benchmark &read = suite.add("marshaler", "unmarshalBinary" + type + "(stream)", [unmarshal, bytes](Fixture &f) {
+            istringstream stream(*bytes);
+            unmarshal(f, stream);
+        });
+        read.prepare = [marshal, prepare, bytes](Fixture &f) {
+            if (prepare) {
+                prepare(f);
+            }
+            ostringstream stream;
+            marshal(f, stream);
+            *bytes = stream.str();
+        };
+        read.needsBootstrapping = needsBootstrapping;
+    }
+
+    // marshalBinarySize, marshalInto and unmarshalBinary<type> from a buffer
+    template<typename T>
+    void addBufferBenchmarks(Suite &suite, const string &type, function<T &(Fixture &)> object,
+                             T (*unmarshal)(const void *, uint64_t), function<void(Fixture &)> prepare = nullptr,
+                             bool needsBootstrapping = false) {
+        auto buffer = make_shared<vector<uint8_t>>();
+        auto marshalled = [object, prepare, buffer](Fixture &f) {
+            if (prepare) {
+                prepare(f);
+            }
+            buffer->resize(marshalBinarySize(object(f)));
+            marshalInto(object(f), buffer->data(), buffer->size());
+        };
+
+        Benchmark &size = suite.add("marshaler", "marshalBinarySize(" + type + ")", [object](Fixture &f) {
+            marshalBinarySize(object(f));
+        });
+        size.prepare = prepare;
+        size.needsBootstrapping = needsBootstrapping;
+
+        Benchmark &into = suite.add("marshaler", "marshalInto(" + type + ")", [object, buffer](Fixture &f) {
+            marshalInto(object(f), buffer->data(), buffer->size());
+        });
+        into.prepare = marshalled;
+        into.needsBootstrapping = needsBootstrapping;
+
+        Benchmark &read = suite.add("marshaler", "unmarshalBinary" + type + "(buffer)", [unmarshal, buffer](Fixture &) {
+            unmarshal(buffer->data(), buffer->size());
+        });
+        read.prepare = marshalled;
+        read.needsBootstrapping = needsBootstrapping;
+    }
+
+    struct TempFile {
+        FILE *file = tmpfile();
+
+        ~TempFile() {
+            if (file != nullptr) {
+                fclose(file);
+            }
+        }
+
+        int fd() const {
+            return fileno(file);
+        }
+    };
+
+    // writeLengthPrefixed, and readLengthPrefixed from a string stream and from a file descriptor
+    template<typename T>
+    void addLengthPrefixedBenchmarks(Suite &suite, const string &type, function<T &(Fixture &)> object) {
+        suite.add("marshaler", "writeLengthPrefixed(" + type + ")", [object](Fixture &f) {
+            ostringstream stream;
+            writeLengthPrefixed(object(f), stream);
+        });
+
+        auto bytes = make_shared<string>();
+        auto file = make_shared<TempFile>();
+        auto written = [object, bytes, file](Fixture &f) {
+            ostringstream stream;
+            writeLengthPrefixed(object(f), stream);
+            *bytes = stream.str();
+            if (file->file == nullptr || ftruncate(file->fd(), 0) != 0 ||
+                pwrite(file->fd(), bytes->data(), bytes->size(), 0) != ssize_t(bytes->size())) {
+                throw runtime_error("cannot write a temporary file");
+            }
+        };
+        suite.add("marshaler", "readLengthPrefixed<" + type + ">(stream)", [bytes](Fixture &) {
+            istringstream stream(*bytes);
+            readLengthPrefixed<T>(stream);
+        }).prepare = written;
+        Benchmark &fromFd = suite.add("marshaler", "readLengthPrefixed<" + type + ">(fd)", [file](Fixture &) {
+            readLengthPrefixed<T>(file->fd());
+        });
+        fromFd.prepare = written;
+        fromFd.setup = [file](Fixture &) { lseek(file->fd(), 0, SEEK_SET); };
+    }
+
+    // Objects which only exist for some benchmarks
+    struct Objects {
+        Ciphertext seededCt;
+        PublicKey seededPk;
+        RelinearizationKey seededRlk;
+        RotationKeys seededRotKeys;
+        CKGShare ckgShare;
+        RKGShare rkgShare;
+        CKSShare cksShare;
+        RTGShare rtgShare;
+    };
+
+    void addMarshalerBenchmarks(Suite &suite) {
+        auto objects = make_shared<Objects>();
+
+        addStreamBenchmarks(suite, "Ciphertext",
+            [](Fixture &f, ostream &s) { marshalBinaryCiphertext(f.ct0, s); },
+            [](Fixture &, istream &s) { unmarshalBinaryCiphertext(s); });
+        addStreamBenchmarks(suite, "Parameters",
+            [](Fixture &f, ostream &s) { marshalBinaryParameters(f.params, s); },
+            [](Fixture &, istream &s) { unmarshalBinaryParameters(s); });
+        addStreamBenchmarks(suite, "BootstrapParameters",
+            [](Fixture &f, ostream &s) { marshalBinaryBootstrapParameters(f.btpParams, s); },
+            [](Fixture &, istream &s) { unmarshalBinaryBootstrapParameters(s); }, nullptr, true);
+        addStreamBenchmarks(suite, "SecretKey",
+            [](Fixture &f, ostream &s) { marshalBinarySecretKey(f.sk, s); },
+            [](Fixture &, istream &s) { unmarshalBinarySecretKey(s); });
+        addStreamBenchmarks(suite, "PublicKey",
+            [](Fixture &f, ostream &s) { marshalBinaryPublicKey(f.pk, s); },
+            [](Fixture &, istream &s) { unmarshalBinaryPublicKey(s); });
+        addStreamBenchmarks(suite, "RelinearizationKey",
+            [](Fixture &f, ostream &s) { marshalBinaryRelinearizationKey(f.rlk, s); },
+            [](Fixture &, istream &s) { unmarshalBinaryRelinearizationKey(s); });
+        addStreamBenchmarks(suite, "RotationKeys",
+            [](Fixture &f, ostream &s) { marshalBinaryRotationKeys(f.rotKeys, s); },
+            [](Fixture &, istream &s) { unmarshalBinaryRotationKeys(s); });
+        auto bootstrapper = [](Fixture &f) { f.ensureBootstrapper(); };
+        addStreamBenchmarks(suite, "BootstrappingKey",
+            [](Fixture &f, ostream &s) { marshalBinaryBootstrappingKey(f.btpKey, s); },
+            [](Fixture &, istream &s) { unmarshalBinaryBootstrappingKey(s); }, bootstrapper, true);
+        suite.add("marshaler", "writeRotationKeyFile", [](Fixture &f) {
+            ostringstream stream;
+            writeRotationKeyFile(f.rotKeys, stream);
+        });
+
+        // seeded objects must be generated with seeded.h
+        addStreamBenchmarks(suite, "SeededCiphertext",
+            [objects](Fixture &, ostream &s) { marshalBinarySeededCiphertext(objects->seededCt, s); },
+            [](Fixture &f, istream &s) { unmarshalBinarySeededCiphertext(f.params, s); },
+            [objects](Fixture &f) { objects->seededCt = encryptSeededNew(f.params, f.skEncryptor, f.sk, f.pt); });
+        addStreamBenchmarks(suite, "SeededPublicKey",
+            [objects](Fixture &, ostream &s) { marshalBinarySeededPublicKey(objects->seededPk, s); },
+            [](Fixture &f, istream &s) { unmarshalBinarySeededPublicKey(f.params, s); },
+            [objects](Fixture &f) { objects->seededPk = genPublicKeySeeded(f.params, f.kgen, f.sk); });
+        addStreamBenchmarks(suite, "SeededRelinearizationKey",
+            [objects](Fixture &, ostream &s) { marshalBinarySeededRelinearizationKey(objects->seededRlk, s); },
+            [](Fixture &f, istream &s) { unmarshalBinarySeededRelinearizationKey(f.params, s); },
+            [objects](Fixture &f) { objects->seededRlk = genRelinKeySeeded(f.params, f.kgen, f.sk); });
+        addStreamBenchmarks(suite, "SeededRotationKeys",
+            [objects](Fixture &, ostream &s) { marshalBinarySeededRotationKeys(objects->seededRotKeys, s); },
+            [](Fixture &f, istream &s) { unmarshalBinarySeededRotationKeys(f.params, s); },
+            [objects](Fixture &f) {
+                objects->seededRotKeys = genRotationKeysForRotationsSeeded(f.params, f.kgen, f.sk, ROTATIONS);
+            });
+
+        addBufferBenchmarks<Ciphertext>(suite, "Ciphertext",
+            [](Fixture &f) -> Ciphertext & { return f.ct0; }, unmarshalBinaryCiphertext);
+        addBufferBenchmarks<Parameters>(suite, "Parameters",
+            [](Fixture &f) -> Parameters & { return f.params; }, unmarshalBinaryParameters);
+        addBufferBenchmarks<SecretKey>(suite, "SecretKey",
+            [](Fixture &f) -> SecretKey & { return f.sk; }, unmarshalBinarySecretKey);
+        addBufferBenchmarks<PublicKey>(suite, "PublicKey",
+            [](Fixture &f) -> PublicKey & { return f.pk; }, unmarshalBinaryPublicKey);
+        addBufferBenchmarks<RelinearizationKey>(suite, "RelinearizationKey",
+            [](Fixture &f) -> RelinearizationKey & { return f.rlk; }, unmarshalBinaryRelinearizationKey);
+        addBufferBenchmarks<RotationKeys>(suite, "RotationKeys",
+            [](Fixture &f) -> RotationKeys & { return f.rotKeys; }, unmarshalBinaryRotationKeys);
+        addBufferBenchmarks<Plaintext>(suite, "Plaintext",
+            [](Fixture &f) -> Plaintext & { return f.pt; }, unmarshalBinaryPlaintext);
+        addBufferBenchmarks<SwitchingKey>(suite, "SwitchingKey",
+            [](Fixture &f) -> SwitchingKey & { return f.swk; }, unmarshalBinarySwitchingKey);
+        addBufferBenchmarks<BootstrappingKey>(suite, "BootstrappingKey",
+            [](Fixture &f) -> BootstrappingKey & { return f.btpKey; }, unmarshalBinaryBootstrappingKey,
+            bootstrapper, true);
+        addBufferBenchmarks<CKGShare>(suite, "CKGShare",
+            [objects](Fixture &) -> CKGShare & { return objects->ckgShare; }, unmarshalBinaryCKGShare,
+            [objects](Fixture &f) { objects->ckgShare = ckgAllocateShare(newCKGProtocol(f.params)); });
+        addBufferBenchmarks<RKGShare>(suite, "RKGShare",
+            [objects](Fixture &) -> RKGShare & { return objects->rkgShare; }, unmarshalBinaryRKGShare,
+            [objects](Fixture &f) {
+                SecretKey ephSk = newSecretKey(f.params);
+                RKGShare second = newRKGShare();
+                objects->rkgShare = newRKGShare();
+                rkgAllocateShare(newRKGProtocol(f.params), ephSk, objects->rkgShare, second);
+            });
+        addBufferBenchmarks<CKSShare>(suite, "CKSShare",
+            [objects](Fixture &) -> CKSShare & { return objects->cksShare; }, unmarshalBinaryCKSShare,
+            [objects](Fixture &f) {
+                objects->cksShare = cksAllocateShare(newCKSProtocol(f.params, sigma(f.params)), maxLevel(f.params));
+            });
+        addBufferBenchmarks<RTGShare>(suite, "RTGShare",
+            [objects](Fixture &) -> RTGShare & { return objects->rtgShare; }, unmarshalBinaryRTGShare,
+            [objects](Fixture &f) { objects->rtgShare = rtgAllocateShare(newRTGProtocol(f.params)); });
+
+        addLengthPrefixedBenchmarks<Ciphertext>(suite, "Ciphertext", [](Fixture &f) -> Ciphertext & { return f.ct0; });
+        addLengthPrefixedBenchmarks<Parameters>(suite, "Parameters", [](Fixture &f) -> Parameters & { return f.params; });
+        addLengthPrefixedBenchmarks<SecretKey>(suite, "SecretKey", [](Fixture &f) -> SecretKey & { return f.sk; });
+        addLengthPrefixedBenchmarks<PublicKey>(suite, "PublicKey", [](Fixture &f) -> PublicKey & { return f.pk; });
+        addLengthPrefixedBenchmarks<RelinearizationKey>(suite, "RelinearizationKey",
+            [](Fixture &f) -> RelinearizationKey & { return f.rlk; });
+        addLengthPrefixedBenchmarks<RotationKeys>(suite, "RotationKeys",
+            [](Fixture &f) -> RotationKeys & { return f.rotKeys; });
+
+        // the packed format, at full precision and truncated to level 0
+        for (uint64_t maxLevel : {KEEP_LEVEL, uint64_t(0)}) {
+            string variant = maxLevel == KEEP_LEVEL ? "" : "(level 0)";
+            suite.add("marshaler", "marshalBinarySizePacked" + variant, [maxLevel](Fixture &f) {
+                marshalBinarySizePacked(f.params, f.ct0, maxLevel);
+            });
+            suite.add("marshaler", "marshalBinaryPackedCiphertext" + variant, [maxLevel](Fixture &f) {
+                ostringstream stream;
+                marshalBinaryPackedCiphertext(f.params, f.ct0, stream, maxLevel);
+            });
+            auto bytes = make_shared<string>();
+            auto packed = [maxLevel, bytes](Fixture &f) {
+                bytes->resize(marshalBinarySizePacked(f.params, f.ct0, maxLevel));
+                marshalIntoPacked(f.params, f.ct0, &(*bytes)[0], bytes->size(), maxLevel);
+            };
+            suite.add("marshaler", "marshalIntoPacked" + variant, [maxLevel, bytes](Fixture &f) {
+                marshalIntoPacked(f.params, f.ct0, &(*bytes)[0], bytes->size(), maxLevel);
+            }).prepare = packed;
+            // the stream form is length-prefixed, unlike the buffer form
+            auto streamed = make_shared<string>();
+            suite.add("marshaler", "unmarshalBinaryPackedCiphertext(stream)" + variant, [streamed](Fixture &f) {
+                istringstream stream(*streamed);
+                unmarshalBinaryPackedCiphertext(f.params, stream);
+            }).prepare = [maxLevel, streamed](Fixture &f) {
+                ostringstream stream;
+                marshalBinaryPackedCiphertext(f.params, f.ct0, stream, maxLevel);
+                *streamed = stream.str();
+            };
+            suite.add("marshaler", "unmarshalBinaryPackedCiphertext(buffer)" + variant, [bytes](Fixture &f) {
+                unmarshalBinaryPackedCiphertext(f.params, bytes->data(), bytes->size());
+            }).prepare = packed;
+        }
+    }
+
+}  // namespace suite
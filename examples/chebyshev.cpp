@@ -0,0 +1,97 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Evaluates Chebyshev polynomials on inputs in [0, 8], which evaluatePoly has to map to
+// [-1, 1] before Lattigo evaluates the polynomial, and checks the decrypted results against
+// the same functions computed in the clear. Also checks an interval, [0, 2], whose map to
+// [-1, 1] multiplies by an integer and so consumes no extra level. Exits with status 1 if any
+// check fails.
+
+#include "latticpp/latticpp.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace latticpp;
+
+const pair<double, double> INTERVAL = {0, 8};
+
+// Decrypt `ct` and compare it with f applied to `values`, printing the largest error
+bool check(const string &name, const Parameters &params, const Encoder &encoder, const Decryptor &decryptor,
+           const Ciphertext &ct, uint64_t levelsConsumed, uint64_t levelsExpected, const vector<double> &values,
+           const function<double(double)> &f, double tolerance) {
+  vector<double> result = decode(encoder, decryptNew(decryptor, ct), logSlots(params));
+  double maxError = 0;
+  for (size_t i = 0; i < values.size(); i++) {
+    maxError = max(maxError, abs(result[i] - f(values[i])));
+  }
+  bool ok = maxError <= tolerance && levelsConsumed == levelsExpected;
+  cout << name << ": max error " << maxError << " (tolerance " << tolerance << "), " << levelsConsumed
+       << " levels consumed (expected " << levelsExpected << ")" << (ok ? "" : "  FAILED") << endl;
+  return ok;
+}
+
+int main() {
+  Parameters params = getDefaultClassicalParams(PN14QP438);
+  KeyGenerator kgen = newKeyGenerator(params);
+  SecretKey sk = genSecretKey(kgen);
+  RelinearizationKey rlk = genRelinKey(kgen, sk);
+  Encryptor encryptor = newEncryptor(params, sk);
+  Decryptor decryptor = newDecryptor(params, sk);
+  Encoder encoder = newEncoder(params);
+  Evaluator evaluator = newEvaluator(params, makeEvaluationKey(rlk));
+
+  // inputs spread evenly over the interval, including both ends
+  uint64_t slots = numSlots(params);
+  vector<double> values(slots);
+  for (uint64_t i = 0; i < slots; i++) {
+    values[i] = INTERVAL.first + (INTERVAL.second - INTERVAL.first) * i / (slots - 1);
+  }
+  Ciphertext ct = encryptNew(encryptor, encodeNew(encoder, values, maxLevel(params), scale(params)));
+
+  bool ok = true;
+
+  // T_1 on [0, 8] is the map to [-1, 1] itself
+  uint64_t consumed;
+  Ciphertext t1 = evaluatePoly(evaluator, ct, {0, 1}, PolyBasis::Chebyshev, scale(params), INTERVAL, &consumed);
+  ok &= check("T_1", params, encoder, decryptor, t1, consumed, polyDepth(1, PolyBasis::Chebyshev, INTERVAL),
+              values, [](double x) { return (x - 4) / 4; }, 1e-4);
+
+  // 1 + 2 T_1 + 3 T_2, where T_2(t) = 2t^2 - 1
+  Ciphertext quadratic = evaluatePoly(evaluator, ct, {1, 2, 3}, PolyBasis::Chebyshev, scale(params), INTERVAL,
+                                      &consumed);
+  ok &= check("1 + 2 T_1 + 3 T_2", params, encoder, decryptor, quadratic, consumed,
+              polyDepth(2, PolyBasis::Chebyshev, INTERVAL), values, [](double x) {
+                double t = (x - 4) / 4;
+                return 1 + 2 * t + 3 * (2 * t * t - 1);
+              }, 1e-4);
+
+  // an interpolant, whose coefficients are computed for [0, 8]
+  const uint64_t degree = 15;
+  auto f = [](double x) { return log(1 + x); };
+  Ciphertext interpolated = evaluateChebyshev(evaluator, ct, f, INTERVAL, degree, &consumed);
+  ok &= check("log(1 + x)", params, encoder, decryptor, interpolated, consumed,
+              polyDepth(degree, PolyBasis::Chebyshev, INTERVAL), values, f, 1e-3);
+
+  // the same inputs scaled to [0, 2], where the map to [-1, 1] is x -> x - 1
+  const pair<double, double> unitWidth = {0, 2};
+  vector<double> scaled(slots);
+  for (uint64_t i = 0; i < slots; i++) {
+    scaled[i] = values[i] / 4;
+  }
+  Ciphertext ctScaled = encryptNew(encryptor, encodeNew(encoder, scaled, maxLevel(params), scale(params)));
+  Ciphertext unitQuadratic = evaluatePoly(evaluator, ctScaled, {1, 2, 3}, PolyBasis::Chebyshev, scale(params),
+                                          unitWidth, &consumed);
+  ok &= check("1 + 2 T_1 + 3 T_2 on [0, 2]", params, encoder, decryptor, unitQuadratic, consumed,
+              polyDepth(2, PolyBasis::Chebyshev, unitWidth), scaled, [](double x) {
+                double t = x - 1;
+                return 1 + 2 * t + 3 * (2 * t * t - 1);
+              }, 1e-4);
+
+  return ok ? 0 : 1;
+}
@@ -62,7 +62,7 @@ int main() {
 
   Evaluator evaluator = newEvaluator(params, makeEvaluationKey(rlk));
 
-  cout << "Done in " << duration_cast<seconds>(high_resolution_clock::now() - start).count() << " seconds." << endl;
+  cout << "Done in " << duration_cast<duration<double, milli>>(high_resolution_clock::now() - start).count() << " ms." << endl;
 
   cout << endl;
   cout << "CKKS parameters: logN = " << logN(params) << ", logSlots = " << logSlots(params) << ", logQP = " << logQP(params) << ", levels = " << maxLevel(params) + 1 << ", scale= " << scale(params) << ", sigma = " << sigma(params) << endl;
@@ -87,7 +87,7 @@ int main() {
   setScale(plaintext, scale(plaintext) / r);
   encode(encoder, values, plaintext);
 
-  cout << "Done in " << duration_cast<seconds>(high_resolution_clock::now() - start).count() << " seconds." << endl;
+  cout << "Done in " << duration_cast<duration<double, milli>>(high_resolution_clock::now() - start).count() << " ms." << endl;
 
   cout << endl;
   cout << "=========================================" << endl;
@@ -99,7 +99,7 @@ int main() {
 
   Ciphertext ciphertext = encryptNew(encryptor, plaintext);
 
-  cout << "Done in " << duration_cast<seconds>(high_resolution_clock::now() - start).count() << " seconds." << endl;
+  cout << "Done in " << duration_cast<duration<double, milli>>(high_resolution_clock::now() - start).count() << " ms." << endl;
 
   printDebug(params, ciphertext, values, decryptor, encoder);
 
@@ -113,7 +113,7 @@ int main() {
 
   multByConst(evaluator, ciphertext, 2, ciphertext);
 
-  cout << "Done in " << duration_cast<seconds>(high_resolution_clock::now() - start).count() << " seconds." << endl;
+  cout << "Done in " << duration_cast<duration<double, milli>>(high_resolution_clock::now() - start).count() << " ms." << endl;
 
   for (int i=0; i < values.size(); i++) {
     values[i] *= 2;
@@ -131,7 +131,7 @@ int main() {
 
   setScale(ciphertext, scale(ciphertext) * r);
 
-  cout << "Done in " << duration_cast<seconds>(high_resolution_clock::now() - start).count() << " seconds." << endl;
+  cout << "Done in " << duration_cast<duration<double, milli>>(high_resolution_clock::now() - start).count() << " ms." << endl;
 
   for (int i=0; i < values.size(); i++) {
     values[i] /= r;
@@ -149,7 +149,7 @@ int main() {
 
   decode(encoder, decryptNew(decryptor, ciphertext), logSlots(params));
 
-  cout << "Done in " << duration_cast<seconds>(high_resolution_clock::now() - start).count() << " seconds." << endl;
+  cout << "Done in " << duration_cast<duration<double, milli>>(high_resolution_clock::now() - start).count() << " ms." << endl;
 
   printDebug(params, ciphertext, values, decryptor, encoder);
 
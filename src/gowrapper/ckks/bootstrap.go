@@ -3,10 +3,19 @@
 
 package ckks
 
+/*
+#include <stdint.h>
+#include "callback.h"
+typedef const uint64_t constULong;
+*/
 import "C"
 
 import (
+	"errors"
 	"lattigo-cpp/marshal"
+	"reflect"
+	"sync"
+	"time"
 	"unsafe"
 
 	"github.com/tuneinsight/lattigo/v4/ckks"
@@ -17,13 +26,53 @@ import (
 // https://github.com/golang/go/issues/35715#issuecomment-791039692
 type Handle10 = uint64
 
-func getStoredBootstrapper(btpHandle Handle10) *bootstrapping.Bootstrapper {
+// A bootstrapper, together with the shallow copies that lattigo_bootstrapMany has made of it
+// and is not currently using, so that their scratch buffers are allocated once rather than
+// on every call
+type storedBootstrapper struct {
+	btp  *bootstrapping.Bootstrapper
+	lock sync.Mutex
+	idle []*bootstrapping.Bootstrapper
+}
+
+func storeBootstrapper(btp *bootstrapping.Bootstrapper) Handle10 {
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&storedBootstrapper{btp: btp}))
+}
+
+func getStoredBootstrapperState(btpHandle Handle10) *storedBootstrapper {
 	ref := marshal.CrossLangObjMap.Get(btpHandle)
-	return (*bootstrapping.Bootstrapper)(ref.Ptr)
+	return (*storedBootstrapper)(ref.Ptr)
+}
+
+func getStoredBootstrapper(btpHandle Handle10) *bootstrapping.Bootstrapper {
+	return getStoredBootstrapperState(btpHandle).btp
+}
+
+// Take n shallow copies of the bootstrapper, reusing idle ones where possible
+func (s *storedBootstrapper) takeCopies(n int) []*bootstrapping.Bootstrapper {
+	copies := make([]*bootstrapping.Bootstrapper, 0, n)
+	s.lock.Lock()
+	for len(copies) < n && len(s.idle) > 0 {
+		copies = append(copies, s.idle[len(s.idle)-1])
+		s.idle = s.idle[:len(s.idle)-1]
+	}
+	s.lock.Unlock()
+	// ShallowCopy only reads the bootstrapper, so it is safe to call without the lock
+	for len(copies) < n {
+		copies = append(copies, s.btp.ShallowCopy())
+	}
+	return copies
+}
+
+func (s *storedBootstrapper) returnCopies(copies []*bootstrapping.Bootstrapper) {
+	s.lock.Lock()
+	s.idle = append(s.idle, copies...)
+	s.lock.Unlock()
 }
 
 //export lattigo_newBootstrapper
 func lattigo_newBootstrapper(paramHandle Handle10, btpParamHandle Handle10, btpKeyHandle Handle10) Handle10 {
+	defer marshal.Track("lattigo_newBootstrapper").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 
@@ -39,11 +88,12 @@ func lattigo_newBootstrapper(paramHandle Handle10, btpParamHandle Handle10, btpK
 	if err != nil {
 		panic(err)
 	}
-	return marshal.CrossLangObjMap.Add(unsafe.Pointer(btp))
+	return storeBootstrapper(btp)
 }
 
 //export lattigo_bootstrap
 func lattigo_bootstrap(btpHandle Handle10, ctHandle Handle10) Handle10 {
+	defer marshal.Track("lattigo_bootstrap").Done()
 	var btp *bootstrapping.Bootstrapper
 	btp = getStoredBootstrapper(btpHandle)
 
@@ -54,3 +104,179 @@ func lattigo_bootstrap(btpHandle Handle10, ctHandle Handle10) Handle10 {
 	ctOut = btp.Bootstrap(ctIn)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(ctOut))
 }
+
+// Bootstrap a ciphertext on a new goroutine, then pass the handle of the result to the
+// completion callback. The bootstrapper must not be used by any other call until then.
+//
+//export lattigo_bootstrapAsync
+func lattigo_bootstrapAsync(btpHandle Handle10, ctHandle Handle10, callback C.completionCallback, ctx unsafe.Pointer) {
+	defer marshal.Track("lattigo_bootstrapAsync").Done()
+	var btp *bootstrapping.Bootstrapper
+	btp = getStoredBootstrapper(btpHandle)
+
+	var ctIn *rlwe.Ciphertext
+	ctIn = getStoredCiphertext(ctHandle)
+
+	runWithCompletion(callback, ctx, func() uint64 {
+		return marshal.CrossLangObjMap.Add(unsafe.Pointer(btp.Bootstrap(ctIn)))
+	})
+}
+
+// Create a bootstrapper which shares the bootstrapping keys and precomputed
+// linear transformations with btpHandle, but has its own scratch buffers.
+//
+//export lattigo_bootstrapperShallowCopy
+func lattigo_bootstrapperShallowCopy(btpHandle Handle10) Handle10 {
+	defer marshal.Track("lattigo_bootstrapperShallowCopy").Done()
+	var btp *bootstrapping.Bootstrapper
+	btp = getStoredBootstrapper(btpHandle)
+	return storeBootstrapper(btp.ShallowCopy())
+}
+
+// A pointer followed by reachableArrays: the same address can hold values of several
+// types (a struct and its first field), which are traversed separately.
+type visitedPtr struct {
+	addr uintptr
+	typ  reflect.Type
+}
+
+// Record the backing array of every slice reachable from v in `arrays`, as its address
+// and its size in bytes.
+func reachableArrays(v reflect.Value, arrays map[uintptr]uintptr, visited map[visitedPtr]bool) {
+	switch v.Kind() {
+	case reflect.Ptr:
+		if v.IsNil() {
+			return
+		}
+		key := visitedPtr{v.Pointer(), v.Type()}
+		if visited[key] {
+			return
+		}
+		visited[key] = true
+		reachableArrays(v.Elem(), arrays, visited)
+	case reflect.Interface:
+		if !v.IsNil() {
+			reachableArrays(v.Elem(), arrays, visited)
+		}
+	case reflect.Struct:
+		for i := 0; i < v.NumField(); i++ {
+			reachableArrays(v.Field(i), arrays, visited)
+		}
+	case reflect.Array:
+		for i := 0; i < v.Len(); i++ {
+			reachableArrays(v.Index(i), arrays, visited)
+		}
+	case reflect.Map:
+		iter := v.MapRange()
+		for iter.Next() {
+			reachableArrays(iter.Key(), arrays, visited)
+			reachableArrays(iter.Value(), arrays, visited)
+		}
+	case reflect.Slice:
+		if v.Cap() == 0 {
+			return
+		}
+		if _, ok := arrays[v.Pointer()]; ok {
+			return
+		}
+		elem := v.Type().Elem()
+		arrays[v.Pointer()] = uintptr(v.Cap()) * elem.Size()
+		switch elem.Kind() {
+		case reflect.Ptr, reflect.Interface, reflect.Struct, reflect.Array, reflect.Map, reflect.Slice:
+			for i := 0; i < v.Len(); i++ {
+				reachableArrays(v.Index(i), arrays, visited)
+			}
+		}
+	}
+}
+
+// Return the number of bytes of scratch buffers held by each shallow copy of a bootstrapper.
+// This makes two copies and adds up the slices reachable from one but not the other: the
+// keys and precomputed linear transformations are shared by all copies, so they are not
+// counted. It walks the whole bootstrapper, which takes much longer than making a copy,
+// so call it once per bootstrapper (as BootstrapperPool does) rather than on a hot path.
+//
+//export lattigo_bootstrapperShallowCopyBytes
+func lattigo_bootstrapperShallowCopyBytes(btpHandle Handle10) uint64 {
+	defer marshal.Track("lattigo_bootstrapperShallowCopyBytes").Done()
+	var btp *bootstrapping.Bootstrapper
+	btp = getStoredBootstrapper(btpHandle)
+
+	shared := make(map[uintptr]uintptr)
+	reachableArrays(reflect.ValueOf(btp.ShallowCopy()), shared, make(map[visitedPtr]bool))
+	own := make(map[uintptr]uintptr)
+	reachableArrays(reflect.ValueOf(btp.ShallowCopy()), own, make(map[visitedPtr]bool))
+
+	var bytes uint64
+	for addr, size := range own {
+		if _, ok := shared[addr]; !ok {
+			bytes += uint64(size)
+		}
+	}
+	return bytes
+}
+
+// Bootstrap cts[i] into out[i] for every i, with one goroutine per bootstrapper.
+// Ciphertexts are handed out dynamically. The time taken by each bootstrapping
+// operation is written to nanos[i]. A panic in any goroutine is raised again in the
+// caller, as runParallel does.
+func bootstrapAll(btps []*bootstrapping.Bootstrapper, cts []*rlwe.Ciphertext, out *C.uint64_t, nanos *C.uint64_t) {
+	size := unsafe.Sizeof(uint64(0))
+	runParallel(len(cts), len(btps), func(w int) func(i int) {
+		btp := btps[w]
+		return func(i int) {
+			start := time.Now()
+			ctOut := btp.Bootstrap(cts[i])
+			elapsed := time.Since(start)
+			*(*uint64)(unsafe.Pointer(uintptr(unsafe.Pointer(out)) + size*uintptr(i))) = marshal.CrossLangObjMap.Add(unsafe.Pointer(ctOut))
+			*(*uint64)(unsafe.Pointer(uintptr(unsafe.Pointer(nanos)) + size*uintptr(i))) = uint64(elapsed.Nanoseconds())
+		}
+	})
+}
+
+// Bootstrap `n` ciphertexts concurrently, using up to `workers` shallow copies of the
+// bootstrapper, which must be at least 1. Each copy holds its own scratch buffers, so
+// there is no default: the caller chooses how much memory to spend. The copies are kept
+// with the bootstrapper and reused by later calls. The handles of the
+// results are written to outHandles, and the latency of each operation (in nanoseconds)
+// to nanos.
+//
+//export lattigo_bootstrapMany
+func lattigo_bootstrapMany(btpHandle Handle10, ctHandles *C.constULong, n uint64, workers uint64, outHandles *C.uint64_t, nanos *C.uint64_t) {
+	defer marshal.Track("lattigo_bootstrapMany").Done()
+	btp := getStoredBootstrapperState(btpHandle)
+	cts := getStoredCiphertexts(ctHandles, n)
+
+	if workers == 0 {
+		panic(errors.New("bootstrapMany needs at least one worker"))
+	}
+	numWorkers := int(workers)
+	if numWorkers > len(cts) {
+		numWorkers = len(cts)
+	}
+	btps := []*bootstrapping.Bootstrapper{btp.btp}
+	if numWorkers > 1 {
+		copies := btp.takeCopies(numWorkers - 1)
+		defer btp.returnCopies(copies)
+		btps = append(btps, copies...)
+	}
+	bootstrapAll(btps, cts, outHandles, nanos)
+}
+
+// Like lattigo_bootstrapMany, but uses exactly the given bootstrappers (for example,
+// ones leased from a C++ BootstrapperPool) instead of creating shallow copies.
+//
+//export lattigo_bootstrapManyWith
+func lattigo_bootstrapManyWith(btpHandles *C.constULong, numBtps uint64, ctHandles *C.constULong, n uint64, outHandles *C.uint64_t, nanos *C.uint64_t) {
+	defer marshal.Track("lattigo_bootstrapManyWith").Done()
+	if numBtps == 0 {
+		panic(errors.New("bootstrapManyWith needs at least one bootstrapper"))
+	}
+	btps := make([]*bootstrapping.Bootstrapper, numBtps)
+	size := unsafe.Sizeof(uint64(0))
+	for i := range btps {
+		btps[i] = getStoredBootstrapper(*(*uint64)(unsafe.Pointer(uintptr(unsafe.Pointer(btpHandles)) + size*uintptr(i))))
+	}
+	cts := getStoredCiphertexts(ctHandles, n)
+	bootstrapAll(btps, cts, outHandles, nanos)
+}
@@ -24,6 +24,7 @@ func getStoredBootstrappingParameters(bootParamHandle Handle11) *bootstrapping.P
 
 //export lattigo_getBootstrappingParams
 func lattigo_getBootstrappingParams(bootParamEnum uint8) Handle11 {
+	defer marshal.Track("lattigo_getBootstrappingParams").Done()
 	defaultParameters := bootstrapping.DefaultParametersDense
 
 	if int(bootParamEnum) >= len(defaultParameters) {
@@ -37,13 +38,27 @@ func lattigo_getBootstrappingParams(bootParamEnum uint8) Handle11 {
 
 //export lattigo_ephemeralSecretWeight
 func lattigo_ephemeralSecretWeight(bootParamHandle Handle11) uint64 {
+	defer marshal.Track("lattigo_ephemeralSecretWeight").Done()
 	var bootParams *bootstrapping.Parameters
 	bootParams = getStoredBootstrappingParameters(bootParamHandle)
 	return uint64(bootParams.EphemeralSecretWeight)
 }
 
+// The level of a ciphertext after bootstrapping: SlotsToCoeffs is the last step and
+// starts at SlotsToCoeffsParameters.LevelStart.
+//
+//export lattigo_bootstrappingOutputLevel
+func lattigo_bootstrappingOutputLevel(bootParamHandle Handle11) uint64 {
+	defer marshal.Track("lattigo_bootstrappingOutputLevel").Done()
+	var bootParams *bootstrapping.Parameters
+	bootParams = getStoredBootstrappingParameters(bootParamHandle)
+	stc := bootParams.SlotsToCoeffsParameters
+	return uint64(stc.LevelStart - stc.Depth(true))
+}
+
 //export lattigo_params
 func lattigo_params(bootParamEnum uint8) Handle11 {
+	defer marshal.Track("lattigo_params").Done()
 	defaultParameters := bootstrapping.DefaultParametersDense
 
 	if int(bootParamEnum) >= len(defaultParameters) {
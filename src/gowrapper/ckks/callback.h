@@ -0,0 +1,24 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Shared by the cgo preambles of the Go files with asynchronous exports. cgo copies each
+// preamble into the header it generates for that file, so this header is installed next
+// to the generated headers.
+
+#pragma once
+
+#include <stdint.h>
+
+// Called once when an asynchronous call finishes, with the context pointer passed to the
+// call. `error` is NULL if the call succeeded, in which case `result` is its result (usually
+// a handle). Otherwise `error` describes the failure; it is only valid during the callback.
+typedef void (*completionCallback) (void* ctx, uint64_t result, const char* error);
+
+// https://golang.org/cmd/cgo/#hdr-Go_references_to_C
+__attribute__((unused)) static void callCompletion(completionCallback f, void* ctx, uint64_t result) {
+  f(ctx, result, 0);
+}
+
+__attribute__((unused)) static void callCompletionError(completionCallback f, void* ctx, const char* error) {
+  f(ctx, 0, error);
+}
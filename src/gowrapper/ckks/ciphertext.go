@@ -34,6 +34,7 @@ func getStoredMetaData(metaDataHandle Handle8) *rlwe.MetaData {
 
 //export lattigo_level
 func lattigo_level(ctHandle Handle8) uint64 {
+	defer marshal.Track("lattigo_level").Done()
 	var ctIn *rlwe.Ciphertext
 	ctIn = getStoredCiphertext(ctHandle)
 	return uint64(ctIn.Level())
@@ -41,6 +42,7 @@ func lattigo_level(ctHandle Handle8) uint64 {
 
 //export lattigo_ciphertextGetScale
 func lattigo_ciphertextGetScale(ctHandle Handle8) float64 {
+	defer marshal.Track("lattigo_ciphertextGetScale").Done()
 	var ctIn *rlwe.Ciphertext
 	ctIn = getStoredCiphertext(ctHandle)
 	return ctIn.GetScale().Float64()
@@ -48,6 +50,7 @@ func lattigo_ciphertextGetScale(ctHandle Handle8) float64 {
 
 //export lattigo_ciphertextSetScale
 func lattigo_ciphertextSetScale(ctHandle Handle8, scale float64) {
+	defer marshal.Track("lattigo_ciphertextSetScale").Done()
 	var ctIn *rlwe.Ciphertext
 	ctIn = getStoredCiphertext(ctHandle)
 	ctIn.SetScale(rlwe.NewScale(scale))
@@ -55,12 +58,14 @@ func lattigo_ciphertextSetScale(ctHandle Handle8, scale float64) {
 
 //export lattigo_ciphertextDegree
 func lattigo_ciphertextDegree(ctHandle Handle8) uint64 {
+	defer marshal.Track("lattigo_ciphertextDegree").Done()
 	ct := getStoredCiphertext(ctHandle)
 	return uint64(ct.Degree())
 }
 
 //export lattigo_copyNew
 func lattigo_copyNew(ctHandle Handle8) Handle8 {
+	defer marshal.Track("lattigo_copyNew").Done()
 	var ctIn *rlwe.Ciphertext
 	ctIn = getStoredCiphertext(ctHandle)
 
@@ -71,6 +76,7 @@ func lattigo_copyNew(ctHandle Handle8) Handle8 {
 
 //export lattigo_copyNewCiphertextQP
 func lattigo_copyNewCiphertextQP(ctQPHandle Handle8) Handle8 {
+	defer marshal.Track("lattigo_copyNewCiphertextQP").Done()
 	ctQPIn := getStoredCiphertextQP(ctQPHandle)
 	ctQPOut := ctQPIn.CopyNew()
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(ctQPOut))
@@ -78,6 +84,7 @@ func lattigo_copyNewCiphertextQP(ctQPHandle Handle8) Handle8 {
 
 //export lattigo_newCiphertext
 func lattigo_newCiphertext(paramsHandle Handle8, degree uint64, level uint64) Handle8 {
+	defer marshal.Track("lattigo_newCiphertext").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramsHandle)
 
@@ -88,6 +95,7 @@ func lattigo_newCiphertext(paramsHandle Handle8, degree uint64, level uint64) Ha
 
 //export lattigo_newCiphertextQP
 func lattigo_newCiphertextQP(paramsHandle Handle8) Handle8 {
+	defer marshal.Track("lattigo_newCiphertextQP").Done()
 	params := getStoredParameters(paramsHandle)
 	ringQP := params.RingQP()
 	newCtQp := rlwe.CiphertextQP{Value: [2]ringqp.Poly{ringQP.NewPoly(), ringQP.NewPoly()}, MetaData: rlwe.MetaData{Scale: params.DefaultScale(), IsNTT: true}}
@@ -96,6 +104,7 @@ func lattigo_newCiphertextQP(paramsHandle Handle8) Handle8 {
 
 //export lattigo_setCiphertextMetaData
 func lattigo_setCiphertextMetaData(ctxHandle, metaDataHandle Handle8) {
+	defer marshal.Track("lattigo_setCiphertextMetaData").Done()
 	ctx := getStoredCiphertext(ctxHandle)
 	metaData := getStoredMetaData(metaDataHandle)
 	(*ctx).MetaData = *metaData
@@ -103,6 +112,7 @@ func lattigo_setCiphertextMetaData(ctxHandle, metaDataHandle Handle8) {
 
 //export lattigo_setCiphertextQPMetaData
 func lattigo_setCiphertextQPMetaData(ctxQPHandle, metaDataHandle Handle8) {
+	defer marshal.Track("lattigo_setCiphertextQPMetaData").Done()
 	ctxQP := getStoredCiphertextQP(ctxQPHandle)
 	metaData := getStoredMetaData(metaDataHandle)
 	(*ctxQP).MetaData = *metaData
@@ -110,18 +120,21 @@ func lattigo_setCiphertextQPMetaData(ctxQPHandle, metaDataHandle Handle8) {
 
 //export lattigo_getCiphertextMetaData
 func lattigo_getCiphertextMetaData(ctxHandle Handle8) Handle8 {
+	defer marshal.Track("lattigo_getCiphertextMetaData").Done()
 	ctx := getStoredCiphertext(ctxHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&ctx.MetaData))
 }
 
 //export lattigo_getCiphertextQPMetaData
 func lattigo_getCiphertextQPMetaData(ctxHandle Handle8) Handle8 {
+	defer marshal.Track("lattigo_getCiphertextQPMetaData").Done()
 	ctxQP := getStoredCiphertextQP(ctxHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&ctxQP.MetaData))
 }
 
 //export lattigo_getCiphertextPoly
 func lattigo_getCiphertextPoly(ctxHandle Handle8, i uint64) Handle8 {
+	defer marshal.Track("lattigo_getCiphertextPoly").Done()
 	ctx := getStoredCiphertext(ctxHandle)
 	if int(i) > ctx.Degree() {
 		panic("index exceed ciphertext degree")
@@ -131,6 +144,7 @@ func lattigo_getCiphertextPoly(ctxHandle Handle8, i uint64) Handle8 {
 
 //export lattigo_getCiphertextPolyQP
 func lattigo_getCiphertextPolyQP(ctQPHandle Handle8, i uint64) Handle8 {
+	defer marshal.Track("lattigo_getCiphertextPolyQP").Done()
 	ctxQP := getStoredCiphertextQP(ctQPHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&ctxQP.Value[i]))
 }
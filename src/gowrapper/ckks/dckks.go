@@ -76,6 +76,7 @@ func getStoredRTGCRP(shareHandle Handle13) *drlwe.RTGCRP {
 
 //export lattigo_newCKGProtocol
 func lattigo_newCKGProtocol(paramHandle Handle13) Handle13 {
+	defer marshal.Track("lattigo_newCKGProtocol").Done()
 	param := getStoredParameters(paramHandle)
 	protocol := dckks.NewCKGProtocol(*param)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(protocol))
@@ -83,12 +84,14 @@ func lattigo_newCKGProtocol(paramHandle Handle13) Handle13 {
 
 //export lattigo_ckgAllocateShare
 func lattigo_ckgAllocateShare(protocolHandle Handle13) Handle13 {
+	defer marshal.Track("lattigo_ckgAllocateShare").Done()
 	ckg := getStoredCKGProtocol(protocolHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(ckg.AllocateShare()))
 }
 
 //export lattigo_ckgSampleCRP
 func lattigo_ckgSampleCRP(protocolHandle, prngHandle Handle13) Handle13 {
+	defer marshal.Track("lattigo_ckgSampleCRP").Done()
 	ckg := getStoredCKGProtocol(protocolHandle)
 	prng := utils.GetStoredKeyedPRNG(prngHandle)
 	crp := ckg.SampleCRP(prng)
@@ -97,6 +100,7 @@ func lattigo_ckgSampleCRP(protocolHandle, prngHandle Handle13) Handle13 {
 
 //export lattigo_ckgGenShare
 func lattigo_ckgGenShare(protocolHandle, skHandle, crpHandle, shareOutHandle Handle13) {
+	defer marshal.Track("lattigo_ckgGenShare").Done()
 	ckg := getStoredCKGProtocol(protocolHandle)
 	sk := getStoredSecretKey(skHandle)
 	crp := getStoredCKGCRP(crpHandle)
@@ -106,6 +110,7 @@ func lattigo_ckgGenShare(protocolHandle, skHandle, crpHandle, shareOutHandle Han
 
 //export lattigo_ckgAggregateShares
 func lattigo_ckgAggregateShares(protocolHandle, share1Handle, share2Handle, shareOutHandle Handle13) {
+	defer marshal.Track("lattigo_ckgAggregateShares").Done()
 	ckg := getStoredCKGProtocol(protocolHandle)
 	share1 := getStoredCKGShare(share1Handle)
 	share2 := getStoredCKGShare(share2Handle)
@@ -115,6 +120,7 @@ func lattigo_ckgAggregateShares(protocolHandle, share1Handle, share2Handle, shar
 
 //export lattigo_ckgGenPublicKey
 func lattigo_ckgGenPublicKey(protocolHandle, roundShareHandle, crpHandle, pkHandle Handle13) {
+	defer marshal.Track("lattigo_ckgGenPublicKey").Done()
 	ckg := getStoredCKGProtocol(protocolHandle)
 	roundShare := getStoredCKGShare(roundShareHandle)
 	crp := getStoredCKGCRP(crpHandle)
@@ -124,6 +130,7 @@ func lattigo_ckgGenPublicKey(protocolHandle, roundShareHandle, crpHandle, pkHand
 
 //export lattigo_newRKGProtocol
 func lattigo_newRKGProtocol(paramHandle Handle13) Handle13 {
+	defer marshal.Track("lattigo_newRKGProtocol").Done()
 	param := getStoredParameters(paramHandle)
 	protocol := dckks.NewRKGProtocol(*param)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(protocol))
@@ -131,11 +138,13 @@ func lattigo_newRKGProtocol(paramHandle Handle13) Handle13 {
 
 //export lattigo_newRKGShare
 func lattigo_newRKGShare() Handle13 {
+	defer marshal.Track("lattigo_newRKGShare").Done()
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(new(drlwe.RKGShare)))
 }
 
 //export lattigo_rkgAllocateShare
 func lattigo_rkgAllocateShare(protocolHandle, ephSkHandle, share1Handle, share2Handle Handle13) {
+	defer marshal.Track("lattigo_rkgAllocateShare").Done()
 	ckg := getStoredRKGProtocol(protocolHandle)
 	ephSk := getStoredSecretKey(ephSkHandle)
 	share1 := getStoredRKGShare(share1Handle)
@@ -150,6 +159,7 @@ func lattigo_rkgAllocateShare(protocolHandle, ephSkHandle, share1Handle, share2H
 
 //export lattigo_rkgSampleCRP
 func lattigo_rkgSampleCRP(protocolHandle, prngHandle Handle13) Handle13 {
+	defer marshal.Track("lattigo_rkgSampleCRP").Done()
 	rkg := getStoredRKGProtocol(protocolHandle)
 	prng := utils.GetStoredKeyedPRNG(prngHandle)
 	crp := rkg.SampleCRP(prng)
@@ -158,6 +168,7 @@ func lattigo_rkgSampleCRP(protocolHandle, prngHandle Handle13) Handle13 {
 
 //export lattigo_rkgGenShareRoundOne
 func lattigo_rkgGenShareRoundOne(protocolHandle, skHandle, crpHandle, ephSkOutHandle, shareOutHandle Handle13) {
+	defer marshal.Track("lattigo_rkgGenShareRoundOne").Done()
 	protocol := getStoredRKGProtocol(protocolHandle)
 	sk := getStoredSecretKey(skHandle)
 	crp := getStoredRKGCRP(crpHandle)
@@ -169,6 +180,7 @@ func lattigo_rkgGenShareRoundOne(protocolHandle, skHandle, crpHandle, ephSkOutHa
 
 //export lattigo_rkgGenShareRoundTwo
 func lattigo_rkgGenShareRoundTwo(protocolHandle, ephSkHandle, skHandle, round1Handle, shareOutHandle Handle13) {
+	defer marshal.Track("lattigo_rkgGenShareRoundTwo").Done()
 	protocol := getStoredRKGProtocol(protocolHandle)
 	ephSk := getStoredSecretKey(ephSkHandle)
 	sk := getStoredSecretKey(skHandle)
@@ -180,6 +192,7 @@ func lattigo_rkgGenShareRoundTwo(protocolHandle, ephSkHandle, skHandle, round1Ha
 
 //export lattigo_rkgAggregateShares
 func lattigo_rkgAggregateShares(protocolHandle, share1Handle, share2Handle, shareOutHandle Handle13) {
+	defer marshal.Track("lattigo_rkgAggregateShares").Done()
 	protocol := getStoredRKGProtocol(protocolHandle)
 	share1 := getStoredRKGShare(share1Handle)
 	share2 := getStoredRKGShare(share2Handle)
@@ -189,6 +202,7 @@ func lattigo_rkgAggregateShares(protocolHandle, share1Handle, share2Handle, shar
 
 //export lattigo_rkgGenRelinearizationKey
 func lattigo_rkgGenRelinearizationKey(protocolHandle, round1Handle, round2Handle, rlnKeyOutHandle Handle13) {
+	defer marshal.Track("lattigo_rkgGenRelinearizationKey").Done()
 	protocol := getStoredRKGProtocol(protocolHandle)
 	round1 := getStoredRKGShare(round1Handle)
 	round2 := getStoredRKGShare(round2Handle)
@@ -198,6 +212,7 @@ func lattigo_rkgGenRelinearizationKey(protocolHandle, round1Handle, round2Handle
 
 //export lattigo_newCKSProtocol
 func lattigo_newCKSProtocol(paramHandle Handle13, sigmaSmudging float64) Handle13 {
+	defer marshal.Track("lattigo_newCKSProtocol").Done()
 	param := getStoredParameters(paramHandle)
 	protocol := dckks.NewCKSProtocol(*param, sigmaSmudging)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(protocol))
@@ -205,12 +220,14 @@ func lattigo_newCKSProtocol(paramHandle Handle13, sigmaSmudging float64) Handle1
 
 //export lattigo_cksAllocateShare
 func lattigo_cksAllocateShare(protocolHandle Handle13, level uint64) Handle13 {
+	defer marshal.Track("lattigo_cksAllocateShare").Done()
 	cks := getStoredCKSProtocol(protocolHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(cks.AllocateShare(int(level))))
 }
 
 //export lattigo_cksGenShare
 func lattigo_cksGenShare(protocolHandle, skInputHandle, skOutputHandle, ctHandle, shareOutHandle Handle13) {
+	defer marshal.Track("lattigo_cksGenShare").Done()
 	protocol := getStoredCKSProtocol(protocolHandle)
 	skInput := getStoredSecretKey(skInputHandle)
 	skOutput := getStoredSecretKey(skOutputHandle)
@@ -221,6 +238,7 @@ func lattigo_cksGenShare(protocolHandle, skInputHandle, skOutputHandle, ctHandle
 
 //export lattigo_cksAggregateShares
 func lattigo_cksAggregateShares(protocolHandle, share1Handle, share2Handle, shareOutHandle Handle13) {
+	defer marshal.Track("lattigo_cksAggregateShares").Done()
 	protocol := getStoredCKSProtocol(protocolHandle)
 	share1 := getStoredCKSShare(share1Handle)
 	share2 := getStoredCKSShare(share2Handle)
@@ -230,6 +248,7 @@ func lattigo_cksAggregateShares(protocolHandle, share1Handle, share2Handle, shar
 
 //export lattigo_cksKeySwitch
 func lattigo_cksKeySwitch(protocolHandle, ctHandle, combinedHandle, ctOutHandle Handle13) {
+	defer marshal.Track("lattigo_cksKeySwitch").Done()
 	protocol := getStoredCKSProtocol(protocolHandle)
 	ct := getStoredCiphertext(ctHandle)
 	combined := getStoredCKSShare(combinedHandle)
@@ -239,6 +258,7 @@ func lattigo_cksKeySwitch(protocolHandle, ctHandle, combinedHandle, ctOutHandle
 
 //export lattigo_newRTGProtocol
 func lattigo_newRTGProtocol(paramHandle Handle13) Handle13 {
+	defer marshal.Track("lattigo_newRTGProtocol").Done()
 	param := getStoredParameters(paramHandle)
 	protocol := dckks.NewRTGProtocol(*param)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(protocol))
@@ -246,12 +266,14 @@ func lattigo_newRTGProtocol(paramHandle Handle13) Handle13 {
 
 //export lattigo_rtgAllocateShare
 func lattigo_rtgAllocateShare(protocolHandle Handle13) Handle13 {
+	defer marshal.Track("lattigo_rtgAllocateShare").Done()
 	protocol := getStoredRTGProtocol(protocolHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(protocol.AllocateShare()))
 }
 
 //export lattigo_rtgSampleCRP
 func lattigo_rtgSampleCRP(protocolHandle, prngHandle Handle13) Handle13 {
+	defer marshal.Track("lattigo_rtgSampleCRP").Done()
 	rtg := getStoredRTGProtocol(protocolHandle)
 	prng := utils.GetStoredKeyedPRNG(prngHandle)
 	crp := rtg.SampleCRP(prng)
@@ -260,6 +282,7 @@ func lattigo_rtgSampleCRP(protocolHandle, prngHandle Handle13) Handle13 {
 
 //export lattigo_rtgGenShare
 func lattigo_rtgGenShare(protocolHandle, skHandle Handle13, galEl uint64, crpHandle, shareOutHandle Handle13) {
+	defer marshal.Track("lattigo_rtgGenShare").Done()
 	protocol := getStoredRTGProtocol(protocolHandle)
 	sk := getStoredSecretKey(skHandle)
 	crp := getStoredRTGCRP(crpHandle)
@@ -269,6 +292,7 @@ func lattigo_rtgGenShare(protocolHandle, skHandle Handle13, galEl uint64, crpHan
 
 //export lattigo_rtgAggregateShares
 func lattigo_rtgAggregateShares(protocolHandle, share1Handle, share2Handle, shareOutHandle Handle13) {
+	defer marshal.Track("lattigo_rtgAggregateShares").Done()
 	protocol := getStoredRTGProtocol(protocolHandle)
 	share1 := getStoredRTGShare(share1Handle)
 	share2 := getStoredRTGShare(share2Handle)
@@ -278,6 +302,7 @@ func lattigo_rtgAggregateShares(protocolHandle, share1Handle, share2Handle, shar
 
 //export lattigo_rtgGenRotationKey
 func lattigo_rtgGenRotationKey(protocolHandle, shareHandle Handle13, crpHandle, switchingKeyHandle Handle13) {
+	defer marshal.Track("lattigo_rtgGenRotationKey").Done()
 	protocol := getStoredRTGProtocol(protocolHandle)
 	share := getStoredRTGShare(shareHandle)
 	crp := getStoredRTGCRP(crpHandle)
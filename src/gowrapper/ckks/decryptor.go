@@ -23,6 +23,7 @@ func getStoredDecryptor(decryptorHandle Handle1) *rlwe.Decryptor {
 
 //export lattigo_newDecryptor
 func lattigo_newDecryptor(paramHandle Handle1, skHandle Handle1) Handle1 {
+	defer marshal.Track("lattigo_newDecryptor").Done()
 	params := getStoredParameters(paramHandle)
 	sk := getStoredSecretKey(skHandle)
 	var decryptor rlwe.Decryptor
@@ -32,6 +33,7 @@ func lattigo_newDecryptor(paramHandle Handle1, skHandle Handle1) Handle1 {
 
 //export lattigo_decryptNew
 func lattigo_decryptNew(decryptorHandle Handle1, ctHandle Handle1) Handle1 {
+	defer marshal.Track("lattigo_decryptNew").Done()
 	var dec *rlwe.Decryptor
 	dec = getStoredDecryptor(decryptorHandle)
 
@@ -4,6 +4,7 @@
 package ckks
 
 /*
+#include <stdint.h>
 typedef const double constDouble;
 */
 import "C"
@@ -28,6 +29,7 @@ func getStoredEncoder(encoderHandle Handle2) *ckks.Encoder {
 
 //export lattigo_newEncoder
 func lattigo_newEncoder(paramHandle Handle2) Handle2 {
+	defer marshal.Track("lattigo_newEncoder").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 
@@ -37,14 +39,35 @@ func lattigo_newEncoder(paramHandle Handle2) Handle2 {
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&encoder))
 }
 
+// The largest array a C buffer can be viewed as. This only bounds the array type;
+// the slices created from it have the length of the C buffer.
+const maxCArrayLen = 1 << 28
+
+// View `length` doubles of C memory as a Go slice, without copying
+func cDoubles(values *C.constDouble, length uint64) []float64 {
+	return (*[maxCArrayLen]float64)(unsafe.Pointer(values))[:length:length]
+}
+
+// View `length` complex numbers of C memory, stored as interleaved (real, imaginary)
+// pairs (which is also the layout of std::complex<double>), as a Go slice without copying.
+// The slice must not be used after the C call which passed the memory returns.
+func cComplexes(values unsafe.Pointer, length uint64) []complex128 {
+	return (*[maxCArrayLen]complex128)(values)[:length:length]
+}
+
+// View `length` uint64 values of C memory as a Go slice, without copying
+func cUint64s(values unsafe.Pointer, length uint64) []uint64 {
+	return (*[maxCArrayLen]uint64)(values)[:length:length]
+}
+
+// View an array of `length` pointers to C arrays of doubles as a Go slice, without copying
+func cDoubleRows(rows **C.constDouble, length uint64) []*C.constDouble {
+	return (*[maxCArrayLen]*C.constDouble)(unsafe.Pointer(rows))[:length:length]
+}
+
 func CDoubleVecToGoComplex(realValues *C.constDouble, length uint64) []complex128 {
 	complexValues := make([]complex128, length)
-	size := unsafe.Sizeof(float64(0))
-	basePtr := uintptr(unsafe.Pointer(realValues))
-	for i := range complexValues {
-		var x float64
-		// https://stackoverflow.com/a/32701024/925978
-		x = *(*float64)(unsafe.Pointer(basePtr + size*uintptr(i)))
+	for i, x := range cDoubles(realValues, length) {
 		complexValues[i] = complex(x, 0)
 	}
 	return complexValues
@@ -55,6 +78,7 @@ func CDoubleVecToGoComplex(realValues *C.constDouble, length uint64) []complex12
 //
 //export lattigo_encode
 func lattigo_encode(encoderHandle Handle2, realValues *C.constDouble, logLen uint64, ptHandle Handle2) {
+	defer marshal.Track("lattigo_encode").Done()
 	var encoder *ckks.Encoder
 	encoder = getStoredEncoder(encoderHandle)
 
@@ -68,6 +92,7 @@ func lattigo_encode(encoderHandle Handle2, realValues *C.constDouble, logLen uin
 
 //export lattigo_encodeNew
 func lattigo_encodeNew(encoderHandle Handle2, realValues *C.constDouble, level uint64, scale float64, logLen uint64) Handle2 {
+	defer marshal.Track("lattigo_encodeNew").Done()
 	var encoder *ckks.Encoder
 	encoder = getStoredEncoder(encoderHandle)
 
@@ -80,6 +105,7 @@ func lattigo_encodeNew(encoderHandle Handle2, realValues *C.constDouble, level u
 
 //export lattigo_decode
 func lattigo_decode(encoderHandle, ptHandle Handle2, logSlots uint64, outValues *C.double) {
+	defer marshal.Track("lattigo_decode").Done()
 	var enc *ckks.Encoder
 	enc = getStoredEncoder(encoderHandle)
 
@@ -89,11 +115,86 @@ func lattigo_decode(encoderHandle, ptHandle Handle2, logSlots uint64, outValues
 	var res []complex128
 	res = (*enc).Decode(pt, int(logSlots))
 
-	size := unsafe.Sizeof(float64(0))
-	basePtr := uintptr(unsafe.Pointer(outValues))
+	out := (*[maxCArrayLen]float64)(unsafe.Pointer(outValues))[:len(res):len(res)]
 	for i := range res {
-		var x complex128
-		x = res[i]
-		*(*float64)(unsafe.Pointer(basePtr + size*uintptr(i))) = real(x)
+		out[i] = real(res[i])
+	}
+}
+
+// Encode 2^logLen complex values, read directly from caller memory
+//
+//export lattigo_encodeComplex
+func lattigo_encodeComplex(encoderHandle Handle2, values *C.constDouble, logLen uint64, ptHandle Handle2) {
+	defer marshal.Track("lattigo_encodeComplex").Done()
+	var encoder *ckks.Encoder
+	encoder = getStoredEncoder(encoderHandle)
+
+	var plaintext *rlwe.Plaintext
+	plaintext = getStoredPlaintext(ptHandle)
+
+	(*encoder).Encode(cComplexes(unsafe.Pointer(values), uint64(1)<<logLen), plaintext, int(logLen))
+}
+
+//export lattigo_encodeComplexNew
+func lattigo_encodeComplexNew(encoderHandle Handle2, values *C.constDouble, level uint64, scale float64, logLen uint64) Handle2 {
+	defer marshal.Track("lattigo_encodeComplexNew").Done()
+	var encoder *ckks.Encoder
+	encoder = getStoredEncoder(encoderHandle)
+
+	var plaintext *rlwe.Plaintext
+	plaintext = (*encoder).EncodeNew(cComplexes(unsafe.Pointer(values), uint64(1)<<logLen), int(level), rlwe.NewScale(scale), int(logLen))
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(plaintext))
+}
+
+// Decode all 2^logSlots complex slots into caller memory, which must have room for
+// 2^(logSlots+1) doubles
+//
+//export lattigo_decodeComplex
+func lattigo_decodeComplex(encoderHandle, ptHandle Handle2, logSlots uint64, outValues *C.double) {
+	defer marshal.Track("lattigo_decodeComplex").Done()
+	var enc *ckks.Encoder
+	enc = getStoredEncoder(encoderHandle)
+
+	var pt *rlwe.Plaintext
+	pt = getStoredPlaintext(ptHandle)
+
+	copy(cComplexes(unsafe.Pointer(outValues), uint64(1)<<logSlots), (*enc).Decode(pt, int(logSlots)))
+}
+
+// Encode `n` rows of 2^logLen real values each, using up to `workers` shallow copies of the
+// encoder. If allocate is set, new plaintexts are created at the given level and scale, and
+// their handles are written to ptHandles; otherwise ptHandles holds existing plaintexts,
+// which are encoded into at their own level and scale.
+//
+//export lattigo_encodeBatch
+func lattigo_encodeBatch(encoderHandle Handle2, rows **C.constDouble, n uint64, logLen uint64, level uint64, scale float64, ptHandles *C.uint64_t, allocate bool, workers uint64) {
+	defer marshal.Track("lattigo_encodeBatch").Done()
+	var encoder *ckks.Encoder
+	encoder = getStoredEncoder(encoderHandle)
+
+	values := cDoubleRows(rows, n)
+	handles := cUint64s(unsafe.Pointer(ptHandles), n)
+	var pts []*rlwe.Plaintext
+	if !allocate {
+		pts = make([]*rlwe.Plaintext, n)
+		for i := range pts {
+			pts[i] = getStoredPlaintext(handles[i])
+		}
 	}
+
+	runParallel(int(n), int(workers), func(w int) func(i int) {
+		enc := *encoder
+		if w > 0 {
+			enc = enc.ShallowCopy()
+		}
+		return func(i int) {
+			complexValues := CDoubleVecToGoComplex(values[i], uint64(1)<<logLen)
+			if allocate {
+				pt := enc.EncodeNew(complexValues, int(level), rlwe.NewScale(scale), int(logLen))
+				handles[i] = marshal.CrossLangObjMap.Add(unsafe.Pointer(pt))
+			} else {
+				enc.Encode(complexValues, pts[i], int(logLen))
+			}
+		}
+	})
 }
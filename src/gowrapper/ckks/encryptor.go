@@ -3,6 +3,11 @@
 
 package ckks
 
+/*
+#include <stdint.h>
+typedef const double constDouble;
+typedef const uint64_t constULong;
+*/
 import "C"
 
 import (
@@ -23,6 +28,7 @@ func getStoredEncrypter(encryptorHandle Handle3) *rlwe.Encryptor {
 
 //export lattigo_newEncryptorFromSk
 func lattigo_newEncryptorFromSk(paramHandle Handle3, skHandle Handle3) Handle3 {
+	defer marshal.Track("lattigo_newEncryptorFromSk").Done()
 	params := getStoredParameters(paramHandle)
 	sk := getStoredSecretKey(skHandle)
 	var encryptor rlwe.Encryptor
@@ -32,6 +38,7 @@ func lattigo_newEncryptorFromSk(paramHandle Handle3, skHandle Handle3) Handle3 {
 
 //export lattigo_newEncryptorFromPk
 func lattigo_newEncryptorFromPk(paramHandle Handle3, pkHandle Handle3) Handle3 {
+	defer marshal.Track("lattigo_newEncryptorFromPk").Done()
 	params := getStoredParameters(paramHandle)
 	pk := getStoredPublicKey(pkHandle)
 	var encryptor rlwe.Encryptor
@@ -41,6 +48,7 @@ func lattigo_newEncryptorFromPk(paramHandle Handle3, pkHandle Handle3) Handle3 {
 
 //export lattigo_encryptNew
 func lattigo_encryptNew(encryptorHandle Handle3, ptHandle Handle3) Handle3 {
+	defer marshal.Track("lattigo_encryptNew").Done()
 	encryptorPtr := getStoredEncrypter(encryptorHandle)
 	ptPtr := getStoredPlaintext(ptHandle)
 	var ct *rlwe.Ciphertext
@@ -50,9 +58,94 @@ func lattigo_encryptNew(encryptorHandle Handle3, ptHandle Handle3) Handle3 {
 
 //export lattigo_encryptZeroQP
 func lattigo_encryptZeroQP(paramHandle, skHandle, ctxQPHandle Handle3) {
+	defer marshal.Track("lattigo_encryptZeroQP").Done()
 	params := getStoredParameters(paramHandle)
 	sk := getStoredSecretKey(skHandle)
 	enc := rlwe.NewEncryptor(params.Parameters, sk)
 	ctxQP := getStoredCiphertextQP(ctxQPHandle)
 	enc.EncryptZero(ctxQP)
 }
+
+// Encrypt `n` plaintexts using up to `workers` shallow copies of the encryptor. If allocate
+// is set, the handles of new ciphertexts are written to ctHandles; otherwise ctHandles holds
+// existing ciphertexts which are encrypted into.
+//
+//export lattigo_encryptBatch
+func lattigo_encryptBatch(encryptorHandle Handle3, ptHandles *C.constULong, n uint64, ctHandles *C.uint64_t, allocate bool, workers uint64) {
+	defer marshal.Track("lattigo_encryptBatch").Done()
+	encryptor := getStoredEncrypter(encryptorHandle)
+
+	ptIn := cUint64s(unsafe.Pointer(ptHandles), n)
+	pts := make([]*rlwe.Plaintext, n)
+	for i := range pts {
+		pts[i] = getStoredPlaintext(ptIn[i])
+	}
+	cts := storedOrNewCiphertexts(ctHandles, n, allocate)
+
+	runParallel(int(n), int(workers), func(w int) func(i int) {
+		enc := *encryptor
+		if w > 0 {
+			enc = enc.ShallowCopy()
+		}
+		return func(i int) {
+			cts.encrypt(enc, pts[i], i)
+		}
+	})
+}
+
+// Encode and encrypt `n` rows of 2^logLen real values each at the given level and scale,
+// without creating a plaintext handle for each row. Each worker has its own shallow copies
+// of the encoder and encryptor, and its own scratch plaintext. ctHandles is filled in or
+// read as in lattigo_encryptBatch.
+//
+//export lattigo_encodeEncryptBatch
+func lattigo_encodeEncryptBatch(paramHandle Handle3, encoderHandle Handle3, encryptorHandle Handle3, rows **C.constDouble, n uint64, logLen uint64, level uint64, scale float64, ctHandles *C.uint64_t, allocate bool, workers uint64) {
+	defer marshal.Track("lattigo_encodeEncryptBatch").Done()
+	params := getStoredParameters(paramHandle)
+	encoder := getStoredEncoder(encoderHandle)
+	encryptor := getStoredEncrypter(encryptorHandle)
+
+	values := cDoubleRows(rows, n)
+	cts := storedOrNewCiphertexts(ctHandles, n, allocate)
+
+	runParallel(int(n), int(workers), func(w int) func(i int) {
+		ecd := *encoder
+		enc := *encryptor
+		if w > 0 {
+			ecd = ecd.ShallowCopy()
+			enc = enc.ShallowCopy()
+		}
+		pt := ckks.NewPlaintext(*params, int(level))
+		pt.Scale = rlwe.NewScale(scale)
+		return func(i int) {
+			ecd.Encode(CDoubleVecToGoComplex(values[i], uint64(1)<<logLen), pt, int(logLen))
+			cts.encrypt(enc, pt, i)
+		}
+	})
+}
+
+// Output ciphertexts of a batch encryption: either existing ciphertexts, or a C array which
+// receives the handles of newly allocated ones
+type batchOutput struct {
+	handles []uint64
+	cts     []*rlwe.Ciphertext
+}
+
+func storedOrNewCiphertexts(ctHandles *C.uint64_t, n uint64, allocate bool) batchOutput {
+	out := batchOutput{handles: cUint64s(unsafe.Pointer(ctHandles), n)}
+	if !allocate {
+		out.cts = make([]*rlwe.Ciphertext, n)
+		for i := range out.cts {
+			out.cts[i] = getStoredCiphertext(out.handles[i])
+		}
+	}
+	return out
+}
+
+func (out batchOutput) encrypt(enc rlwe.Encryptor, pt *rlwe.Plaintext, i int) {
+	if out.cts == nil {
+		out.handles[i] = marshal.CrossLangObjMap.Add(unsafe.Pointer(enc.EncryptNew(pt)))
+	} else {
+		enc.Encrypt(pt, out.cts[i])
+	}
+}
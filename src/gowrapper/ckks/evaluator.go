@@ -5,48 +5,112 @@ package ckks
 
 /*
 #include <stdint.h>
+#include <stdlib.h>
+#include "callback.h"
+typedef const uint64_t constULong;
+typedef const double constDouble;
 */
 import "C"
 
 import (
+	"errors"
+	"fmt"
 	"lattigo-cpp/marshal"
+	"math"
+	"runtime"
+	"strconv"
+	"sync"
+	"sync/atomic"
 	"unsafe"
 
 	"github.com/tuneinsight/lattigo/v4/ckks"
 	"github.com/tuneinsight/lattigo/v4/rlwe"
+	"github.com/tuneinsight/lattigo/v4/rlwe/ringqp"
 )
 
 // https://github.com/golang/go/issues/35715#issuecomment-791039692
 type Handle4 = uint64
 
-func getStoredEvaluator(evalHandle Handle4) *ckks.Evaluator {
+// An evaluator in the registry, together with the shallow copies of it used by the
+// workers of batch operations. The copies are kept and reused by later batches rather
+// than allocated (scratch buffers and all) for every call, and are freed along with
+// the evaluator.
+type storedEvaluator struct {
+	eval ckks.Evaluator
+	lock sync.Mutex
+	// shallow copies of eval not currently used by a batch
+	idle []ckks.Evaluator
+}
+
+func storeEvaluator(eval ckks.Evaluator) Handle4 {
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&storedEvaluator{eval: eval}))
+}
+
+func getStoredEvaluatorState(evalHandle Handle4) *storedEvaluator {
 	ref := marshal.CrossLangObjMap.Get(evalHandle)
-	return (*ckks.Evaluator)(ref.Ptr)
+	return (*storedEvaluator)(ref.Ptr)
+}
+
+func getStoredEvaluator(evalHandle Handle4) *ckks.Evaluator {
+	return &getStoredEvaluatorState(evalHandle).eval
+}
+
+// Take n shallow copies of the evaluator, reusing idle ones where possible
+func (s *storedEvaluator) takeCopies(n int) []ckks.Evaluator {
+	copies := make([]ckks.Evaluator, 0, n)
+	s.lock.Lock()
+	for len(copies) < n && len(s.idle) > 0 {
+		copies = append(copies, s.idle[len(s.idle)-1])
+		s.idle = s.idle[:len(s.idle)-1]
+	}
+	s.lock.Unlock()
+	// ShallowCopy only reads the evaluator, so it is safe to call without the lock
+	for len(copies) < n {
+		copies = append(copies, s.eval.ShallowCopy())
+	}
+	return copies
+}
+
+func (s *storedEvaluator) returnCopies(copies []ckks.Evaluator) {
+	s.lock.Lock()
+	s.idle = append(s.idle, copies...)
+	s.lock.Unlock()
 }
 
 //export lattigo_newEvaluator
 func lattigo_newEvaluator(paramsHandle Handle4, evalkeyHandle Handle4) Handle4 {
+	defer marshal.Track("lattigo_newEvaluator").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramsHandle)
 
 	var evalKeys *rlwe.EvaluationKey
 	evalKeys = getStoredEvaluationKey(evalkeyHandle)
 
-	var evaluator ckks.Evaluator
-	evaluator = ckks.NewEvaluator(*params, *evalKeys)
-	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&evaluator))
+	return storeEvaluator(ckks.NewEvaluator(*params, *evalKeys))
 }
 
 //export lattigo_evaluatorWithKey
 func lattigo_evaluatorWithKey(evalHandle, evalKeyHandle Handle4) Handle4 {
+	defer marshal.Track("lattigo_evaluatorWithKey").Done()
 	eval := getStoredEvaluator(evalHandle)
 	evalKey := getStoredEvaluationKey(evalKeyHandle)
-	evalWithKey := (*eval).WithKey(*evalKey)
-	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&evalWithKey))
+	return storeEvaluator((*eval).WithKey(*evalKey))
+}
+
+// Returns a new evaluator which shares the parameters and evaluation keys of the
+// input evaluator, but has its own scratch buffers. The two evaluators can be used
+// concurrently from different threads.
+//
+//export lattigo_evaluatorShallowCopy
+func lattigo_evaluatorShallowCopy(evalHandle Handle4) Handle4 {
+	defer marshal.Track("lattigo_evaluatorShallowCopy").Done()
+	eval := getStoredEvaluator(evalHandle)
+	return storeEvaluator((*eval).ShallowCopy())
 }
 
 //export lattigo_rotate
 func lattigo_rotate(evalHandle Handle4, ctInHandle Handle4, k uint64, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_rotate").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -61,6 +125,7 @@ func lattigo_rotate(evalHandle Handle4, ctInHandle Handle4, k uint64, ctOutHandl
 
 //export lattigo_rotateHoisted
 func lattigo_rotateHoisted(evalHandle Handle4, ctInHandle Handle4, ks *C.uint64_t, ksLen uint64, outHandles *C.uint64_t) {
+	defer marshal.Track("lattigo_rotateHoisted").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -74,8 +139,10 @@ func lattigo_rotateHoisted(evalHandle Handle4, ctInHandle Handle4, ks *C.uint64_
 		rotations[i] = *(*int)(unsafe.Pointer(basePtrIn + size*uintptr(i)))
 	}
 
+	// RotateHoisted writes into the ciphertexts already in the map, so use the variant
+	// which allocates them
 	var rotatedCts map[int]*rlwe.Ciphertext
-	(*eval).RotateHoisted(ctIn, rotations, rotatedCts)
+	rotatedCts = (*eval).RotateHoistedNew(ctIn, rotations)
 
 	basePtrOut := uintptr(unsafe.Pointer(outHandles))
 	for i := range rotations {
@@ -83,8 +150,80 @@ func lattigo_rotateHoisted(evalHandle Handle4, ctInHandle Handle4, ks *C.uint64_
 	}
 }
 
+// A rotationPlan holds the key-switching decomposition of one ciphertext, so that any
+// number of rotations of that ciphertext can be computed without decomposing it again.
+// It has its own rlwe.Evaluator, so it can be used concurrently with other evaluators
+// which share the same keys.
+type rotationPlan struct {
+	params ckks.Parameters
+	eval   *rlwe.Evaluator
+	decomp []ringqp.Poly
+	ct     *rlwe.Ciphertext
+}
+
+func getStoredRotationPlan(planHandle Handle4) *rotationPlan {
+	ref := marshal.CrossLangObjMap.Get(planHandle)
+	return (*rotationPlan)(ref.Ptr)
+}
+
+//export lattigo_newRotationPlan
+func lattigo_newRotationPlan(paramHandle Handle4, evalKeyHandle Handle4) Handle4 {
+	defer marshal.Track("lattigo_newRotationPlan").Done()
+	var params *ckks.Parameters
+	params = getStoredParameters(paramHandle)
+
+	var evalKey *rlwe.EvaluationKey
+	evalKey = getStoredEvaluationKey(evalKeyHandle)
+
+	// sized for ciphertexts at the maximum level, which also covers every lower level
+	decomp := make([]ringqp.Poly, params.DecompRNS(params.QCount()-1, params.PCount()-1))
+	ringQP := params.RingQP()
+	for i := range decomp {
+		decomp[i] = ringQP.NewPoly()
+	}
+
+	plan := &rotationPlan{params: *params, eval: rlwe.NewEvaluator(params.Parameters, evalKey), decomp: decomp}
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(plan))
+}
+
+// Decompose a ciphertext so that it can be rotated with lattigo_rotationPlanRotate.
+// The plan keeps a reference to the ciphertext, which must not be modified until
+// the next call to this function.
+//
+//export lattigo_rotationPlanDecompose
+func lattigo_rotationPlanDecompose(planHandle Handle4, ctHandle Handle4) {
+	defer marshal.Track("lattigo_rotationPlanDecompose").Done()
+	plan := getStoredRotationPlan(planHandle)
+	ct := getStoredCiphertext(ctHandle)
+	plan.eval.DecomposeNTT(ct.Level(), plan.params.PCount()-1, plan.params.PCount(), ct.Value[1], ct.IsNTT, plan.decomp)
+	plan.ct = ct
+}
+
+func (plan *rotationPlan) rotate(k int, ctOut *rlwe.Ciphertext) {
+	if plan.ct == nil {
+		panic(errors.New("RotationPlan has not decomposed a ciphertext"))
+	}
+	plan.eval.AutomorphismHoisted(plan.ct.Level(), plan.ct, plan.decomp, plan.params.GaloisElementForColumnRotationBy(k), ctOut)
+}
+
+// Rotate the most recently decomposed ciphertext by each of the `n` amounts in ks, writing
+// the results into the existing ciphertexts in outHandles.
+//
+//export lattigo_rotationPlanRotate
+func lattigo_rotationPlanRotate(planHandle Handle4, ks *C.constULong, outHandles *C.constULong, n uint64) {
+	defer marshal.Track("lattigo_rotationPlanRotate").Done()
+	plan := getStoredRotationPlan(planHandle)
+	ctOut := getStoredCiphertexts(outHandles, n)
+	size := unsafe.Sizeof(uint64(0))
+	for i := range ctOut {
+		k := *(*int)(unsafe.Pointer(uintptr(unsafe.Pointer(ks)) + size*uintptr(i)))
+		plan.rotate(k, ctOut[i])
+	}
+}
+
 //export lattigo_multByConst
 func lattigo_multByConst(evalHandle Handle4, ctInHandle Handle4, constant float64, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_multByConst").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -99,6 +238,7 @@ func lattigo_multByConst(evalHandle Handle4, ctInHandle Handle4, constant float6
 
 //export lattigo_addConst
 func lattigo_addConst(evalHandle Handle4, ctInHandle Handle4, constant float64, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_addConst").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -113,6 +253,7 @@ func lattigo_addConst(evalHandle Handle4, ctInHandle Handle4, constant float64,
 
 //export lattigo_rescale
 func lattigo_rescale(evalHandle Handle4, ctInHandle Handle4, scale float64, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_rescale").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -128,8 +269,52 @@ func lattigo_rescale(evalHandle Handle4, ctInHandle Handle4, scale float64, ctOu
 	}
 }
 
+// Evaluate the polynomial with the given coefficients on ctIn in a single call, using
+// Lattigo's depth-optimal baby-step giant-step (Paterson-Stockmeyer) scheduling. If
+// chebyshev is set, the coefficients are in the Chebyshev basis over the interval [a, b];
+// otherwise they are in the monomial basis and a and b are ignored. Lattigo evaluates a
+// Chebyshev polynomial on inputs in [-1, 1], so any other interval is first mapped to it
+// with a multiplication, an addition and a rescale, which consumes one more level unless
+// 2/(b-a) is an integer: Lattigo leaves an integer constant unscaled, so there is nothing to
+// rescale. The result has scale targetScale. The number of levels consumed is written to
+// levelsConsumed.
+//
+//export lattigo_evaluatePoly
+func lattigo_evaluatePoly(evalHandle Handle4, ctInHandle Handle4, coeffs *C.constDouble, numCoeffs uint64, chebyshev bool, a float64, b float64, targetScale float64, levelsConsumed *C.uint64_t) Handle4 {
+	defer marshal.Track("lattigo_evaluatePoly").Done()
+	var eval *ckks.Evaluator
+	eval = getStoredEvaluator(evalHandle)
+
+	var ctIn *rlwe.Ciphertext
+	ctIn = getStoredCiphertext(ctInHandle)
+
+	poly := ckks.NewPoly(CDoubleVecToGoComplex(coeffs, numCoeffs))
+	ctPoly := ctIn
+	if chebyshev {
+		poly.BasisType = ckks.Chebyshev
+		poly.A = a
+		poly.B = b
+		if a != -1 || b != 1 {
+			// x -> (2x - a - b) / (b - a)
+			ctPoly = (*eval).MultByConstNew(ctIn, 2/(b-a))
+			(*eval).AddConst(ctPoly, -(a+b)/(b-a), ctPoly)
+			if err := (*eval).Rescale(ctPoly, ctIn.Scale, ctPoly); err != nil {
+				panic(err)
+			}
+		}
+	}
+
+	ctOut, err := (*eval).EvaluatePoly(ctPoly, poly, rlwe.NewScale(targetScale))
+	if err != nil {
+		panic(err)
+	}
+	*levelsConsumed = C.uint64_t(ctIn.Level() - ctOut.Level())
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(ctOut))
+}
+
 //export lattigo_mulRelinNew
 func lattigo_mulRelinNew(evalHandle Handle4, op0Handle Handle4, op1Handle Handle4) Handle4 {
+	defer marshal.Track("lattigo_mulRelinNew").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -149,6 +334,7 @@ func lattigo_mulRelinNew(evalHandle Handle4, op0Handle Handle4, op1Handle Handle
 //
 //export lattigo_mulRelin
 func lattigo_mulRelin(evalHandle Handle4, op0Handle Handle4, op1Handle Handle4, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_mulRelin").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -168,6 +354,7 @@ func lattigo_mulRelin(evalHandle Handle4, op0Handle Handle4, op1Handle Handle4,
 //
 //export lattigo_mul
 func lattigo_mul(evalHandle Handle4, op0Handle Handle4, op1Handle Handle4, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_mul").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -187,6 +374,7 @@ func lattigo_mul(evalHandle Handle4, op0Handle Handle4, op1Handle Handle4, ctOut
 //
 //export lattigo_mulPlain
 func lattigo_mulPlain(evalHandle Handle4, ctInHandle Handle4, ptHandle Handle4, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_mulPlain").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -204,6 +392,7 @@ func lattigo_mulPlain(evalHandle Handle4, ctInHandle Handle4, ptHandle Handle4,
 
 //export lattigo_add
 func lattigo_add(evalHandle Handle4, op0Handle Handle4, op1Handle Handle4, outHandle Handle4) {
+	defer marshal.Track("lattigo_add").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -221,6 +410,7 @@ func lattigo_add(evalHandle Handle4, op0Handle Handle4, op1Handle Handle4, outHa
 
 //export lattigo_addPlain
 func lattigo_addPlain(evalHandle Handle4, ctInHandle Handle4, ptHandle Handle4, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_addPlain").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -238,6 +428,7 @@ func lattigo_addPlain(evalHandle Handle4, ctInHandle Handle4, ptHandle Handle4,
 
 //export lattigo_neg
 func lattigo_neg(evalHandle Handle4, ctInHandle Handle4, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_neg").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -252,6 +443,7 @@ func lattigo_neg(evalHandle Handle4, ctInHandle Handle4, ctOutHandle Handle4) {
 
 //export lattigo_sub
 func lattigo_sub(evalHandle Handle4, op0Handle Handle4, op1Handle Handle4, outHandle Handle4) {
+	defer marshal.Track("lattigo_sub").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -269,6 +461,7 @@ func lattigo_sub(evalHandle Handle4, op0Handle Handle4, op1Handle Handle4, outHa
 
 //export lattigo_subPlain
 func lattigo_subPlain(evalHandle Handle4, ctInHandle Handle4, ptHandle Handle4, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_subPlain").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -286,6 +479,7 @@ func lattigo_subPlain(evalHandle Handle4, ctInHandle Handle4, ptHandle Handle4,
 
 //export lattigo_dropLevel
 func lattigo_dropLevel(evalHandle Handle4, ctHandle Handle4, levels uint64) {
+	defer marshal.Track("lattigo_dropLevel").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -297,6 +491,7 @@ func lattigo_dropLevel(evalHandle Handle4, ctHandle Handle4, levels uint64) {
 
 //export lattigo_multByGaussianIntegerAndAdd
 func lattigo_multByGaussianIntegerAndAdd(evalHandle Handle4, ct0Handle Handle4, cReal int64, cImag int64, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_multByGaussianIntegerAndAdd").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -311,6 +506,7 @@ func lattigo_multByGaussianIntegerAndAdd(evalHandle Handle4, ct0Handle Handle4,
 
 //export lattigo_relinearize
 func lattigo_relinearize(evalHandle Handle4, ctInHandle Handle4, ctOutHandle Handle4) {
+	defer marshal.Track("lattigo_relinearize").Done()
 	var eval *ckks.Evaluator
 	eval = getStoredEvaluator(evalHandle)
 
@@ -325,9 +521,311 @@ func lattigo_relinearize(evalHandle Handle4, ctInHandle Handle4, ctOutHandle Han
 
 //export lattigo_switchKeys
 func lattigo_switchKeys(evalHandle, ctxInHandle, swkHandle, ctxOutHandle Handle4) {
+	defer marshal.Track("lattigo_switchKeys").Done()
 	eval := getStoredEvaluator(evalHandle)
 	swk := getStoredSwitchingKey(swkHandle)
 	ctxIn := getStoredCiphertext(ctxInHandle)
 	ctxOut := getStoredCiphertext(ctxOutHandle)
 	(*eval).SwitchKeys(ctxIn, swk, ctxOut)
 }
+
+// Run f and report its result (usually a handle) to C++ through the completion callback.
+// If callback is nil, f runs synchronously on the calling thread and its result is returned.
+// Otherwise, f runs on a new goroutine, and this function returns 0 immediately; if f
+// panics, the panic is reported to the callback as an error instead of ending the process.
+// Callers must resolve all handles *before* calling this function, since C++ may release
+// its references as soon as the asynchronous call returns.
+func runWithCompletion(callback C.completionCallback, ctx unsafe.Pointer, f func() uint64) uint64 {
+	if callback == nil {
+		return f()
+	}
+	go func() {
+		defer func() {
+			if r := recover(); r != nil {
+				msg := C.CString(fmt.Sprint(r))
+				defer C.free(unsafe.Pointer(msg))
+				C.callCompletionError(callback, ctx, msg)
+			}
+		}()
+		result := f()
+		C.callCompletion(callback, ctx, C.uint64_t(result))
+	}()
+	return 0
+}
+
+// Resolve an array of `n` ciphertext handles
+func getStoredCiphertexts(handles *C.constULong, n uint64) []*rlwe.Ciphertext {
+	cts := make([]*rlwe.Ciphertext, n)
+	size := unsafe.Sizeof(uint64(0))
+	basePtr := uintptr(unsafe.Pointer(handles))
+	for i := range cts {
+		cts[i] = getStoredCiphertext(*(*uint64)(unsafe.Pointer(basePtr + size*uintptr(i))))
+	}
+	return cts
+}
+
+// The number of goroutines runParallel uses for n work items when asked for `workers`
+func effectiveWorkers(n int, workers int) int {
+	if workers <= 0 {
+		workers = runtime.GOMAXPROCS(0)
+	}
+	if workers > n {
+		workers = n
+	}
+	return workers
+}
+
+// Call work(i) for every i in [0, n), spread across `workers` goroutines (one per available
+// CPU if workers is 0). newWorker(w) is called once for each worker w before it starts, so
+// that each worker can set up its own scratch state; worker 0 runs first. If a worker
+// panics, the others stop taking new items and the panic is raised again in the caller.
+func runParallel(n int, workers int, newWorker func(w int) func(i int)) {
+	workers = effectiveWorkers(n, workers)
+	if workers <= 1 {
+		work := newWorker(0)
+		for i := 0; i < n; i++ {
+			work(i)
+		}
+		return
+	}
+
+	// work items are handed out dynamically since operations on ciphertexts at different
+	// levels can take very different amounts of time
+	var next int64 = -1
+	var wg sync.WaitGroup
+	var failure interface{}
+	var failureOnce sync.Once
+	wg.Add(workers)
+	for w := 0; w < workers; w++ {
+		work := newWorker(w)
+		go func() {
+			defer wg.Done()
+			defer func() {
+				if r := recover(); r != nil {
+					failureOnce.Do(func() { failure = r })
+					atomic.StoreInt64(&next, int64(n))
+				}
+			}()
+			for i := int(atomic.AddInt64(&next, 1)); i < n; i = int(atomic.AddInt64(&next, 1)) {
+				work(i)
+			}
+		}()
+	}
+	wg.Wait()
+	if failure != nil {
+		panic(failure)
+	}
+}
+
+// Call f(eval, i) for every i in [0, n), spread across `workers` goroutines. The first
+// goroutine uses the evaluator itself and each of the others uses one of its cached shallow
+// copies, so all workers share the evaluation keys but not the evaluator's scratch buffers.
+// If workers is 0, one worker per available CPU is used.
+func parallelFor(eval *storedEvaluator, n int, workers int, f func(eval ckks.Evaluator, i int)) {
+	workers = effectiveWorkers(n, workers)
+	var copies []ckks.Evaluator
+	if workers > 1 {
+		copies = eval.takeCopies(workers - 1)
+		defer eval.returnCopies(copies)
+	}
+	runParallel(n, workers, func(w int) func(i int) {
+		workerEval := eval.eval
+		if w > 0 {
+			workerEval = copies[w-1]
+		}
+		return func(i int) {
+			f(workerEval, i)
+		}
+	})
+}
+
+//export lattigo_addBatch
+func lattigo_addBatch(evalHandle Handle4, op0Handles, op1Handles, outHandles *C.constULong, n uint64, workers uint64, callback C.completionCallback, ctx unsafe.Pointer) {
+	defer marshal.Track("lattigo_addBatch").Done()
+	eval := getStoredEvaluatorState(evalHandle)
+	ct0 := getStoredCiphertexts(op0Handles, n)
+	ct1 := getStoredCiphertexts(op1Handles, n)
+	ctOut := getStoredCiphertexts(outHandles, n)
+	runWithCompletion(callback, ctx, func() uint64 {
+		parallelFor(eval, int(n), int(workers), func(eval ckks.Evaluator, i int) {
+			eval.Add(ct0[i], ct1[i], ctOut[i])
+		})
+		return 0
+	})
+}
+
+//export lattigo_mulRelinBatch
+func lattigo_mulRelinBatch(evalHandle Handle4, op0Handles, op1Handles, outHandles *C.constULong, n uint64, workers uint64, callback C.completionCallback, ctx unsafe.Pointer) {
+	defer marshal.Track("lattigo_mulRelinBatch").Done()
+	eval := getStoredEvaluatorState(evalHandle)
+	ct0 := getStoredCiphertexts(op0Handles, n)
+	ct1 := getStoredCiphertexts(op1Handles, n)
+	ctOut := getStoredCiphertexts(outHandles, n)
+	runWithCompletion(callback, ctx, func() uint64 {
+		parallelFor(eval, int(n), int(workers), func(eval ckks.Evaluator, i int) {
+			eval.MulRelin(ct0[i], ct1[i], ctOut[i])
+		})
+		return 0
+	})
+}
+
+//export lattigo_multByConstBatch
+func lattigo_multByConstBatch(evalHandle Handle4, inHandles *C.constULong, constant float64, outHandles *C.constULong, n uint64, workers uint64, callback C.completionCallback, ctx unsafe.Pointer) {
+	defer marshal.Track("lattigo_multByConstBatch").Done()
+	eval := getStoredEvaluatorState(evalHandle)
+	ctIn := getStoredCiphertexts(inHandles, n)
+	ctOut := getStoredCiphertexts(outHandles, n)
+	runWithCompletion(callback, ctx, func() uint64 {
+		parallelFor(eval, int(n), int(workers), func(eval ckks.Evaluator, i int) {
+			eval.MultByConst(ctIn[i], constant, ctOut[i])
+		})
+		return 0
+	})
+}
+
+//export lattigo_rotateBatch
+func lattigo_rotateBatch(evalHandle Handle4, inHandles *C.constULong, k uint64, outHandles *C.constULong, n uint64, workers uint64, callback C.completionCallback, ctx unsafe.Pointer) {
+	defer marshal.Track("lattigo_rotateBatch").Done()
+	eval := getStoredEvaluatorState(evalHandle)
+	ctIn := getStoredCiphertexts(inHandles, n)
+	ctOut := getStoredCiphertexts(outHandles, n)
+	runWithCompletion(callback, ctx, func() uint64 {
+		parallelFor(eval, int(n), int(workers), func(eval ckks.Evaluator, i int) {
+			eval.Rotate(ctIn[i], int(k), ctOut[i])
+		})
+		return 0
+	})
+}
+
+//export lattigo_rescaleBatch
+func lattigo_rescaleBatch(evalHandle Handle4, inHandles *C.constULong, scale float64, outHandles *C.constULong, n uint64, workers uint64, callback C.completionCallback, ctx unsafe.Pointer) {
+	defer marshal.Track("lattigo_rescaleBatch").Done()
+	eval := getStoredEvaluatorState(evalHandle)
+	ctIn := getStoredCiphertexts(inHandles, n)
+	ctOut := getStoredCiphertexts(outHandles, n)
+	runWithCompletion(callback, ctx, func() uint64 {
+		parallelFor(eval, int(n), int(workers), func(eval ckks.Evaluator, i int) {
+			err := eval.Rescale(ctIn[i], rlwe.NewScale(scale), ctOut[i])
+			if err != nil {
+				panic(err)
+			}
+		})
+		return 0
+	})
+}
+
+// Opcodes for lattigo_executeCommands. These must match the CommandBuffer::Op
+// enum in latticpp/ckks/commandbuffer.h.
+const (
+	cmdAdd uint64 = iota
+	cmdAddPlain
+	cmdSub
+	cmdSubPlain
+	cmdNeg
+	cmdMul
+	cmdMulPlain
+	cmdMulRelin
+	cmdRelinearize
+	cmdMultByConst
+	cmdAddConst
+	cmdMultByGaussianIntegerAndAdd
+	cmdRescale
+	cmdRotate
+	cmdDropLevel
+)
+
+// Execute a list of evaluator operations recorded by a C++ CommandBuffer in a single call.
+// `handles` is the table of distinct handles referenced by the ops; each handle is resolved
+// exactly once. `ops` is a sequence of records of the form [opcode, args...], where
+// ciphertext and plaintext arguments are indices into `handles`, and floating-point
+// arguments are stored as their IEEE-754 bit pattern.
+//
+//export lattigo_executeCommands
+func lattigo_executeCommands(evalHandle Handle4, handles *C.constULong, numHandles uint64, ops *C.constULong, numOps uint64) {
+	defer marshal.Track("lattigo_executeCommands").Done()
+	var eval *ckks.Evaluator
+	eval = getStoredEvaluator(evalHandle)
+
+	size := unsafe.Sizeof(uint64(0))
+
+	objs := make([]unsafe.Pointer, numHandles)
+	basePtrHandles := uintptr(unsafe.Pointer(handles))
+	for i := range objs {
+		objs[i] = marshal.CrossLangObjMap.Get(*(*uint64)(unsafe.Pointer(basePtrHandles + size*uintptr(i)))).Ptr
+	}
+
+	basePtrOps := uintptr(unsafe.Pointer(ops))
+	pc := uint64(0)
+	next := func() uint64 {
+		if pc >= numOps {
+			panic(errors.New("truncated command buffer"))
+		}
+		w := *(*uint64)(unsafe.Pointer(basePtrOps + size*uintptr(pc)))
+		pc++
+		return w
+	}
+	ct := func() *rlwe.Ciphertext {
+		return (*rlwe.Ciphertext)(objs[next()])
+	}
+	pt := func() *rlwe.Plaintext {
+		return (*rlwe.Plaintext)(objs[next()])
+	}
+	float := func() float64 {
+		return math.Float64frombits(next())
+	}
+
+	for pc < numOps {
+		switch op := next(); op {
+		case cmdAdd:
+			ct0, ct1, ctOut := ct(), ct(), ct()
+			(*eval).Add(ct0, ct1, ctOut)
+		case cmdAddPlain:
+			ctIn, ptIn, ctOut := ct(), pt(), ct()
+			(*eval).Add(ctIn, ptIn, ctOut)
+		case cmdSub:
+			ct0, ct1, ctOut := ct(), ct(), ct()
+			(*eval).Sub(ct0, ct1, ctOut)
+		case cmdSubPlain:
+			ctIn, ptIn, ctOut := ct(), pt(), ct()
+			(*eval).Sub(ctIn, ptIn, ctOut)
+		case cmdNeg:
+			ctIn, ctOut := ct(), ct()
+			(*eval).Neg(ctIn, ctOut)
+		case cmdMul:
+			ct0, ct1, ctOut := ct(), ct(), ct()
+			(*eval).Mul(ct0, ct1, ctOut)
+		case cmdMulPlain:
+			ctIn, ptIn, ctOut := ct(), pt(), ct()
+			(*eval).Mul(ctIn, ptIn, ctOut)
+		case cmdMulRelin:
+			ct0, ct1, ctOut := ct(), ct(), ct()
+			(*eval).MulRelin(ct0, ct1, ctOut)
+		case cmdRelinearize:
+			ctIn, ctOut := ct(), ct()
+			(*eval).Relinearize(ctIn, ctOut)
+		case cmdMultByConst:
+			ctIn, constant, ctOut := ct(), float(), ct()
+			(*eval).MultByConst(ctIn, constant, ctOut)
+		case cmdAddConst:
+			ctIn, constant, ctOut := ct(), float(), ct()
+			(*eval).AddConst(ctIn, constant, ctOut)
+		case cmdMultByGaussianIntegerAndAdd:
+			ctIn, cReal, cImag, ctOut := ct(), int64(next()), int64(next()), ct()
+			(*eval).MultByGaussianIntegerAndAdd(ctIn, cReal, cImag, ctOut)
+		case cmdRescale:
+			ctIn, scale, ctOut := ct(), float(), ct()
+			err := (*eval).Rescale(ctIn, rlwe.NewScale(scale), ctOut)
+			if err != nil {
+				panic(err)
+			}
+		case cmdRotate:
+			ctIn, k, ctOut := ct(), int(next()), ct()
+			(*eval).Rotate(ctIn, k, ctOut)
+		case cmdDropLevel:
+			ctIn, levels := ct(), int(next())
+			(*eval).DropLevel(ctIn, levels)
+		default:
+			panic(errors.New("unknown command buffer opcode: " + strconv.FormatUint(op, 10)))
+		}
+	}
+}
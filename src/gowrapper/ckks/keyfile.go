@@ -0,0 +1,212 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+package ckks
+
+/*
+#include <stdint.h>
+typedef const uint64_t constULong;
+*/
+import "C"
+
+import (
+	"encoding/binary"
+	"errors"
+	"lattigo-cpp/marshal"
+	"os"
+	"runtime"
+	"strconv"
+	"sync"
+	"syscall"
+	"unsafe"
+
+	"github.com/tuneinsight/lattigo/v4/rlwe"
+)
+
+// https://github.com/golang/go/issues/35715#issuecomment-791039692
+type Handle17 = uint64
+
+// A rotation key file holds a set of switching keys together with an index from Galois
+// element to the location of each key in the file. All integers are big-endian uint64s.
+//
+//	magic | version | number of keys n
+//	n index entries: Galois element | offset of the key from the start of the file | length
+//	the keys, each serialized with SwitchingKey.MarshalBinary
+//
+// The file is memory-mapped when it is opened, and keys are only deserialized when they are
+// first requested, so opening a file is cheap no matter how many keys it holds, and only the
+// keys which are actually used take up memory. Since the mapping is shared and read-only,
+// processes which open the same file share its page cache.
+const (
+	keyFileMagic      = "LTCPKEYS"
+	keyFileVersion    = 1
+	keyFileHeaderSize = 24
+	keyFileEntrySize  = 24
+)
+
+type keyFileEntry struct {
+	offset uint64
+	length uint64
+}
+
+type rotationKeyFile struct {
+	data  []byte
+	index map[uint64]keyFileEntry
+	// deserialized keys, shared by every key set created from this file
+	lock   sync.Mutex
+	loaded map[uint64]*rlwe.SwitchingKey
+}
+
+func getStoredRotationKeyFile(fileHandle Handle17) *rotationKeyFile {
+	ref := marshal.CrossLangObjMap.Get(fileHandle)
+	return (*rotationKeyFile)(ref.Ptr)
+}
+
+// Build the header and index of a key file for the given keys, which will be written in
+// the order of galEls
+func rotationKeyFileHeader(rotkeys *rlwe.RotationKeySet, galEls []uint64) []byte {
+	header := make([]byte, keyFileHeaderSize+keyFileEntrySize*len(galEls))
+	copy(header[:8], keyFileMagic)
+	binary.BigEndian.PutUint64(header[8:], keyFileVersion)
+	binary.BigEndian.PutUint64(header[16:], uint64(len(galEls)))
+
+	offset := uint64(len(header))
+	for i, galEl := range galEls {
+		entry := header[keyFileHeaderSize+keyFileEntrySize*i:]
+		length := uint64(rotkeys.Keys[galEl].MarshalBinarySize())
+		binary.BigEndian.PutUint64(entry[0:], galEl)
+		binary.BigEndian.PutUint64(entry[8:], offset)
+		binary.BigEndian.PutUint64(entry[16:], length)
+		offset += length
+	}
+	return header
+}
+
+//export lattigo_openRotationKeyFile
+func lattigo_openRotationKeyFile(path *C.char) Handle17 {
+	defer marshal.Track("lattigo_openRotationKeyFile").Done()
+	f, err := os.Open(C.GoString(path))
+	if err != nil {
+		panic(err)
+	}
+	defer f.Close()
+
+	info, err := f.Stat()
+	if err != nil {
+		panic(err)
+	}
+	size := info.Size()
+	if size < keyFileHeaderSize || int64(int(size)) != size {
+		panic(errors.New("Invalid rotation key file: " + f.Name()))
+	}
+
+	data, err := syscall.Mmap(int(f.Fd()), 0, int(size), syscall.PROT_READ, syscall.MAP_SHARED)
+	if err != nil {
+		panic(err)
+	}
+
+	if string(data[:8]) != keyFileMagic || binary.BigEndian.Uint64(data[8:]) != keyFileVersion {
+		syscall.Munmap(data)
+		panic(errors.New("Invalid rotation key file: " + f.Name()))
+	}
+	n := binary.BigEndian.Uint64(data[16:])
+	if n > uint64(size-keyFileHeaderSize)/keyFileEntrySize {
+		syscall.Munmap(data)
+		panic(errors.New("Invalid rotation key file: " + f.Name()))
+	}
+
+	file := &rotationKeyFile{data: data, index: make(map[uint64]keyFileEntry, n), loaded: make(map[uint64]*rlwe.SwitchingKey)}
+	for i := uint64(0); i < n; i++ {
+		entry := data[keyFileHeaderSize+keyFileEntrySize*i:]
+		e := keyFileEntry{offset: binary.BigEndian.Uint64(entry[8:]), length: binary.BigEndian.Uint64(entry[16:])}
+		if e.offset > uint64(size) || e.length > uint64(size)-e.offset {
+			syscall.Munmap(data)
+			panic(errors.New("Invalid rotation key file: " + f.Name()))
+		}
+		file.index[binary.BigEndian.Uint64(entry[0:])] = e
+	}
+
+	// deserialized keys are copies, so the mapping can go as soon as the file object does
+	runtime.SetFinalizer(file, func(file *rotationKeyFile) {
+		syscall.Munmap(file.data)
+	})
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(file))
+}
+
+// Deserialize the key for galEl from the mapped file, or return the copy loaded earlier
+func (file *rotationKeyFile) get(galEl uint64) *rlwe.SwitchingKey {
+	file.lock.Lock()
+	defer file.lock.Unlock()
+
+	if key, ok := file.loaded[galEl]; ok {
+		return key
+	}
+	e, ok := file.index[galEl]
+	if !ok {
+		panic(errors.New("Rotation key file has no key for Galois element " + strconv.FormatUint(galEl, 10)))
+	}
+	key := new(rlwe.SwitchingKey)
+	if err := key.UnmarshalBinary(file.data[e.offset : e.offset+e.length]); err != nil {
+		panic(err)
+	}
+	file.loaded[galEl] = key
+	return key
+}
+
+//export lattigo_keyFileNumKeys
+func lattigo_keyFileNumKeys(fileHandle Handle17) uint64 {
+	defer marshal.Track("lattigo_keyFileNumKeys").Done()
+	return uint64(len(getStoredRotationKeyFile(fileHandle).index))
+}
+
+//export lattigo_keyFileGaloisElements
+func lattigo_keyFileGaloisElements(fileHandle Handle17, out *C.uint64_t) {
+	defer marshal.Track("lattigo_keyFileGaloisElements").Done()
+	file := getStoredRotationKeyFile(fileHandle)
+	galEls := cUint64s(unsafe.Pointer(out), uint64(len(file.index)))
+	i := 0
+	for galEl := range file.index {
+		galEls[i] = galEl
+		i++
+	}
+}
+
+//export lattigo_keyFileSwitchingKeyExist
+func lattigo_keyFileSwitchingKeyExist(fileHandle Handle17, galEl uint64) uint64 {
+	defer marshal.Track("lattigo_keyFileSwitchingKeyExist").Done()
+	if _, exist := getStoredRotationKeyFile(fileHandle).index[galEl]; exist {
+		return 1
+	}
+	return 0
+}
+
+//export lattigo_keyFileGetSwitchingKey
+func lattigo_keyFileGetSwitchingKey(fileHandle Handle17, galEl uint64) Handle17 {
+	defer marshal.Track("lattigo_keyFileGetSwitchingKey").Done()
+	file := getStoredRotationKeyFile(fileHandle)
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(file.get(galEl)))
+}
+
+// Create a rotation key set holding the keys for the given Galois elements, loading any which
+// have not been used yet. The switching keys are shared with every other set loaded from the
+// same file.
+//
+//export lattigo_keyFileRotationKeys
+func lattigo_keyFileRotationKeys(fileHandle Handle17, galEls *C.constULong, n uint64) Handle17 {
+	defer marshal.Track("lattigo_keyFileRotationKeys").Done()
+	file := getStoredRotationKeyFile(fileHandle)
+	rotKeys := &rlwe.RotationKeySet{Keys: make(map[uint64]*rlwe.SwitchingKey, n)}
+	for _, galEl := range cUint64s(unsafe.Pointer(galEls), n) {
+		rotKeys.Keys[galEl] = file.get(galEl)
+	}
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rotKeys))
+}
+
+//export lattigo_keyFileNumLoaded
+func lattigo_keyFileNumLoaded(fileHandle Handle17) uint64 {
+	defer marshal.Track("lattigo_keyFileNumLoaded").Done()
+	file := getStoredRotationKeyFile(fileHandle)
+	file.lock.Lock()
+	defer file.lock.Unlock()
+	return uint64(len(file.loaded))
+}
@@ -9,6 +9,8 @@ package ckks
 
 /*
 #include "stdint.h"
+#include "callback.h"
+
 struct Lattigo_KeyPairHandle {
   uint64_t sk;
   uint64_t pk;
@@ -70,6 +72,7 @@ func getStoredBootstrappingKey(bootKeyHandle Handle5) *bootstrapping.EvaluationK
 
 //export lattigo_newKeyGenerator
 func lattigo_newKeyGenerator(paramHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_newKeyGenerator").Done()
 	paramPtr := getStoredParameters(paramHandle)
 	var keyGenerator rlwe.KeyGenerator
 	keyGenerator = ckks.NewKeyGenerator(*paramPtr)
@@ -78,24 +81,28 @@ func lattigo_newKeyGenerator(paramHandle Handle5) Handle5 {
 
 //export lattigo_newSecretKey
 func lattigo_newSecretKey(paramHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_newSecretKey").Done()
 	paramPtr := getStoredParameters(paramHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rlwe.NewSecretKey((*paramPtr).Parameters)))
 }
 
 //export lattigo_newPublicKey
 func lattigo_newPublicKey(paramHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_newPublicKey").Done()
 	paramPtr := getStoredParameters(paramHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rlwe.NewPublicKey((*paramPtr).Parameters)))
 }
 
 //export lattigo_newRelinearizationKey
 func lattigo_newRelinearizationKey(paramHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_newRelinearizationKey").Done()
 	paramPtr := getStoredParameters(paramHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rlwe.NewRelinearizationKey((*paramPtr).Parameters, 1)))
 }
 
 //export lattigo_newRotationKeys
 func lattigo_newRotationKeys(paramHandle Handle5, galoisElements *C.uint64_t, galoisElementsLen uint64) Handle5 {
+	defer marshal.Track("lattigo_newRotationKeys").Done()
 	paramPtr := getStoredParameters(paramHandle)
 
 	galoisElementsTmp := make([]uint64, galoisElementsLen)
@@ -110,18 +117,21 @@ func lattigo_newRotationKeys(paramHandle Handle5, galoisElements *C.uint64_t, ga
 
 //export lattigo_genSecretKey
 func lattigo_genSecretKey(keygenHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_genSecretKey").Done()
 	keygen := getStoredKeyGenerator(keygenHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer((*keygen).GenSecretKey()))
 }
 
 //export lattigo_copyNewSecretKey
 func lattigo_copyNewSecretKey(skHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_copyNewSecretKey").Done()
 	sk := getStoredSecretKey(skHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(sk.CopyNew()))
 }
 
 //export lattigo_polyQPSecretKey
 func lattigo_polyQPSecretKey(skHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_polyQPSecretKey").Done()
 	sk := getStoredSecretKey(skHandle)
 	polyQP := sk.Value
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&polyQP))
@@ -129,6 +139,7 @@ func lattigo_polyQPSecretKey(skHandle Handle5) Handle5 {
 
 //export lattigo_genPublicKey
 func lattigo_genPublicKey(keygenHandle Handle5, skHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_genPublicKey").Done()
 	keygen := getStoredKeyGenerator(keygenHandle)
 	sk := getStoredSecretKey(skHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer((*keygen).GenPublicKey(sk)))
@@ -136,6 +147,7 @@ func lattigo_genPublicKey(keygenHandle Handle5, skHandle Handle5) Handle5 {
 
 //export lattigo_genKeyPair
 func lattigo_genKeyPair(keygenHandle Handle5) C.struct_Lattigo_KeyPairHandle {
+	defer marshal.Track("lattigo_genKeyPair").Done()
 	var keygen *rlwe.KeyGenerator
 	keygen = getStoredKeyGenerator(keygenHandle)
 	var sk *rlwe.SecretKey
@@ -149,6 +161,7 @@ func lattigo_genKeyPair(keygenHandle Handle5) C.struct_Lattigo_KeyPairHandle {
 
 //export lattigo_genKeyPairSparse
 func lattigo_genKeyPairSparse(keygenHandle Handle5, hw uint64) C.struct_Lattigo_KeyPairHandle {
+	defer marshal.Track("lattigo_genKeyPairSparse").Done()
 	var keygen *rlwe.KeyGenerator
 	keygen = getStoredKeyGenerator(keygenHandle)
 	var sk *rlwe.SecretKey
@@ -166,6 +179,7 @@ func lattigo_genKeyPairSparse(keygenHandle Handle5, hw uint64) C.struct_Lattigo_
 //
 //export lattigo_genRelinearizationKey
 func lattigo_genRelinearizationKey(keygenHandle Handle5, skHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_genRelinearizationKey").Done()
 	var keygen *rlwe.KeyGenerator
 	keygen = getStoredKeyGenerator(keygenHandle)
 	var sk *rlwe.SecretKey
@@ -178,6 +192,7 @@ func lattigo_genRelinearizationKey(keygenHandle Handle5, skHandle Handle5) Handl
 //
 //export lattigo_genRotationKeysForRotations
 func lattigo_genRotationKeysForRotations(keygenHandle Handle5, skHandle Handle5, ks *C.int64_t, ksLen uint64) Handle5 {
+	defer marshal.Track("lattigo_genRotationKeysForRotations").Done()
 	var keygen *rlwe.KeyGenerator
 	keygen = getStoredKeyGenerator(keygenHandle)
 
@@ -198,8 +213,32 @@ func lattigo_genRotationKeysForRotations(keygenHandle Handle5, skHandle Handle5,
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rotKeys))
 }
 
+// Same as lattigo_genRotationKeysForRotations, but the keys are generated on a new goroutine
+// and the handle of the result is passed to the completion callback. The key generator must
+// not be used by any other call until then.
+//
+//export lattigo_genRotationKeysForRotationsAsync
+func lattigo_genRotationKeysForRotationsAsync(keygenHandle Handle5, skHandle Handle5, ks *C.int64_t, ksLen uint64, callback C.completionCallback, ctx unsafe.Pointer) {
+	defer marshal.Track("lattigo_genRotationKeysForRotationsAsync").Done()
+	keygen := getStoredKeyGenerator(keygenHandle)
+	sk := getStoredSecretKey(skHandle)
+
+	rotations := make([]int, ksLen)
+	size := unsafe.Sizeof(uint64(0))
+	basePtrIn := uintptr(unsafe.Pointer(ks))
+	for i := range rotations {
+		rotations[i] = int(*(*int64)(unsafe.Pointer(basePtrIn + size*uintptr(i))))
+	}
+
+	runWithCompletion(callback, ctx, func() uint64 {
+		rotKeys := (*keygen).GenRotationKeysForRotations(rotations, false, sk)
+		return marshal.CrossLangObjMap.Add(unsafe.Pointer(rotKeys))
+	})
+}
+
 //export lattigo_getSwitchingKey
 func lattigo_getSwitchingKey(switchingKeyHandle Handle5, galEl uint64) Handle5 {
+	defer marshal.Track("lattigo_getSwitchingKey").Done()
 	rotKeys := getStoredRotationKeys(switchingKeyHandle)
 	rotationKey := rotKeys.Keys[galEl]
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rotationKey))
@@ -207,6 +246,7 @@ func lattigo_getSwitchingKey(switchingKeyHandle Handle5, galEl uint64) Handle5 {
 
 //export lattigo_setSwitchingKey
 func lattigo_setSwitchingKey(rotKeysHandle, switchingKeyHandle Handle5, galEl uint64) {
+	defer marshal.Track("lattigo_setSwitchingKey").Done()
 	rotKeys := getStoredRotationKeys(rotKeysHandle)
 	rotKey := getStoredSwitchingKey(switchingKeyHandle)
 	rotKeys.Keys[galEl] = rotKey
@@ -214,6 +254,7 @@ func lattigo_setSwitchingKey(rotKeysHandle, switchingKeyHandle Handle5, galEl ui
 
 //export lattigo_switchingKeyExist
 func lattigo_switchingKeyExist(switchingKeyHandle Handle5, galEl uint64) uint64 {
+	defer marshal.Track("lattigo_switchingKeyExist").Done()
 	rotKeys := getStoredRotationKeys(switchingKeyHandle)
 	_, exist := rotKeys.Keys[galEl]
 	if exist {
@@ -225,12 +266,14 @@ func lattigo_switchingKeyExist(switchingKeyHandle Handle5, galEl uint64) uint64
 
 //export lattigo_getNumSwitchingKeys
 func lattigo_getNumSwitchingKeys(rotKeysHandle Handle5) uint64 {
+	defer marshal.Track("lattigo_getNumSwitchingKeys").Done()
 	rotKeys := getStoredRotationKeys(rotKeysHandle)
 	return uint64(len(rotKeys.Keys))
 }
 
 //export lattigo_getGaloisElementsOfRotationKeys
 func lattigo_getGaloisElementsOfRotationKeys(rotKeysHandle Handle5, outValues *C.uint64_t) {
+	defer marshal.Track("lattigo_getGaloisElementsOfRotationKeys").Done()
 	rotKeys := getStoredRotationKeys(rotKeysHandle)
 	galoisElements := make([]uint64, len(rotKeys.Keys))
 
@@ -249,24 +292,28 @@ func lattigo_getGaloisElementsOfRotationKeys(rotKeysHandle Handle5, outValues *C
 
 //export lattigo_copyNewSwitchingKey
 func lattigo_copyNewSwitchingKey(switchingKeyHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_copyNewSwitchingKey").Done()
 	rotKey := getStoredSwitchingKey(switchingKeyHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rotKey.CopyNew()))
 }
 
 //export lattigo_numOfDecomp
 func lattigo_numOfDecomp(switchingKeyHandle Handle5) uint64 {
+	defer marshal.Track("lattigo_numOfDecomp").Done()
 	rotKey := getStoredSwitchingKey(switchingKeyHandle)
 	return uint64(len(rotKey.Value))
 }
 
 //export lattigo_galoisElementForColumnRotationBy
 func lattigo_galoisElementForColumnRotationBy(paramHandle Handle5, rotationStep uint64) uint64 {
+	defer marshal.Track("lattigo_galoisElementForColumnRotationBy").Done()
 	param := getStoredParameters(paramHandle)
 	return uint64(param.GaloisElementForColumnRotationBy(int(rotationStep)))
 }
 
 //export lattigo_switchingKeyIsCorrect
 func lattigo_switchingKeyIsCorrect(switchingKeyHandle Handle5, galEl uint64, skHandle Handle5, paramHandle Handle5, log2Bound uint64) uint64 {
+	defer marshal.Track("lattigo_switchingKeyIsCorrect").Done()
 	rotKey := getStoredSwitchingKey(switchingKeyHandle)
 	sk := getStoredSecretKey(skHandle)
 	param := getStoredParameters(paramHandle)
@@ -282,12 +329,14 @@ func lattigo_switchingKeyIsCorrect(switchingKeyHandle Handle5, galEl uint64, skH
 
 //export lattigo_getCiphertextQP
 func lattigo_getCiphertextQP(switchingKeyHandle Handle5, i, j uint64) Handle5 {
+	defer marshal.Track("lattigo_getCiphertextQP").Done()
 	rotKey := getStoredSwitchingKey(switchingKeyHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&(rotKey.Value[i][j])))
 }
 
 //export lattigo_setCiphertextQP
 func lattigo_setCiphertextQP(switchingKeyHandle, ctQPHandle Handle5, i, j uint64) {
+	defer marshal.Track("lattigo_setCiphertextQP").Done()
 	rotKey := getStoredSwitchingKey(switchingKeyHandle)
 	ctQP := getStoredCiphertextQP(ctQPHandle)
 	rotKey.Value[i][j] = *ctQP
@@ -295,6 +344,7 @@ func lattigo_setCiphertextQP(switchingKeyHandle, ctQPHandle Handle5, i, j uint64
 
 //export lattigo_makeEvaluationKeyOnlyRelin
 func lattigo_makeEvaluationKeyOnlyRelin(relinKeyHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_makeEvaluationKeyOnlyRelin").Done()
 	var relinKey *rlwe.RelinearizationKey
 	relinKey = getStoredRelinKey(relinKeyHandle)
 
@@ -306,6 +356,7 @@ func lattigo_makeEvaluationKeyOnlyRelin(relinKeyHandle Handle5) Handle5 {
 
 //export lattigo_makeEvaluationKey
 func lattigo_makeEvaluationKey(relinKeyHandle Handle5, rotKeyHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_makeEvaluationKey").Done()
 	var relinKey *rlwe.RelinearizationKey
 	relinKey = getStoredRelinKey(relinKeyHandle)
 
@@ -320,23 +371,27 @@ func lattigo_makeEvaluationKey(relinKeyHandle Handle5, rotKeyHandle Handle5) Han
 
 //export lattigo_makeEmptyEvaluationKey
 func lattigo_makeEmptyEvaluationKey() Handle5 {
+	defer marshal.Track("lattigo_makeEmptyEvaluationKey").Done()
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&rlwe.EvaluationKey{}))
 }
 
 //export lattigo_setRelinKeyForEvaluationKey
 func lattigo_setRelinKeyForEvaluationKey(evalKeyHandle Handle5, relinKeyHandle Handle5) {
+	defer marshal.Track("lattigo_setRelinKeyForEvaluationKey").Done()
 	evalKey := getStoredEvaluationKey(evalKeyHandle)
 	evalKey.Rlk = getStoredRelinKey(relinKeyHandle)
 }
 
 //export lattigo_setRotKeysForEvaluationKey
 func lattigo_setRotKeysForEvaluationKey(evalKeyHandle Handle5, rotKeysHandle Handle5) {
+	defer marshal.Track("lattigo_setRotKeysForEvaluationKey").Done()
 	evalKey := getStoredEvaluationKey(evalKeyHandle)
 	evalKey.Rtks = getStoredRotationKeys(rotKeysHandle)
 }
 
 //export lattigo_genBootstrappingKey
 func lattigo_genBootstrappingKey(keygenHandle Handle5, paramHandle Handle5, btpParamsHandle Handle5, skHandle Handle5, relinKeyHandle Handle5, rotKeyHandle Handle5) Handle5 {
+	defer marshal.Track("lattigo_genBootstrappingKey").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 
@@ -352,8 +407,25 @@ func lattigo_genBootstrappingKey(keygenHandle Handle5, paramHandle Handle5, btpP
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&btpKey))
 }
 
+// Same as lattigo_genBootstrappingKey, but the key is generated on a new goroutine
+// and the handle of the result is passed to the completion callback.
+//
+//export lattigo_genBootstrappingKeyAsync
+func lattigo_genBootstrappingKeyAsync(paramHandle Handle5, btpParamsHandle Handle5, skHandle Handle5, callback C.completionCallback, ctx unsafe.Pointer) {
+	defer marshal.Track("lattigo_genBootstrappingKeyAsync").Done()
+	params := getStoredParameters(paramHandle)
+	btpParams := getStoredBootstrappingParameters(btpParamsHandle)
+	sk := getStoredSecretKey(skHandle)
+
+	runWithCompletion(callback, ctx, func() uint64 {
+		btpKey := bootstrapping.GenEvaluationKeys(*btpParams, *params, sk)
+		return marshal.CrossLangObjMap.Add(unsafe.Pointer(&btpKey))
+	})
+}
+
 //export lattigo_newSwitchingKey
 func lattigo_newSwitchingKey(paramsHandle Handle5, levelQ, levelP uint64) Handle5 {
+	defer marshal.Track("lattigo_newSwitchingKey").Done()
 	params := getStoredParameters(paramsHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rlwe.NewSwitchingKey(params.Parameters, int(levelQ), int(levelP))))
 }
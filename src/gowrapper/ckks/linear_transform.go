@@ -0,0 +1,114 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+package ckks
+
+/*
+#include <stdint.h>
+typedef const double constDouble;
+typedef const int64_t constLong;
+*/
+import "C"
+
+import (
+	"lattigo-cpp/marshal"
+	"unsafe"
+
+	"github.com/tuneinsight/lattigo/v4/ckks"
+	"github.com/tuneinsight/lattigo/v4/rlwe"
+)
+
+// https://github.com/golang/go/issues/35715#issuecomment-791039692
+type Handle16 = uint64
+
+func getStoredLinearTransform(ltHandle Handle16) *ckks.LinearTransform {
+	ref := marshal.CrossLangObjMap.Get(ltHandle)
+	return (*ckks.LinearTransform)(ref.Ptr)
+}
+
+// Encode the non-zero diagonals of a plaintext matrix for evaluation with the baby-step
+// giant-step algorithm. Diagonal i has index diagIndices[i], and diagValues[i] points
+// to its 2^logSlots values.
+//
+//export lattigo_newLinearTransform
+func lattigo_newLinearTransform(encoderHandle Handle16, diagIndices *C.constLong, numDiags uint64, diagValues **C.constDouble, logSlots uint64, level uint64, scale float64, logBSGSRatio uint64) Handle16 {
+	defer marshal.Track("lattigo_newLinearTransform").Done()
+	var encoder *ckks.Encoder
+	encoder = getStoredEncoder(encoderHandle)
+
+	slots := uint64(1) << logSlots
+	diags := make(map[int][]complex128, numDiags)
+	idxSize := unsafe.Sizeof(int64(0))
+	ptrSize := unsafe.Sizeof(uintptr(0))
+	for i := uintptr(0); i < uintptr(numDiags); i++ {
+		idx := *(*int64)(unsafe.Pointer(uintptr(unsafe.Pointer(diagIndices)) + idxSize*i))
+		values := *(**C.constDouble)(unsafe.Pointer(uintptr(unsafe.Pointer(diagValues)) + ptrSize*i))
+		diags[int(idx)] = CDoubleVecToGoComplex(values, slots)
+	}
+
+	var lt ckks.LinearTransform
+	lt = ckks.GenLinearTransformBSGS(*encoder, diags, int(level), rlwe.NewScale(scale), int(logBSGSRatio), int(logSlots))
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&lt))
+}
+
+//export lattigo_linearTransformLevel
+func lattigo_linearTransformLevel(ltHandle Handle16) uint64 {
+	defer marshal.Track("lattigo_linearTransformLevel").Done()
+	return uint64(getStoredLinearTransform(ltHandle).Level)
+}
+
+//export lattigo_linearTransformNumRotations
+func lattigo_linearTransformNumRotations(ltHandle Handle16) uint64 {
+	defer marshal.Track("lattigo_linearTransformNumRotations").Done()
+	return uint64(len(getStoredLinearTransform(ltHandle).Rotations()))
+}
+
+// Write the rotations needed to evaluate the transform to `out`, which must have room
+// for lattigo_linearTransformNumRotations values.
+//
+//export lattigo_linearTransformRotations
+func lattigo_linearTransformRotations(ltHandle Handle16, out *C.int64_t) {
+	defer marshal.Track("lattigo_linearTransformRotations").Done()
+	rotations := getStoredLinearTransform(ltHandle).Rotations()
+	size := unsafe.Sizeof(int64(0))
+	for i := range rotations {
+		*(*int64)(unsafe.Pointer(uintptr(unsafe.Pointer(out)) + size*uintptr(i))) = int64(rotations[i])
+	}
+}
+
+// Like lattigo_linearTransformRotations, but writes the corresponding Galois elements
+//
+//export lattigo_linearTransformGaloisElements
+func lattigo_linearTransformGaloisElements(paramHandle Handle16, ltHandle Handle16, out *C.uint64_t) {
+	defer marshal.Track("lattigo_linearTransformGaloisElements").Done()
+	var params *ckks.Parameters
+	params = getStoredParameters(paramHandle)
+
+	rotations := getStoredLinearTransform(ltHandle).Rotations()
+	size := unsafe.Sizeof(uint64(0))
+	for i := range rotations {
+		*(*uint64)(unsafe.Pointer(uintptr(unsafe.Pointer(out)) + size*uintptr(i))) = params.GaloisElementForColumnRotationBy(rotations[i])
+	}
+}
+
+// Evaluate the transform on ctIn. The evaluator's evaluation key must contain a rotation
+// key for every rotation reported by lattigo_linearTransformRotations. The result is not
+// rescaled: its scale is the product of the scales of ctIn and the transform.
+//
+//export lattigo_linearTransform
+func lattigo_linearTransform(evalHandle Handle16, ltHandle Handle16, ctInHandle Handle16, ctOutHandle Handle16) {
+	defer marshal.Track("lattigo_linearTransform").Done()
+	var eval *ckks.Evaluator
+	eval = getStoredEvaluator(evalHandle)
+
+	var lt *ckks.LinearTransform
+	lt = getStoredLinearTransform(ltHandle)
+
+	var ctIn *rlwe.Ciphertext
+	ctIn = getStoredCiphertext(ctInHandle)
+
+	var ctOut *rlwe.Ciphertext
+	ctOut = getStoredCiphertext(ctOutHandle)
+
+	(*eval).LinearTransform(ctIn, *lt, []*rlwe.Ciphertext{ctOut})
+}
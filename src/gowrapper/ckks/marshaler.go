@@ -6,31 +6,106 @@ package ckks
 /*
 #include <stdint.h>
 typedef void (*streamWriter) (void*, void*, uint64_t);
+typedef uint64_t (*streamReader) (void*, void*, uint64_t);
 
 // https://golang.org/cmd/cgo/#hdr-Go_references_to_C
 // https://nelkinda.com/blog/suppress-warnings-in-gcc-and-clang/
 __attribute__((unused)) static void callStreamWriter(streamWriter f, void* stream, void* data, uint64_t len) {
   f(stream, data, len);
 }
+
+__attribute__((unused)) static uint64_t callStreamReader(streamReader f, void* stream, void* data, uint64_t len) {
+  return f(stream, data, len);
+}
 */
 import "C"
 
 import (
+	"encoding/binary"
 	"errors"
 	"lattigo-cpp/marshal"
+	"math"
+	"math/bits"
 	"reflect"
+	"sort"
 	"unsafe"
 
 	"github.com/tuneinsight/lattigo/v4/ckks"
 	"github.com/tuneinsight/lattigo/v4/ckks/bootstrapping"
+	"github.com/tuneinsight/lattigo/v4/drlwe"
+	"github.com/tuneinsight/lattigo/v4/ring"
 	"github.com/tuneinsight/lattigo/v4/rlwe"
+	"github.com/tuneinsight/lattigo/v4/rlwe/ringqp"
 )
 
 // https://github.com/golang/go/issues/35715#issuecomment-791039692
 type Handle9 = uint64
 
+// Serialized objects are passed to the C++ stream in chunks of at most this many bytes
+const streamChunkSize = 1 << 20
+
+func writeChunked(callback C.streamWriter, stream *C.void, data []byte) {
+	for len(data) > 0 {
+		n := len(data)
+		if n > streamChunkSize {
+			n = streamChunkSize
+		}
+		C.callStreamWriter(callback, unsafe.Pointer(stream), unsafe.Pointer(&data[0]), C.uint64_t(n))
+		data = data[n:]
+	}
+}
+
+// Size of the header written before each rotation key: its Galois element, followed by its
+// size if the keys are size-prefixed
+func rotationKeyHeaderSize(sizePrefixed bool) int {
+	if sizePrefixed {
+		return 16
+	}
+	return 8
+}
+
+// Encode one rotation key and its header into out, which holds exactly the header and the key
+func encodeRotationKey(galEl uint64, key *rlwe.SwitchingKey, sizePrefixed bool, out []byte) {
+	headerSize := rotationKeyHeaderSize(sizePrefixed)
+	binary.BigEndian.PutUint64(out[:8], galEl)
+	if sizePrefixed {
+		binary.BigEndian.PutUint64(out[8:16], uint64(len(out)-headerSize))
+	}
+	if _, err := key.Encode(out[headerSize:]); err != nil {
+		panic(err)
+	}
+}
+
+// Write a rotation key set in the format of RotationKeySet.MarshalBinary, but one key at a
+// time: each key is encoded into a single reused buffer and streamed out before the next one
+// is encoded. This keeps the extra memory needed to that of the largest switching key, rather
+// than that of the whole set (which can be tens of GB). Keys are written in map order, just as
+// MarshalBinary does. If sizePrefixed is set, each Galois element is followed by the size of
+// its key, so that the keys can be read back one at a time (see readBootstrappingKey).
+func streamRotationKeys(rotkeys *rlwe.RotationKeySet, sizePrefixed bool, callback C.streamWriter, stream *C.void) {
+	var buf []byte
+	for galEl, key := range rotkeys.Keys {
+		size := rotationKeyHeaderSize(sizePrefixed) + key.MarshalBinarySize()
+		if cap(buf) < size {
+			buf = make([]byte, size)
+		}
+		buf = buf[:size]
+		encodeRotationKey(galEl, key, sizePrefixed, buf)
+		writeChunked(callback, stream, buf)
+	}
+}
+
+// Write a length-prefixed section of a composite object
+func writeSection(callback C.streamWriter, stream *C.void, data []byte) {
+	var prefix [8]byte
+	binary.BigEndian.PutUint64(prefix[:], uint64(len(data)))
+	writeChunked(callback, stream, prefix[:])
+	writeChunked(callback, stream, data)
+}
+
 //export lattigo_marshalBinaryCiphertext
 func lattigo_marshalBinaryCiphertext(ctHandle Handle9, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_marshalBinaryCiphertext").Done()
 	var ct *rlwe.Ciphertext
 	ct = getStoredCiphertext(ctHandle)
 
@@ -39,13 +114,12 @@ func lattigo_marshalBinaryCiphertext(ctHandle Handle9, callback C.streamWriter,
 		panic(err)
 	}
 
-	if len(data) > 0 {
-		C.callStreamWriter(callback, unsafe.Pointer(stream), unsafe.Pointer(&data[0]), C.uint64_t(len(data)))
-	}
+	writeChunked(callback, stream, data)
 }
 
 //export lattigo_marshalBinaryParameters
 func lattigo_marshalBinaryParameters(paramsHandle Handle9, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_marshalBinaryParameters").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramsHandle)
 
@@ -54,13 +128,12 @@ func lattigo_marshalBinaryParameters(paramsHandle Handle9, callback C.streamWrit
 		panic(err)
 	}
 
-	if len(data) > 0 {
-		C.callStreamWriter(callback, unsafe.Pointer(stream), unsafe.Pointer(&data[0]), C.uint64_t(len(data)))
-	}
+	writeChunked(callback, stream, data)
 }
 
 //export lattigo_marshalBinaryBootstrapParameters
 func lattigo_marshalBinaryBootstrapParameters(paramsHandle Handle9, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_marshalBinaryBootstrapParameters").Done()
 	var params *bootstrapping.Parameters
 	params = getStoredBootstrappingParameters(paramsHandle)
 
@@ -69,13 +142,12 @@ func lattigo_marshalBinaryBootstrapParameters(paramsHandle Handle9, callback C.s
 		panic(err)
 	}
 
-	if len(data) > 0 {
-		C.callStreamWriter(callback, unsafe.Pointer(stream), unsafe.Pointer(&data[0]), C.uint64_t(len(data)))
-	}
+	writeChunked(callback, stream, data)
 }
 
 //export lattigo_marshalBinarySecretKey
 func lattigo_marshalBinarySecretKey(skHandle Handle9, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_marshalBinarySecretKey").Done()
 	var sk *rlwe.SecretKey
 	sk = getStoredSecretKey(skHandle)
 
@@ -84,13 +156,12 @@ func lattigo_marshalBinarySecretKey(skHandle Handle9, callback C.streamWriter, s
 		panic(err)
 	}
 
-	if len(data) > 0 {
-		C.callStreamWriter(callback, unsafe.Pointer(stream), unsafe.Pointer(&data[0]), C.uint64_t(len(data)))
-	}
+	writeChunked(callback, stream, data)
 }
 
 //export lattigo_marshalBinaryPublicKey
 func lattigo_marshalBinaryPublicKey(pkHandle Handle9, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_marshalBinaryPublicKey").Done()
 	var pk *rlwe.PublicKey
 	pk = getStoredPublicKey(pkHandle)
 
@@ -99,13 +170,12 @@ func lattigo_marshalBinaryPublicKey(pkHandle Handle9, callback C.streamWriter, s
 		panic(err)
 	}
 
-	if len(data) > 0 {
-		C.callStreamWriter(callback, unsafe.Pointer(stream), unsafe.Pointer(&data[0]), C.uint64_t(len(data)))
-	}
+	writeChunked(callback, stream, data)
 }
 
 //export lattigo_marshalBinaryRelinearizationKey
 func lattigo_marshalBinaryRelinearizationKey(relinKeyHandle Handle9, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_marshalBinaryRelinearizationKey").Done()
 	var relinKey *rlwe.RelinearizationKey
 	relinKey = getStoredRelinKey(relinKeyHandle)
 
@@ -114,23 +184,87 @@ func lattigo_marshalBinaryRelinearizationKey(relinKeyHandle Handle9, callback C.
 		panic(err)
 	}
 
-	if len(data) > 0 {
-		C.callStreamWriter(callback, unsafe.Pointer(stream), unsafe.Pointer(&data[0]), C.uint64_t(len(data)))
-	}
+	writeChunked(callback, stream, data)
 }
 
 //export lattigo_marshalBinaryRotationKeys
 func lattigo_marshalBinaryRotationKeys(rotkeyHandle Handle9, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_marshalBinaryRotationKeys").Done()
 	var rotkeys *rlwe.RotationKeySet
 	rotkeys = getStoredRotationKeys(rotkeyHandle)
 
-	data, err := rotkeys.MarshalBinary()
-	if err != nil {
-		panic(err)
+	streamRotationKeys(rotkeys, false, callback, stream)
+}
+
+func sortedGaloisElements(rotkeys *rlwe.RotationKeySet) []uint64 {
+	galEls := make([]uint64, 0, len(rotkeys.Keys))
+	for galEl := range rotkeys.Keys {
+		galEls = append(galEls, galEl)
 	}
+	sort.Slice(galEls, func(i, j int) bool { return galEls[i] < galEls[j] })
+	return galEls
+}
 
-	if len(data) > 0 {
-		C.callStreamWriter(callback, unsafe.Pointer(stream), unsafe.Pointer(&data[0]), C.uint64_t(len(data)))
+// Write rotation keys in the indexed key file format described in keyfile.go, which can be
+// opened with lattigo_openRotationKeyFile. Keys are written in order of Galois element, one
+// at a time.
+//
+//export lattigo_writeRotationKeyFile
+func lattigo_writeRotationKeyFile(rotkeyHandle Handle9, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_writeRotationKeyFile").Done()
+	var rotkeys *rlwe.RotationKeySet
+	rotkeys = getStoredRotationKeys(rotkeyHandle)
+
+	galEls := sortedGaloisElements(rotkeys)
+	writeChunked(callback, stream, rotationKeyFileHeader(rotkeys, galEls))
+	for _, galEl := range galEls {
+		data, err := rotkeys.Keys[galEl].MarshalBinary()
+		if err != nil {
+			panic(err)
+		}
+		writeChunked(callback, stream, data)
+	}
+}
+
+// Bootstrapping keys are written as four sections: the relinearization key, the rotation keys,
+// and the two ring-switching keys. Each section is prefixed with its length as a big-endian
+// uint64, and is empty if the corresponding key is absent. The rotation keys are streamed one
+// key at a time, as in lattigo_marshalBinaryRotationKeys, except that each Galois element is
+// followed by the size of its key so that they can be read back one at a time too.
+//
+//export lattigo_marshalBinaryBootstrappingKey
+func lattigo_marshalBinaryBootstrappingKey(btpKeyHandle Handle9, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_marshalBinaryBootstrappingKey").Done()
+	var btpKey *bootstrapping.EvaluationKeys
+	btpKey = getStoredBootstrappingKey(btpKeyHandle)
+
+	var rlkData []byte
+	if btpKey.Rlk != nil {
+		var err error
+		if rlkData, err = btpKey.Rlk.MarshalBinary(); err != nil {
+			panic(err)
+		}
+	}
+	writeSection(callback, stream, rlkData)
+
+	var prefix [8]byte
+	if btpKey.Rtks != nil {
+		binary.BigEndian.PutUint64(prefix[:], uint64(sizePrefixedRotationKeys{btpKey.Rtks}.MarshalBinarySize()))
+		writeChunked(callback, stream, prefix[:])
+		streamRotationKeys(btpKey.Rtks, true, callback, stream)
+	} else {
+		writeSection(callback, stream, nil)
+	}
+
+	for _, swk := range []*rlwe.SwitchingKey{btpKey.SwkDtS, btpKey.SwkStD} {
+		var data []byte
+		if swk != nil {
+			var err error
+			if data, err = swk.MarshalBinary(); err != nil {
+				panic(err)
+			}
+		}
+		writeSection(callback, stream, data)
 	}
 }
 
@@ -180,6 +314,7 @@ func unsafeCPtrToSlice(buf *C.char, len uint64) []byte {
 
 //export lattigo_unmarshalBinaryCiphertext
 func lattigo_unmarshalBinaryCiphertext(buf *C.char, len uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryCiphertext").Done()
 	var serializedBytes []byte = unsafeCPtrToSlice(buf, len)
 
 	ct := new(rlwe.Ciphertext)
@@ -192,6 +327,7 @@ func lattigo_unmarshalBinaryCiphertext(buf *C.char, len uint64) Handle9 {
 
 //export lattigo_unmarshalBinaryParameters
 func lattigo_unmarshalBinaryParameters(buf *C.char, len uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryParameters").Done()
 	var serializedBytes []byte = unsafeCPtrToSlice(buf, len)
 
 	params := new(ckks.Parameters)
@@ -204,6 +340,7 @@ func lattigo_unmarshalBinaryParameters(buf *C.char, len uint64) Handle9 {
 
 //export lattigo_unmarshalBinaryBootstrapParameters
 func lattigo_unmarshalBinaryBootstrapParameters(buf *C.char, len uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryBootstrapParameters").Done()
 	var serializedBytes []byte = unsafeCPtrToSlice(buf, len)
 
 	params := new(bootstrapping.Parameters)
@@ -217,6 +354,7 @@ func lattigo_unmarshalBinaryBootstrapParameters(buf *C.char, len uint64) Handle9
 
 //export lattigo_unmarshalBinarySecretKey
 func lattigo_unmarshalBinarySecretKey(buf *C.char, len uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinarySecretKey").Done()
 	var serializedBytes []byte = unsafeCPtrToSlice(buf, len)
 
 	sk := new(rlwe.SecretKey)
@@ -229,6 +367,7 @@ func lattigo_unmarshalBinarySecretKey(buf *C.char, len uint64) Handle9 {
 
 //export lattigo_unmarshalBinaryPublicKey
 func lattigo_unmarshalBinaryPublicKey(buf *C.char, len uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryPublicKey").Done()
 	var serializedBytes []byte = unsafeCPtrToSlice(buf, len)
 
 	pk := new(rlwe.PublicKey)
@@ -241,6 +380,7 @@ func lattigo_unmarshalBinaryPublicKey(buf *C.char, len uint64) Handle9 {
 
 //export lattigo_unmarshalBinaryRelinearizationKey
 func lattigo_unmarshalBinaryRelinearizationKey(buf *C.char, len uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryRelinearizationKey").Done()
 	var serializedBytes []byte = unsafeCPtrToSlice(buf, len)
 
 	relinKey := new(rlwe.RelinearizationKey)
@@ -253,6 +393,7 @@ func lattigo_unmarshalBinaryRelinearizationKey(buf *C.char, len uint64) Handle9
 
 //export lattigo_unmarshalBinaryRotationKeys
 func lattigo_unmarshalBinaryRotationKeys(buf *C.char, len uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryRotationKeys").Done()
 	var serializedBytes []byte = unsafeCPtrToSlice(buf, len)
 
 	rotkeys := new(rlwe.RotationKeySet)
@@ -263,8 +404,311 @@ func lattigo_unmarshalBinaryRotationKeys(buf *C.char, len uint64) Handle9 {
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rotkeys))
 }
 
+// Read one length-prefixed section written by writeSection, returning the section and the rest
+func readSection(data []byte) (section []byte, rest []byte) {
+	if len(data) < 8 {
+		panic(errors.New("Truncated serialized object"))
+	}
+	size := binary.BigEndian.Uint64(data[:8])
+	if uint64(len(data)-8) < size {
+		panic(errors.New("Truncated serialized object"))
+	}
+	return data[8 : 8+size], data[8+size:]
+}
+
+// Where readBootstrappingKey reads a serialized bootstrapping key from
+type byteSource interface {
+	// Return the next n bytes, which are only valid until the next call
+	next(n uint64) []byte
+}
+
+type bufferSource struct {
+	data []byte
+}
+
+func (s *bufferSource) next(n uint64) []byte {
+	if uint64(len(s.data)) < n {
+		panic(errors.New("Truncated serialized object"))
+	}
+	out := s.data[:n]
+	s.data = s.data[n:]
+	return out
+}
+
+// Reads from a C++ stream into a single reused buffer, which grows to the largest request
+type streamSource struct {
+	callback C.streamReader
+	stream   *C.void
+	buf      []byte
+}
+
+func (s *streamSource) next(n uint64) []byte {
+	if uint64(cap(s.buf)) < n {
+		s.buf = make([]byte, n)
+	}
+	s.buf = s.buf[:n]
+	for read := 0; read < len(s.buf); {
+		got := C.callStreamReader(s.callback, unsafe.Pointer(s.stream), unsafe.Pointer(&s.buf[read]), C.uint64_t(len(s.buf)-read))
+		if got == 0 {
+			panic(errors.New("Truncated serialized object"))
+		}
+		read += int(got)
+	}
+	return s.buf
+}
+
+// Read a bootstrapping key written by lattigo_marshalBinaryBootstrappingKey. The rotation keys
+// are decoded one at a time, so reading from a stream needs memory for a single serialized key
+// rather than for the whole bootstrapping key.
+func readBootstrappingKey(src byteSource) *bootstrapping.EvaluationKeys {
+	btpKey := new(bootstrapping.EvaluationKeys)
+	readSize := func() uint64 {
+		return binary.BigEndian.Uint64(src.next(8))
+	}
+
+	if size := readSize(); size > 0 {
+		btpKey.Rlk = new(rlwe.RelinearizationKey)
+		if err := btpKey.Rlk.UnmarshalBinary(src.next(size)); err != nil {
+			panic(err)
+		}
+	}
+
+	if size := readSize(); size > 0 {
+		btpKey.Rtks = &rlwe.RotationKeySet{Keys: make(map[uint64]*rlwe.SwitchingKey)}
+		for size > 0 {
+			if size < 16 {
+				panic(errors.New("Truncated serialized object"))
+			}
+			header := src.next(16)
+			galEl := binary.BigEndian.Uint64(header[:8])
+			keySize := binary.BigEndian.Uint64(header[8:])
+			if keySize > size-16 {
+				panic(errors.New("Truncated serialized object"))
+			}
+			key := new(rlwe.SwitchingKey)
+			if err := key.UnmarshalBinary(src.next(keySize)); err != nil {
+				panic(err)
+			}
+			btpKey.Rtks.Keys[galEl] = key
+			size -= 16 + keySize
+		}
+	}
+
+	for _, swk := range []**rlwe.SwitchingKey{&btpKey.SwkDtS, &btpKey.SwkStD} {
+		if size := readSize(); size > 0 {
+			*swk = new(rlwe.SwitchingKey)
+			if err := (*swk).UnmarshalBinary(src.next(size)); err != nil {
+				panic(err)
+			}
+		}
+	}
+	return btpKey
+}
+
+//export lattigo_unmarshalBinaryBootstrappingKey
+func lattigo_unmarshalBinaryBootstrappingKey(buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryBootstrappingKey").Done()
+	btpKey := readBootstrappingKey(&bufferSource{unsafeCPtrToSlice(buf, length)})
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(btpKey))
+}
+
+// Read a bootstrapping key from a C++ stream, which the callback reads like istream::read,
+// returning the number of bytes read. Only the bytes of the key are consumed.
+//
+//export lattigo_readBinaryBootstrappingKey
+func lattigo_readBinaryBootstrappingKey(callback C.streamReader, stream *C.void) Handle9 {
+	defer marshal.Track("lattigo_readBinaryBootstrappingKey").Done()
+	btpKey := readBootstrappingKey(&streamSource{callback: callback, stream: stream})
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(btpKey))
+}
+
+// Seeded objects (see seeded.go) are written as a section holding the seed followed by their
+// non-random components. A ciphertext is written as its degree-0 part; a key as a header section
+// and then two sections (Q and P) for each b component. The a components are expanded from the
+// seed when the object is read back. Each function returns 0, having written nothing, if the
+// object has no seed or has been modified since it was seeded.
+
+//export lattigo_marshalBinarySeededCiphertext
+func lattigo_marshalBinarySeededCiphertext(ctHandle Handle9, callback C.streamWriter, stream *C.void) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySeededCiphertext").Done()
+	var ct *rlwe.Ciphertext
+	ct = getStoredCiphertext(ctHandle)
+
+	seed := storedSeed(uintptr(unsafe.Pointer(ct)), ciphertextFingerprint(ct))
+	if seed == nil {
+		return 0
+	}
+	data, err := (&rlwe.Ciphertext{MetaData: ct.MetaData, Value: ct.Value[:1]}).MarshalBinary()
+	if err != nil {
+		panic(err)
+	}
+
+	writeSection(callback, stream, seed)
+	writeChunked(callback, stream, data)
+	return 1
+}
+
+func writeSeededKey(callback C.streamWriter, stream *C.void, seed []byte, header []uint64, parts []*[2]ringqp.Poly) {
+	headerBytes := make([]byte, 8*len(header))
+	for i, v := range header {
+		binary.BigEndian.PutUint64(headerBytes[8*i:], v)
+	}
+	writeSection(callback, stream, seed)
+	writeSection(callback, stream, headerBytes)
+
+	for _, part := range parts {
+		data, err := part[0].Q.MarshalBinary()
+		if err != nil {
+			panic(err)
+		}
+		writeSection(callback, stream, data)
+
+		data = nil
+		if part[0].P != nil {
+			if data, err = part[0].P.MarshalBinary(); err != nil {
+				panic(err)
+			}
+		}
+		writeSection(callback, stream, data)
+	}
+}
+
+//export lattigo_marshalBinarySeededPublicKey
+func lattigo_marshalBinarySeededPublicKey(pkHandle Handle9, callback C.streamWriter, stream *C.void) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySeededPublicKey").Done()
+	var pk *rlwe.PublicKey
+	pk = getStoredPublicKey(pkHandle)
+
+	parts := publicKeyParts(pk)
+	seed := storedSeed(uintptr(unsafe.Pointer(pk)), keyFingerprint(parts))
+	if seed == nil {
+		return 0
+	}
+	writeSeededKey(callback, stream, seed, nil, parts)
+	return 1
+}
+
+//export lattigo_marshalBinarySeededRelinearizationKey
+func lattigo_marshalBinarySeededRelinearizationKey(relinKeyHandle Handle9, callback C.streamWriter, stream *C.void) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySeededRelinearizationKey").Done()
+	var rlk *rlwe.RelinearizationKey
+	rlk = getStoredRelinKey(relinKeyHandle)
+
+	parts := relinKeyParts(rlk)
+	seed := storedSeed(uintptr(unsafe.Pointer(rlk)), keyFingerprint(parts))
+	if seed == nil {
+		return 0
+	}
+	writeSeededKey(callback, stream, seed, []uint64{uint64(len(rlk.Keys))}, parts)
+	return 1
+}
+
+//export lattigo_marshalBinarySeededRotationKeys
+func lattigo_marshalBinarySeededRotationKeys(rotkeyHandle Handle9, callback C.streamWriter, stream *C.void) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySeededRotationKeys").Done()
+	var rotkeys *rlwe.RotationKeySet
+	rotkeys = getStoredRotationKeys(rotkeyHandle)
+
+	parts := rotationKeyParts(rotkeys)
+	seed := storedSeed(uintptr(unsafe.Pointer(rotkeys)), keyFingerprint(parts))
+	if seed == nil {
+		return 0
+	}
+	writeSeededKey(callback, stream, seed, sortedGaloisElements(rotkeys), parts)
+	return 1
+}
+
+//export lattigo_unmarshalBinarySeededCiphertext
+func lattigo_unmarshalBinarySeededCiphertext(paramHandle Handle9, buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinarySeededCiphertext").Done()
+	var serializedBytes []byte = unsafeCPtrToSlice(buf, length)
+
+	seed, serializedBytes := readSection(serializedBytes)
+	ct := new(rlwe.Ciphertext)
+	if err := ct.UnmarshalBinary(serializedBytes); err != nil {
+		panic(err)
+	}
+	// the seed is kept after the buffer is gone
+	expandCiphertext(getStoredParameters(paramHandle), append([]byte(nil), seed...), ct)
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(ct))
+}
+
+func readSeededKeyHeader(data []byte) (seed []byte, header []uint64, rest []byte) {
+	seed, rest = readSection(data)
+	headerBytes, rest := readSection(rest)
+	header = make([]uint64, len(headerBytes)/8)
+	for i := range header {
+		header[i] = binary.BigEndian.Uint64(headerBytes[8*i:])
+	}
+	return append([]byte(nil), seed...), header, rest
+}
+
+// Read the b components of a key allocated from its header, then expand its a components
+func readSeededKeyParts(params *ckks.Parameters, seed []byte, parts []*[2]ringqp.Poly, data []byte) {
+	var section []byte
+	for _, part := range parts {
+		section, data = readSection(data)
+		if err := part[0].Q.UnmarshalBinary(section); err != nil {
+			panic(err)
+		}
+		section, data = readSection(data)
+		if part[0].P != nil {
+			if err := part[0].P.UnmarshalBinary(section); err != nil {
+				panic(err)
+			}
+		}
+	}
+	if len(data) != 0 {
+		panic(errors.New("Seeded key does not match the parameters"))
+	}
+	expandKey(params, seed, parts)
+}
+
+//export lattigo_unmarshalBinarySeededPublicKey
+func lattigo_unmarshalBinarySeededPublicKey(paramHandle Handle9, buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinarySeededPublicKey").Done()
+	params := getStoredParameters(paramHandle)
+	seed, _, rest := readSeededKeyHeader(unsafeCPtrToSlice(buf, length))
+
+	pk := rlwe.NewPublicKey(params.Parameters)
+	parts := publicKeyParts(pk)
+	readSeededKeyParts(params, seed, parts, rest)
+	recordSeed(pk, uintptr(unsafe.Pointer(pk)), seed, keyFingerprint(parts))
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(pk))
+}
+
+//export lattigo_unmarshalBinarySeededRelinearizationKey
+func lattigo_unmarshalBinarySeededRelinearizationKey(paramHandle Handle9, buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinarySeededRelinearizationKey").Done()
+	params := getStoredParameters(paramHandle)
+	seed, header, rest := readSeededKeyHeader(unsafeCPtrToSlice(buf, length))
+	if len(header) != 1 {
+		panic(errors.New("Malformed seeded relinearization key"))
+	}
+
+	rlk := rlwe.NewRelinearizationKey(params.Parameters, int(header[0]))
+	parts := relinKeyParts(rlk)
+	readSeededKeyParts(params, seed, parts, rest)
+	recordSeed(rlk, uintptr(unsafe.Pointer(rlk)), seed, keyFingerprint(parts))
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rlk))
+}
+
+//export lattigo_unmarshalBinarySeededRotationKeys
+func lattigo_unmarshalBinarySeededRotationKeys(paramHandle Handle9, buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinarySeededRotationKeys").Done()
+	params := getStoredParameters(paramHandle)
+	seed, galEls, rest := readSeededKeyHeader(unsafeCPtrToSlice(buf, length))
+
+	rotkeys := rlwe.NewRotationKeySet(params.Parameters, galEls)
+	parts := rotationKeyParts(rotkeys)
+	readSeededKeyParts(params, seed, parts, rest)
+	recordSeed(rotkeys, uintptr(unsafe.Pointer(rotkeys)), seed, keyFingerprint(parts))
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(rotkeys))
+}
+
 //export lattigo_marshalBinarySizeCiphertext
 func lattigo_marshalBinarySizeCiphertext(ctHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeCiphertext").Done()
 	var ct *rlwe.Ciphertext
 	ct = getStoredCiphertext(ctHandle)
 	return uint64(ct.MarshalBinarySize())
@@ -272,6 +716,7 @@ func lattigo_marshalBinarySizeCiphertext(ctHandle Handle9) uint64 {
 
 //export lattigo_marshalBinarySizeParameters
 func lattigo_marshalBinarySizeParameters(paramsHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeParameters").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramsHandle)
 	paramBytes, err := params.MarshalBinary()
@@ -283,6 +728,7 @@ func lattigo_marshalBinarySizeParameters(paramsHandle Handle9) uint64 {
 
 //export lattigo_marshalBinarySizeSecretKey
 func lattigo_marshalBinarySizeSecretKey(skHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeSecretKey").Done()
 	var sk *rlwe.SecretKey
 	sk = getStoredSecretKey(skHandle)
 	return uint64(sk.MarshalBinarySize())
@@ -290,6 +736,7 @@ func lattigo_marshalBinarySizeSecretKey(skHandle Handle9) uint64 {
 
 //export lattigo_marshalBinarySizePublicKey
 func lattigo_marshalBinarySizePublicKey(pkHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizePublicKey").Done()
 	var pk *rlwe.PublicKey
 	pk = getStoredPublicKey(pkHandle)
 	return uint64(pk.MarshalBinarySize())
@@ -297,6 +744,7 @@ func lattigo_marshalBinarySizePublicKey(pkHandle Handle9) uint64 {
 
 //export lattigo_marshalBinarySizeRelinearizationKey
 func lattigo_marshalBinarySizeRelinearizationKey(relinKeyHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeRelinearizationKey").Done()
 	var relinKey *rlwe.RelinearizationKey
 	relinKey = getStoredRelinKey(relinKeyHandle)
 	return uint64(relinKey.MarshalBinarySize())
@@ -304,7 +752,513 @@ func lattigo_marshalBinarySizeRelinearizationKey(relinKeyHandle Handle9) uint64
 
 //export lattigo_marshalBinarySizeRotationKeys
 func lattigo_marshalBinarySizeRotationKeys(rotkeysHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeRotationKeys").Done()
 	var rotkeys *rlwe.RotationKeySet
 	rotkeys = getStoredRotationKeys(rotkeysHandle)
 	return uint64(rotkeys.MarshalBinarySize())
 }
+
+// Objects are serialized into caller memory in the same format as the stream marshalers. The
+// caller sizes the buffer with the matching lattigo_marshalBinarySize export. Objects which
+// can encode into a given slice (ciphertexts, switching keys, rotation key sets) are written in
+// place; the others are marshaled by Lattigo and copied. Each lattigo_marshalInto export returns
+// the size of the serialized object, and writes nothing if that exceeds the buffer, so that an
+// object which can only be sized by marshaling it (such as a dckks share) is marshaled once.
+
+type binaryMarshaler interface {
+	MarshalBinary() ([]byte, error)
+}
+
+func binarySize(obj binaryMarshaler) uint64 {
+	if sized, ok := obj.(interface{ MarshalBinarySize() int }); ok {
+		return uint64(sized.MarshalBinarySize())
+	}
+	data, err := obj.MarshalBinary()
+	if err != nil {
+		panic(err)
+	}
+	return uint64(len(data))
+}
+
+// Rotation key sets are encoded one key at a time, as in streamRotationKeys
+func encodeRotationKeysInto(rotkeys *rlwe.RotationKeySet, sizePrefixed bool, out []byte) {
+	for galEl, key := range rotkeys.Keys {
+		size := rotationKeyHeaderSize(sizePrefixed) + key.MarshalBinarySize()
+		encodeRotationKey(galEl, key, sizePrefixed, out[:size])
+		out = out[size:]
+	}
+}
+
+// The rotation keys of a bootstrapping key, which are written with the size of each key
+// (see lattigo_marshalBinaryBootstrappingKey)
+type sizePrefixedRotationKeys struct {
+	*rlwe.RotationKeySet
+}
+
+func (k sizePrefixedRotationKeys) MarshalBinarySize() int {
+	return k.RotationKeySet.MarshalBinarySize() + 8*len(k.Keys)
+}
+
+func (k sizePrefixedRotationKeys) MarshalBinary() ([]byte, error) {
+	data := make([]byte, k.MarshalBinarySize())
+	encodeRotationKeysInto(k.RotationKeySet, true, data)
+	return data, nil
+}
+
+// Serialize obj into out, which must hold exactly binarySize(obj) bytes
+func encodeInto(obj binaryMarshaler, out []byte) {
+	switch o := obj.(type) {
+	case *rlwe.RotationKeySet:
+		encodeRotationKeysInto(o, false, out)
+		return
+	case sizePrefixedRotationKeys:
+		encodeRotationKeysInto(o.RotationKeySet, true, out)
+		return
+	case interface{ Encode([]byte) (int, error) }:
+		if _, err := o.Encode(out); err != nil {
+			panic(err)
+		}
+		return
+	}
+	data, err := obj.MarshalBinary()
+	if err != nil {
+		panic(err)
+	}
+	copy(out, data)
+}
+
+func marshalInto(obj binaryMarshaler, buf *C.char, length uint64) uint64 {
+	if _, ok := obj.(interface{ MarshalBinarySize() int }); !ok {
+		data, err := obj.MarshalBinary()
+		if err != nil {
+			panic(err)
+		}
+		size := uint64(len(data))
+		if size <= length {
+			copy(unsafeCPtrToSlice(buf, size), data)
+		}
+		return size
+	}
+	size := binarySize(obj)
+	if size <= length {
+		encodeInto(obj, unsafeCPtrToSlice(buf, size))
+	}
+	return size
+}
+
+// A plaintext is serialized as a degree-0 ciphertext
+func plaintextAsCiphertext(pt *rlwe.Plaintext) *rlwe.Ciphertext {
+	return &rlwe.Ciphertext{MetaData: pt.MetaData, Value: []*ring.Poly{pt.Value}}
+}
+
+// The sections of a bootstrapping key, in the order of lattigo_marshalBinaryBootstrappingKey.
+// Absent keys are nil.
+func bootstrappingKeySections(btpKey *bootstrapping.EvaluationKeys) []binaryMarshaler {
+	sections := make([]binaryMarshaler, 4)
+	if btpKey.Rlk != nil {
+		sections[0] = btpKey.Rlk
+	}
+	if btpKey.Rtks != nil {
+		sections[1] = sizePrefixedRotationKeys{btpKey.Rtks}
+	}
+	if btpKey.SwkDtS != nil {
+		sections[2] = btpKey.SwkDtS
+	}
+	if btpKey.SwkStD != nil {
+		sections[3] = btpKey.SwkStD
+	}
+	return sections
+}
+
+func bootstrappingKeySize(btpKey *bootstrapping.EvaluationKeys) uint64 {
+	var size uint64
+	for _, section := range bootstrappingKeySections(btpKey) {
+		size += 8
+		if section != nil {
+			size += binarySize(section)
+		}
+	}
+	return size
+}
+
+//export lattigo_marshalBinarySizePlaintext
+func lattigo_marshalBinarySizePlaintext(ptHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizePlaintext").Done()
+	return binarySize(plaintextAsCiphertext(getStoredPlaintext(ptHandle)))
+}
+
+//export lattigo_marshalBinarySizeSwitchingKey
+func lattigo_marshalBinarySizeSwitchingKey(swkHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeSwitchingKey").Done()
+	return binarySize(getStoredSwitchingKey(swkHandle))
+}
+
+//export lattigo_marshalBinarySizeBootstrappingKey
+func lattigo_marshalBinarySizeBootstrappingKey(btpKeyHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeBootstrappingKey").Done()
+	return bootstrappingKeySize(getStoredBootstrappingKey(btpKeyHandle))
+}
+
+//export lattigo_marshalBinarySizeCKGShare
+func lattigo_marshalBinarySizeCKGShare(shareHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeCKGShare").Done()
+	return binarySize(getStoredCKGShare(shareHandle))
+}
+
+//export lattigo_marshalBinarySizeRKGShare
+func lattigo_marshalBinarySizeRKGShare(shareHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeRKGShare").Done()
+	return binarySize(getStoredRKGShare(shareHandle))
+}
+
+//export lattigo_marshalBinarySizeCKSShare
+func lattigo_marshalBinarySizeCKSShare(shareHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeCKSShare").Done()
+	return binarySize(getStoredCKSShare(shareHandle))
+}
+
+//export lattigo_marshalBinarySizeRTGShare
+func lattigo_marshalBinarySizeRTGShare(shareHandle Handle9) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizeRTGShare").Done()
+	return binarySize(getStoredRTGShare(shareHandle))
+}
+
+//export lattigo_marshalIntoBinaryCiphertext
+func lattigo_marshalIntoBinaryCiphertext(ctHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryCiphertext").Done()
+	return marshalInto(getStoredCiphertext(ctHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinaryParameters
+func lattigo_marshalIntoBinaryParameters(paramsHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryParameters").Done()
+	return marshalInto(getStoredParameters(paramsHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinarySecretKey
+func lattigo_marshalIntoBinarySecretKey(skHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinarySecretKey").Done()
+	return marshalInto(getStoredSecretKey(skHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinaryPublicKey
+func lattigo_marshalIntoBinaryPublicKey(pkHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryPublicKey").Done()
+	return marshalInto(getStoredPublicKey(pkHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinaryRelinearizationKey
+func lattigo_marshalIntoBinaryRelinearizationKey(relinKeyHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryRelinearizationKey").Done()
+	return marshalInto(getStoredRelinKey(relinKeyHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinaryRotationKeys
+func lattigo_marshalIntoBinaryRotationKeys(rotkeysHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryRotationKeys").Done()
+	return marshalInto(getStoredRotationKeys(rotkeysHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinaryPlaintext
+func lattigo_marshalIntoBinaryPlaintext(ptHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryPlaintext").Done()
+	return marshalInto(plaintextAsCiphertext(getStoredPlaintext(ptHandle)), buf, length)
+}
+
+//export lattigo_marshalIntoBinarySwitchingKey
+func lattigo_marshalIntoBinarySwitchingKey(swkHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinarySwitchingKey").Done()
+	return marshalInto(getStoredSwitchingKey(swkHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinaryBootstrappingKey
+func lattigo_marshalIntoBinaryBootstrappingKey(btpKeyHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryBootstrappingKey").Done()
+	btpKey := getStoredBootstrappingKey(btpKeyHandle)
+	size := bootstrappingKeySize(btpKey)
+	if size > length {
+		return size
+	}
+
+	out := unsafeCPtrToSlice(buf, size)
+	for _, section := range bootstrappingKeySections(btpKey) {
+		var sectionSize uint64
+		if section != nil {
+			sectionSize = binarySize(section)
+			encodeInto(section, out[8:8+sectionSize])
+		}
+		binary.BigEndian.PutUint64(out[:8], sectionSize)
+		out = out[8+sectionSize:]
+	}
+	return size
+}
+
+//export lattigo_marshalIntoBinaryCKGShare
+func lattigo_marshalIntoBinaryCKGShare(shareHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryCKGShare").Done()
+	return marshalInto(getStoredCKGShare(shareHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinaryRKGShare
+func lattigo_marshalIntoBinaryRKGShare(shareHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryRKGShare").Done()
+	return marshalInto(getStoredRKGShare(shareHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinaryCKSShare
+func lattigo_marshalIntoBinaryCKSShare(shareHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryCKSShare").Done()
+	return marshalInto(getStoredCKSShare(shareHandle), buf, length)
+}
+
+//export lattigo_marshalIntoBinaryRTGShare
+func lattigo_marshalIntoBinaryRTGShare(shareHandle Handle9, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryRTGShare").Done()
+	return marshalInto(getStoredRTGShare(shareHandle), buf, length)
+}
+
+//export lattigo_unmarshalBinaryPlaintext
+func lattigo_unmarshalBinaryPlaintext(buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryPlaintext").Done()
+	ct := new(rlwe.Ciphertext)
+	if err := ct.UnmarshalBinary(unsafeCPtrToSlice(buf, length)); err != nil {
+		panic(err)
+	}
+	if ct.Degree() != 0 {
+		panic(errors.New("Serialized object is not a plaintext"))
+	}
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&rlwe.Plaintext{MetaData: ct.MetaData, Value: ct.Value[0]}))
+}
+
+//export lattigo_unmarshalBinarySwitchingKey
+func lattigo_unmarshalBinarySwitchingKey(buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinarySwitchingKey").Done()
+	swk := new(rlwe.SwitchingKey)
+	if err := swk.UnmarshalBinary(unsafeCPtrToSlice(buf, length)); err != nil {
+		panic(err)
+	}
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(swk))
+}
+
+//export lattigo_unmarshalBinaryCKGShare
+func lattigo_unmarshalBinaryCKGShare(buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryCKGShare").Done()
+	share := new(drlwe.CKGShare)
+	if err := share.UnmarshalBinary(unsafeCPtrToSlice(buf, length)); err != nil {
+		panic(err)
+	}
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(share))
+}
+
+//export lattigo_unmarshalBinaryRKGShare
+func lattigo_unmarshalBinaryRKGShare(buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryRKGShare").Done()
+	share := new(drlwe.RKGShare)
+	if err := share.UnmarshalBinary(unsafeCPtrToSlice(buf, length)); err != nil {
+		panic(err)
+	}
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(share))
+}
+
+//export lattigo_unmarshalBinaryCKSShare
+func lattigo_unmarshalBinaryCKSShare(buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryCKSShare").Done()
+	share := new(drlwe.CKSShare)
+	if err := share.UnmarshalBinary(unsafeCPtrToSlice(buf, length)); err != nil {
+		panic(err)
+	}
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(share))
+}
+
+//export lattigo_unmarshalBinaryRTGShare
+func lattigo_unmarshalBinaryRTGShare(buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryRTGShare").Done()
+	share := new(drlwe.RTGShare)
+	if err := share.UnmarshalBinary(unsafeCPtrToSlice(buf, length)); err != nil {
+		panic(err)
+	}
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(share))
+}
+
+// Packed ciphertexts are a compact wire format for ciphertexts which are sent rather than
+// stored. The ciphertext is first truncated to at most the requested level by dropping RNS
+// limbs, which for CKKS is a modulus switch that leaves the message and scale unchanged. Each
+// coefficient of limb i is then written with ceil(log2 qi) bits rather than 64. The format is
+//
+//	version (1 byte) | degree (1 byte) | level (1 byte) | flags (1 byte, bit 0: IsNTT)
+//	scale as a big-endian float64
+//	the coefficients of each limb of each polynomial as one little-endian bit stream
+//
+// The scale is carried as a float64, and reading a packed ciphertext needs the parameters.
+const (
+	packedVersion    = 2
+	packedHeaderSize = 12
+)
+
+func packedLevel(ct *rlwe.Ciphertext, maxLevel uint64) int {
+	if uint64(ct.Level()) < maxLevel {
+		return ct.Level()
+	}
+	return int(maxLevel)
+}
+
+func packedWidths(params *ckks.Parameters, level int) []uint {
+	widths := make([]uint, level+1)
+	for i, qi := range params.Q()[:level+1] {
+		widths[i] = uint(bits.Len64(qi - 1))
+	}
+	return widths
+}
+
+func packedSize(params *ckks.Parameters, degree int, level int) uint64 {
+	var limbBits uint64
+	for _, w := range packedWidths(params, level) {
+		limbBits += uint64(w)
+	}
+	return packedHeaderSize + (uint64(degree+1)*uint64(params.N())*limbBits+7)/8
+}
+
+// Writes values of up to 64 bits to a little-endian bit stream, one 64-bit word at a time
+type bitWriter struct {
+	out []byte
+	acc uint64
+	n   uint
+}
+
+func (w *bitWriter) write(v uint64, width uint) {
+	w.acc |= v << w.n
+	if w.n+width < 64 {
+		w.n += width
+		return
+	}
+	binary.LittleEndian.PutUint64(w.out, w.acc)
+	w.out = w.out[8:]
+	// shifting by 64 yields 0, so this is also right when the word was filled exactly
+	w.acc = v >> (64 - w.n)
+	w.n = w.n + width - 64
+}
+
+func (w *bitWriter) flush() {
+	for i := uint(0); i < w.n; i += 8 {
+		w.out[i/8] = byte(w.acc >> i)
+	}
+}
+
+type bitReader struct {
+	in  []byte
+	acc uint64
+	n   uint
+}
+
+func (r *bitReader) read(width uint) uint64 {
+	mask := uint64(1)<<width - 1
+	if r.n >= width {
+		v := r.acc & mask
+		r.acc >>= width
+		r.n -= width
+		return v
+	}
+	var next uint64
+	if len(r.in) >= 8 {
+		next = binary.LittleEndian.Uint64(r.in)
+		r.in = r.in[8:]
+	} else {
+		for i := range r.in {
+			next |= uint64(r.in[i]) << (8 * uint(i))
+		}
+		r.in = nil
+	}
+	v := (r.acc | next<<r.n) & mask
+	r.acc = next >> (width - r.n)
+	r.n = 64 - (width - r.n)
+	return v
+}
+
+func packCiphertext(params *ckks.Parameters, ct *rlwe.Ciphertext, level int, out []byte) {
+	out[0] = packedVersion
+	out[1] = byte(ct.Degree())
+	out[2] = byte(level)
+	out[3] = 0
+	if ct.IsNTT {
+		out[3] = 1
+	}
+	binary.BigEndian.PutUint64(out[4:], math.Float64bits(ct.GetScale().Float64()))
+
+	widths := packedWidths(params, level)
+	w := bitWriter{out: out[packedHeaderSize:]}
+	for _, poly := range ct.Value {
+		for i, width := range widths {
+			for _, c := range poly.Coeffs[i] {
+				w.write(c, width)
+			}
+		}
+	}
+	w.flush()
+}
+
+//export lattigo_marshalBinarySizePackedCiphertext
+func lattigo_marshalBinarySizePackedCiphertext(paramsHandle Handle9, ctHandle Handle9, maxLevel uint64) uint64 {
+	defer marshal.Track("lattigo_marshalBinarySizePackedCiphertext").Done()
+	ct := getStoredCiphertext(ctHandle)
+	return packedSize(getStoredParameters(paramsHandle), ct.Degree(), packedLevel(ct, maxLevel))
+}
+
+//export lattigo_marshalBinaryPackedCiphertext
+func lattigo_marshalBinaryPackedCiphertext(paramsHandle Handle9, ctHandle Handle9, maxLevel uint64, callback C.streamWriter, stream *C.void) {
+	defer marshal.Track("lattigo_marshalBinaryPackedCiphertext").Done()
+	params := getStoredParameters(paramsHandle)
+	ct := getStoredCiphertext(ctHandle)
+	level := packedLevel(ct, maxLevel)
+
+	data := make([]byte, packedSize(params, ct.Degree(), level))
+	packCiphertext(params, ct, level, data)
+	writeChunked(callback, stream, data)
+}
+
+//export lattigo_marshalIntoBinaryPackedCiphertext
+func lattigo_marshalIntoBinaryPackedCiphertext(paramsHandle Handle9, ctHandle Handle9, maxLevel uint64, buf *C.char, length uint64) uint64 {
+	defer marshal.Track("lattigo_marshalIntoBinaryPackedCiphertext").Done()
+	params := getStoredParameters(paramsHandle)
+	ct := getStoredCiphertext(ctHandle)
+	level := packedLevel(ct, maxLevel)
+
+	size := packedSize(params, ct.Degree(), level)
+	if size > length {
+		return size
+	}
+	packCiphertext(params, ct, level, unsafeCPtrToSlice(buf, size))
+	return size
+}
+
+//export lattigo_unmarshalBinaryPackedCiphertext
+func lattigo_unmarshalBinaryPackedCiphertext(paramsHandle Handle9, buf *C.char, length uint64) Handle9 {
+	defer marshal.Track("lattigo_unmarshalBinaryPackedCiphertext").Done()
+	params := getStoredParameters(paramsHandle)
+	data := unsafeCPtrToSlice(buf, length)
+	if length < packedHeaderSize || data[0] != packedVersion {
+		panic(errors.New("Invalid packed ciphertext"))
+	}
+	degree, level := int(data[1]), int(data[2])
+	if level > params.MaxLevel() || packedSize(params, degree, level) != length {
+		panic(errors.New("Packed ciphertext does not match the parameters"))
+	}
+
+	ct := ckks.NewCiphertext(*params, degree, level)
+	ct.IsNTT = data[3]&1 == 1
+	ct.SetScale(rlwe.NewScale(math.Float64frombits(binary.BigEndian.Uint64(data[4:]))))
+
+	qs := params.Q()
+	widths := packedWidths(params, level)
+	r := bitReader{in: data[packedHeaderSize:]}
+	for _, poly := range ct.Value {
+		for i, width := range widths {
+			coeffs := poly.Coeffs[i]
+			for j := range coeffs {
+				if coeffs[j] = r.read(width); coeffs[j] >= qs[i] {
+					panic(errors.New("Invalid packed ciphertext"))
+				}
+			}
+		}
+	}
+	return marshal.CrossLangObjMap.Add(unsafe.Pointer(ct))
+}
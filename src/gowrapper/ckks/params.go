@@ -30,6 +30,7 @@ func getStoredParameters(paramHandle Handle6) *ckks.Parameters {
 
 //export lattigo_getDefaultClassicalParams
 func lattigo_getDefaultClassicalParams(paramEnum uint8) Handle6 {
+	defer marshal.Track("lattigo_getDefaultClassicalParams").Done()
 	if int(paramEnum) >= len(ckks.DefaultParams) {
 		panic(errors.New("classical parameter enum index out of bounds"))
 	}
@@ -49,6 +50,7 @@ func lattigo_getDefaultClassicalParams(paramEnum uint8) Handle6 {
 
 //export lattigo_getDefaultPQParams
 func lattigo_getDefaultPQParams(paramEnum uint8) Handle6 {
+	defer marshal.Track("lattigo_getDefaultPQParams").Done()
 	if int(paramEnum) >= len(ckks.DefaultPostQuantumParams) {
 		panic(errors.New("quantum parameter enum index out of bounds"))
 	}
@@ -68,6 +70,7 @@ func lattigo_getDefaultPQParams(paramEnum uint8) Handle6 {
 
 //export lattigo_newParameters
 func lattigo_newParameters(logN uint64, qi *C.constULong, numQi uint8, pi *C.constULong, numPi uint8, pow2Base, h uint64, logScale uint8) Handle6 {
+	defer marshal.Track("lattigo_newParameters").Done()
 	size := unsafe.Sizeof(uint64(0))
 
 	Qi := make([]uint64, numQi)
@@ -101,6 +104,7 @@ func lattigo_newParameters(logN uint64, qi *C.constULong, numQi uint8, pi *C.con
 
 //export lattigo_newParametersFromLogModuli
 func lattigo_newParametersFromLogModuli(logN uint64, logQi *C.constUChar, numQi uint8, logPi *C.constUChar, numPi uint8, logScale uint8) Handle6 {
+	defer marshal.Track("lattigo_newParametersFromLogModuli").Done()
 	size := unsafe.Sizeof(uint8(0))
 
 	LogQi := make([]int, numQi)
@@ -136,6 +140,7 @@ func lattigo_newParametersFromLogModuli(logN uint64, logQi *C.constUChar, numQi
 
 //export lattigo_numSlots
 func lattigo_numSlots(paramHandle Handle6) uint64 {
+	defer marshal.Track("lattigo_numSlots").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return uint64(params.Slots())
@@ -143,6 +148,7 @@ func lattigo_numSlots(paramHandle Handle6) uint64 {
 
 //export lattigo_logN
 func lattigo_logN(paramHandle Handle6) uint64 {
+	defer marshal.Track("lattigo_logN").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return uint64(params.LogN())
@@ -150,18 +156,21 @@ func lattigo_logN(paramHandle Handle6) uint64 {
 
 //export lattigo_ringQ
 func lattigo_ringQ(paramHandle Handle6) Handle6 {
+	defer marshal.Track("lattigo_ringQ").Done()
 	params := getStoredParameters(paramHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(params.RingQ()))
 }
 
 //export lattigo_noiseBound
 func lattigo_noiseBound(paramHandle Handle6) uint64 {
+	defer marshal.Track("lattigo_noiseBound").Done()
 	params := getStoredParameters(paramHandle)
 	return uint64(params.NoiseBound())
 }
 
 //export lattigo_ringP
 func lattigo_ringP(paramHandle Handle6) Handle6 {
+	defer marshal.Track("lattigo_ringP").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(params.RingP()))
@@ -169,12 +178,14 @@ func lattigo_ringP(paramHandle Handle6) Handle6 {
 
 //export lattigo_ringQP
 func lattigo_ringQP(paramHandle Handle6) Handle6 {
+	defer marshal.Track("lattigo_ringQP").Done()
 	params := getStoredParameters(paramHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(params.RingQP()))
 }
 
 //export lattigo_logQP
 func lattigo_logQP(paramHandle Handle6) uint64 {
+	defer marshal.Track("lattigo_logQP").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return uint64(params.LogQP())
@@ -182,6 +193,7 @@ func lattigo_logQP(paramHandle Handle6) uint64 {
 
 //export lattigo_maxLevel
 func lattigo_maxLevel(paramHandle Handle6) uint64 {
+	defer marshal.Track("lattigo_maxLevel").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return uint64(params.MaxLevel())
@@ -189,6 +201,7 @@ func lattigo_maxLevel(paramHandle Handle6) uint64 {
 
 //export lattigo_paramsScale
 func lattigo_paramsScale(paramHandle Handle6) float64 {
+	defer marshal.Track("lattigo_paramsScale").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	scale := params.DefaultScale()
@@ -197,6 +210,7 @@ func lattigo_paramsScale(paramHandle Handle6) float64 {
 
 //export lattigo_sigma
 func lattigo_sigma(paramHandle Handle6) float64 {
+	defer marshal.Track("lattigo_sigma").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return params.Sigma()
@@ -204,6 +218,7 @@ func lattigo_sigma(paramHandle Handle6) float64 {
 
 //export lattigo_getQi
 func lattigo_getQi(paramHandle Handle6, i uint64) uint64 {
+	defer marshal.Track("lattigo_getQi").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return params.Q()[i]
@@ -211,6 +226,7 @@ func lattigo_getQi(paramHandle Handle6, i uint64) uint64 {
 
 //export lattigo_getPi
 func lattigo_getPi(paramHandle Handle6, i uint64) uint64 {
+	defer marshal.Track("lattigo_getPi").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return params.P()[i]
@@ -218,6 +234,7 @@ func lattigo_getPi(paramHandle Handle6, i uint64) uint64 {
 
 //export lattigo_qiCount
 func lattigo_qiCount(paramHandle Handle6) uint64 {
+	defer marshal.Track("lattigo_qiCount").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return uint64(params.QCount())
@@ -225,6 +242,7 @@ func lattigo_qiCount(paramHandle Handle6) uint64 {
 
 //export lattigo_piCount
 func lattigo_piCount(paramHandle Handle6) uint64 {
+	defer marshal.Track("lattigo_piCount").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return uint64(params.PCount())
@@ -232,6 +250,7 @@ func lattigo_piCount(paramHandle Handle6) uint64 {
 
 //export lattigo_logQLvl
 func lattigo_logQLvl(paramHandle Handle6, i uint64) uint64 {
+	defer marshal.Track("lattigo_logQLvl").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return uint64(params.LogQLvl(int(i)))
@@ -239,6 +258,7 @@ func lattigo_logQLvl(paramHandle Handle6, i uint64) uint64 {
 
 //export lattigo_logSlots
 func lattigo_logSlots(paramHandle Handle6) uint64 {
+	defer marshal.Track("lattigo_logSlots").Done()
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
 	return uint64(params.LogSlots())
@@ -246,12 +266,14 @@ func lattigo_logSlots(paramHandle Handle6) uint64 {
 
 //export lattigo_galoisElementForRowRotation
 func lattigo_galoisElementForRowRotation(paramHandle Handle6) uint64 {
+	defer marshal.Track("lattigo_galoisElementForRowRotation").Done()
 	params := getStoredParameters(paramHandle)
 	return params.GaloisElementForRowRotation()
 }
 
 //export lattigo_galoisElementsForRowInnerSum
 func lattigo_galoisElementsForRowInnerSum(paramHandle Handle6, outValues *C.uint64_t) {
+	defer marshal.Track("lattigo_galoisElementsForRowInnerSum").Done()
 	params := getStoredParameters(paramHandle)
 	res := params.GaloisElementsForRowInnerSum()
 
@@ -264,12 +286,14 @@ func lattigo_galoisElementsForRowInnerSum(paramHandle Handle6, outValues *C.uint
 
 //export lattigo_inverseGaloisElement
 func lattigo_inverseGaloisElement(paramHandle Handle6, galEl uint64) uint64 {
+	defer marshal.Track("lattigo_inverseGaloisElement").Done()
 	params := getStoredParameters(paramHandle)
 	return params.InverseGaloisElement(galEl)
 }
 
 //export lattigo_rotationFromGaloisElement
 func lattigo_rotationFromGaloisElement(paramHandle Handle6, galEl uint64) uint64 {
+	defer marshal.Track("lattigo_rotationFromGaloisElement").Done()
 	params := getStoredParameters(paramHandle)
 	return params.RotationFromGaloisElement(galEl)
 }
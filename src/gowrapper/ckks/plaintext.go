@@ -24,6 +24,7 @@ func getStoredPlaintext(ptHandle Handle7) *rlwe.Plaintext {
 
 //export lattigo_newPlaintext
 func lattigo_newPlaintext(paramsHandle Handle7, level uint64) Handle7 {
+	defer marshal.Track("lattigo_newPlaintext").Done()
 	params := getStoredParameters(paramsHandle)
 	plaintext := ckks.NewPlaintext(*params, int(level))
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(plaintext))
@@ -31,6 +32,7 @@ func lattigo_newPlaintext(paramsHandle Handle7, level uint64) Handle7 {
 
 //export lattigo_newPlaintextFromPoly
 func lattigo_newPlaintextFromPoly(paramsHandle, polyHandle Handle7, level uint64) Handle7 {
+	defer marshal.Track("lattigo_newPlaintextFromPoly").Done()
 	params := getStoredParameters(paramsHandle)
 	poly := ring.GetStoredPoly(polyHandle)
 	plaintext := ckks.NewPlaintext(*params, int(level))
@@ -40,6 +42,7 @@ func lattigo_newPlaintextFromPoly(paramsHandle, polyHandle Handle7, level uint64
 
 //export lattigo_plaintextGetScale
 func lattigo_plaintextGetScale(ptHandle Handle7) float64 {
+	defer marshal.Track("lattigo_plaintextGetScale").Done()
 	var pt *rlwe.Plaintext
 	pt = getStoredPlaintext(ptHandle)
 	return pt.GetScale().Float64()
@@ -47,6 +50,7 @@ func lattigo_plaintextGetScale(ptHandle Handle7) float64 {
 
 //export lattigo_plaintextSetScale
 func lattigo_plaintextSetScale(ptHandle Handle7, scale float64) {
+	defer marshal.Track("lattigo_plaintextSetScale").Done()
 	var pt *rlwe.Plaintext
 	pt = getStoredPlaintext(ptHandle)
 	pt.SetScale(rlwe.NewScale(scale))
@@ -54,6 +58,7 @@ func lattigo_plaintextSetScale(ptHandle Handle7, scale float64) {
 
 //export lattigo_getPlaintextPoly
 func lattigo_getPlaintextPoly(ptHandle Handle7) Handle7 {
+	defer marshal.Track("lattigo_getPlaintextPoly").Done()
 	plaintext := getStoredPlaintext(ptHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(plaintext.Value))
 }
@@ -15,6 +15,7 @@ struct Lattigo_String {
 import "C"
 
 import (
+	"lattigo-cpp/marshal"
 	"math"
 
 	"github.com/tuneinsight/lattigo/v4/ckks"
@@ -25,6 +26,7 @@ type Handle12 = uint64
 
 //export lattigo_precisionStats
 func lattigo_precisionStats(paramHandle Handle12, encoderHandle Handle12, expectedValues *C.constDouble, actualValues *C.constDouble, length uint64) *C.char {
+	defer marshal.Track("lattigo_precisionStats").Done()
 
 	var params *ckks.Parameters
 	params = getStoredParameters(paramHandle)
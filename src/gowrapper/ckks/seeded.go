@@ -0,0 +1,243 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+package ckks
+
+import "C"
+
+import (
+	"crypto/rand"
+	"errors"
+	"lattigo-cpp/marshal"
+	"runtime"
+	"sync"
+	"unsafe"
+
+	"github.com/tuneinsight/lattigo/v4/ckks"
+	"github.com/tuneinsight/lattigo/v4/ring"
+	"github.com/tuneinsight/lattigo/v4/rlwe"
+	"github.com/tuneinsight/lattigo/v4/rlwe/ringqp"
+	"github.com/tuneinsight/lattigo/v4/utils"
+)
+
+// https://github.com/golang/go/issues/35715#issuecomment-791039692
+type Handle18 = uint64
+
+// An RLWE ciphertext, public key or switching key is made of pairs (b, a) where a is uniformly
+// random and b = -a*s + e (+ m). Seeding an object replaces each a with a' expanded from a fresh
+// PRNG seed and adds (a - a')*s to the matching b, which leaves the message and error unchanged.
+// Since a' is still uniformly random, the seeded object is as secure as the original, but its
+// a components can be regenerated from the seed, so the object can be serialized in about half
+// the space. Lattigo's key generator does not accept a seed, so objects are seeded after they are
+// created, which needs the secret key; seeding is an extra multiplication per (b, a) pair.
+//
+// Seeds are kept in a table keyed by the address of the seeded object, and dropped when the
+// object is garbage collected. Each entry stores a fingerprint of the a components so that an
+// object which has been modified since it was seeded (e.g., used as the output of an evaluator
+// operation) is not serialized with a stale seed.
+const seedSize = 32
+
+type seedRecord struct {
+	seed        []byte
+	fingerprint []uint64
+}
+
+var seeds = struct {
+	sync.Mutex
+	records map[uintptr]seedRecord
+}{records: make(map[uintptr]seedRecord)}
+
+func recordSeed(obj interface{}, key uintptr, seed []byte, fingerprint []uint64) {
+	seeds.Lock()
+	seeds.records[key] = seedRecord{seed: seed, fingerprint: fingerprint}
+	seeds.Unlock()
+
+	// an object which is seeded again keeps a single finalizer
+	runtime.SetFinalizer(obj, nil)
+	runtime.SetFinalizer(obj, func(interface{}) {
+		seeds.Lock()
+		delete(seeds.records, key)
+		seeds.Unlock()
+	})
+}
+
+// Return the seed of an object, or nil if it was never seeded or has changed since
+func storedSeed(key uintptr, fingerprint []uint64) []byte {
+	seeds.Lock()
+	defer seeds.Unlock()
+
+	record, ok := seeds.records[key]
+	if !ok || len(record.fingerprint) != len(fingerprint) {
+		return nil
+	}
+	for i := range fingerprint {
+		if record.fingerprint[i] != fingerprint[i] {
+			return nil
+		}
+	}
+	return record.seed
+}
+
+func newSeed() []byte {
+	seed := make([]byte, seedSize)
+	if _, err := rand.Read(seed); err != nil {
+		panic(err)
+	}
+	return seed
+}
+
+func newSeededPRNG(seed []byte) utils.PRNG {
+	prng, err := utils.NewKeyedPRNG(seed)
+	if err != nil {
+		panic(err)
+	}
+	return prng
+}
+
+func polyFingerprint(fingerprint []uint64, p *ring.Poly) []uint64 {
+	last := len(p.Coeffs) - 1
+	return append(fingerprint, uint64(last), p.Coeffs[0][0], p.Coeffs[last][len(p.Coeffs[last])-1])
+}
+
+func ciphertextFingerprint(ct *rlwe.Ciphertext) []uint64 {
+	if ct.Degree() != 1 {
+		return nil
+	}
+	return polyFingerprint(nil, ct.Value[1])
+}
+
+func keyFingerprint(parts []*[2]ringqp.Poly) []uint64 {
+	fingerprint := make([]uint64, 0, 3*len(parts))
+	for _, part := range parts {
+		fingerprint = polyFingerprint(fingerprint, part[1].Q)
+	}
+	return fingerprint
+}
+
+func levelOfP(p ringqp.Poly) int {
+	if p.P == nil {
+		return -1
+	}
+	return p.P.Level()
+}
+
+// The (b, a) pairs of a key, in the order in which their a components are expanded from its seed
+func switchingKeyParts(parts []*[2]ringqp.Poly, swk *rlwe.SwitchingKey) []*[2]ringqp.Poly {
+	for i := range swk.Value {
+		for j := range swk.Value[i] {
+			parts = append(parts, &swk.Value[i][j].Value)
+		}
+	}
+	return parts
+}
+
+func publicKeyParts(pk *rlwe.PublicKey) []*[2]ringqp.Poly {
+	return []*[2]ringqp.Poly{&pk.Value}
+}
+
+func relinKeyParts(rlk *rlwe.RelinearizationKey) []*[2]ringqp.Poly {
+	var parts []*[2]ringqp.Poly
+	for _, swk := range rlk.Keys {
+		parts = switchingKeyParts(parts, swk)
+	}
+	return parts
+}
+
+func rotationKeyParts(rotkeys *rlwe.RotationKeySet) []*[2]ringqp.Poly {
+	var parts []*[2]ringqp.Poly
+	for _, galEl := range sortedGaloisElements(rotkeys) {
+		parts = switchingKeyParts(parts, rotkeys.Keys[galEl])
+	}
+	return parts
+}
+
+// Seed a degree-1 ciphertext in the NTT domain. s is in Montgomery form, so b += (a - a')*s is a
+// single Montgomery multiplication.
+func seedCiphertext(params *ckks.Parameters, sk *rlwe.SecretKey, ct *rlwe.Ciphertext) {
+	if ct.Degree() != 1 || !ct.IsNTT {
+		panic(errors.New("Only degree-1 ciphertexts in the NTT domain can be seeded"))
+	}
+	ringQ := params.RingQ()
+	level := ct.Level()
+	seed := newSeed()
+
+	a := ringQ.NewPolyLvl(level)
+	ring.NewUniformSampler(newSeededPRNG(seed), ringQ).ReadLvl(level, a)
+	ringQ.SubLvl(level, ct.Value[1], a, ct.Value[1])
+	ringQ.MulCoeffsMontgomeryAndAddLvl(level, ct.Value[1], sk.Value.Q, ct.Value[0])
+	ct.Value[1].Copy(a)
+
+	recordSeed(ct, uintptr(unsafe.Pointer(ct)), seed, ciphertextFingerprint(ct))
+}
+
+// Regenerate the a component of a ciphertext read without it
+func expandCiphertext(params *ckks.Parameters, seed []byte, ct *rlwe.Ciphertext) {
+	ringQ := params.RingQ()
+	level := ct.Level()
+	a := ringQ.NewPolyLvl(level)
+	ring.NewUniformSampler(newSeededPRNG(seed), ringQ).ReadLvl(level, a)
+	ct.Value = append(ct.Value, a)
+
+	recordSeed(ct, uintptr(unsafe.Pointer(ct)), seed, ciphertextFingerprint(ct))
+}
+
+// Seed every (b, a) pair of a key from one PRNG stream. Keys are stored in NTT and Montgomery
+// form; a' is used as-is as the Montgomery representation of a uniformly random polynomial.
+func seedKey(params *ckks.Parameters, sk *rlwe.SecretKey, parts []*[2]ringqp.Poly) []byte {
+	ringQP := params.RingQP()
+	seed := newSeed()
+	sampler := ringqp.NewUniformSampler(newSeededPRNG(seed), *ringQP)
+
+	for _, part := range parts {
+		levelQ, levelP := part[1].Q.Level(), levelOfP(part[1])
+		a := ringQP.NewPolyLvl(levelQ, levelP)
+		sampler.ReadLvl(levelQ, levelP, a)
+		ringQP.SubLvl(levelQ, levelP, part[1], a, part[1])
+		ringQP.MulCoeffsMontgomeryAndAddLvl(levelQ, levelP, part[1], sk.Value, part[0])
+		part[1] = a
+	}
+	return seed
+}
+
+// Regenerate the a components of a key whose b components have been read
+func expandKey(params *ckks.Parameters, seed []byte, parts []*[2]ringqp.Poly) {
+	ringQP := params.RingQP()
+	sampler := ringqp.NewUniformSampler(newSeededPRNG(seed), *ringQP)
+
+	for _, part := range parts {
+		sampler.ReadLvl(part[1].Q.Level(), levelOfP(part[1]), part[1])
+	}
+}
+
+//export lattigo_seedCiphertext
+func lattigo_seedCiphertext(paramHandle Handle18, skHandle Handle18, ctHandle Handle18) {
+	defer marshal.Track("lattigo_seedCiphertext").Done()
+	seedCiphertext(getStoredParameters(paramHandle), getStoredSecretKey(skHandle), getStoredCiphertext(ctHandle))
+}
+
+//export lattigo_seedPublicKey
+func lattigo_seedPublicKey(paramHandle Handle18, skHandle Handle18, pkHandle Handle18) {
+	defer marshal.Track("lattigo_seedPublicKey").Done()
+	pk := getStoredPublicKey(pkHandle)
+	parts := publicKeyParts(pk)
+	seed := seedKey(getStoredParameters(paramHandle), getStoredSecretKey(skHandle), parts)
+	recordSeed(pk, uintptr(unsafe.Pointer(pk)), seed, keyFingerprint(parts))
+}
+
+//export lattigo_seedRelinearizationKey
+func lattigo_seedRelinearizationKey(paramHandle Handle18, skHandle Handle18, relinKeyHandle Handle18) {
+	defer marshal.Track("lattigo_seedRelinearizationKey").Done()
+	rlk := getStoredRelinKey(relinKeyHandle)
+	parts := relinKeyParts(rlk)
+	seed := seedKey(getStoredParameters(paramHandle), getStoredSecretKey(skHandle), parts)
+	recordSeed(rlk, uintptr(unsafe.Pointer(rlk)), seed, keyFingerprint(parts))
+}
+
+//export lattigo_seedRotationKeys
+func lattigo_seedRotationKeys(paramHandle Handle18, skHandle Handle18, rotKeysHandle Handle18) {
+	defer marshal.Track("lattigo_seedRotationKeys").Done()
+	rotkeys := getStoredRotationKeys(rotKeysHandle)
+	parts := rotationKeyParts(rotkeys)
+	seed := seedKey(getStoredParameters(paramHandle), getStoredSecretKey(skHandle), parts)
+	recordSeed(rotkeys, uintptr(unsafe.Pointer(rotkeys)), seed, keyFingerprint(parts))
+}
@@ -0,0 +1,24 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//go:build bench
+// +build bench
+
+package marshal
+
+import "C"
+
+// https://github.com/golang/go/issues/35715#issuecomment-791039692
+type BenchHandle = uint64
+
+// Exports used only by the benchmarks, which are compiled into the library only when it
+// is built with the bench tag (see LATTICPP_BUILD_BENCHMARKS).
+
+// Register a second handle, with its own reference count, for the object behind `handle`.
+// This creates a handle without allocating a Go object, so that the cost of Add (and of
+// releasing the handle with decref) can be measured on its own.
+//
+//export aliasHandle
+func aliasHandle(handle BenchHandle) BenchHandle {
+	return CrossLangObjMap.Add(CrossLangObjMap.Get(handle).Ptr)
+}
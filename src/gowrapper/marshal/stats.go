@@ -0,0 +1,150 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+package marshal
+
+import "C"
+
+import (
+	"math/bits"
+	"runtime"
+	"sort"
+	"strconv"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// Optional per-export statistics. Every lattigo_* export starts with
+//
+//	defer marshal.Track("lattigo_name").Done()
+//
+// which costs one atomic load when statistics are off, and never allocates. When they are on, each call is
+// counted and its latency added to a histogram with one bucket per power of two
+// nanoseconds. Every allocSamplePeriod-th call of each export is also bracketed by
+// runtime.ReadMemStats to measure the bytes it allocates; ReadMemStats stops the world,
+// which is why it is sampled, and the delta includes allocations made concurrently by
+// other goroutines, so the sampled figure is an upper bound.
+const numLatencyBuckets = 64
+
+type exportStats struct {
+	calls uint64
+	nanos uint64
+	// buckets[i] counts calls which took [2^(i-1), 2^i) ns
+	buckets      [numLatencyBuckets]uint64
+	allocSamples uint64
+	allocBytes   uint64
+}
+
+var (
+	statsEnabled      uint32
+	allocSamplePeriod uint64
+	// *sync.Map from export name to *exportStats, replaced when statistics are reset
+	statsTable atomic.Value
+)
+
+func init() {
+	statsTable.Store(&sync.Map{})
+}
+
+// A call in progress, returned by Track. It is kept small since it is copied into the
+// deferred call even when statistics are off.
+type Call struct {
+	stats *exportStats
+	// time since statsEpoch
+	start time.Duration
+	// TotalAlloc at the start of the call, or notSampled
+	allocBefore uint64
+}
+
+const notSampled = ^uint64(0)
+
+// a monotonic reference point for Call.start
+var statsEpoch = time.Now()
+
+// Track records a call of the named export; Done must be called (deferred) when the call
+// returns.
+func Track(name string) Call {
+	if atomic.LoadUint32(&statsEnabled) == 0 {
+		return Call{}
+	}
+	return track(name)
+}
+
+func track(name string) Call {
+	table := statsTable.Load().(*sync.Map)
+	v, ok := table.Load(name)
+	if !ok {
+		v, _ = table.LoadOrStore(name, &exportStats{})
+	}
+	s := v.(*exportStats)
+
+	n := atomic.AddUint64(&s.calls, 1)
+	period := atomic.LoadUint64(&allocSamplePeriod)
+	allocBefore := notSampled
+	if period != 0 && (n-1)%period == 0 {
+		var m runtime.MemStats
+		runtime.ReadMemStats(&m)
+		allocBefore = m.TotalAlloc
+	}
+	return Call{stats: s, start: time.Since(statsEpoch), allocBefore: allocBefore}
+}
+
+func (c Call) Done() {
+	s := c.stats
+	if s == nil {
+		return
+	}
+	ns := uint64(time.Since(statsEpoch) - c.start)
+	atomic.AddUint64(&s.nanos, ns)
+	atomic.AddUint64(&s.buckets[bits.Len64(ns)], 1)
+	if c.allocBefore != notSampled {
+		var m runtime.MemStats
+		runtime.ReadMemStats(&m)
+		atomic.AddUint64(&s.allocSamples, 1)
+		atomic.AddUint64(&s.allocBytes, m.TotalAlloc-c.allocBefore)
+	}
+}
+
+// Turning statistics on clears those collected so far. A period of 0 disables allocation
+// sampling.
+//
+//export lattigo_setStatsCollection
+func lattigo_setStatsCollection(enabled bool, samplePeriod uint64) {
+	if enabled {
+		statsTable.Store(&sync.Map{})
+		atomic.StoreUint64(&allocSamplePeriod, samplePeriod)
+		atomic.StoreUint32(&statsEnabled, 1)
+	} else {
+		atomic.StoreUint32(&statsEnabled, 0)
+	}
+}
+
+// Returns one line per export which has been called, sorted by name:
+//
+//	name calls nanos allocSamples allocBytes bucket_0 ... bucket_63
+//
+// The caller must free the string.
+//
+//export lattigo_statsSnapshot
+func lattigo_statsSnapshot() *C.char {
+	var lines []string
+	statsTable.Load().(*sync.Map).Range(func(k, v interface{}) bool {
+		s := v.(*exportStats)
+		fields := []string{
+			k.(string),
+			strconv.FormatUint(atomic.LoadUint64(&s.calls), 10),
+			strconv.FormatUint(atomic.LoadUint64(&s.nanos), 10),
+			strconv.FormatUint(atomic.LoadUint64(&s.allocSamples), 10),
+			strconv.FormatUint(atomic.LoadUint64(&s.allocBytes), 10),
+		}
+		for i := range s.buckets {
+			fields = append(fields, strconv.FormatUint(atomic.LoadUint64(&s.buckets[i]), 10))
+		}
+		lines = append(lines, strings.Join(fields, " "))
+		return true
+	})
+	sort.Strings(lines)
+	return C.CString(strings.Join(lines, "\n"))
+}
@@ -18,61 +18,248 @@ import (
 
 type Handle = uint64
 
-var CrossLangObjMap *xlangRefMap = &xlangRefMap{
-	lock: new(sync.RWMutex),
-	m:    make(map[Handle]*xlangRef),
-	// in C++, the default constructor uses a handle value of 0,
-	// which should never point to a real object for safety.
-	// Start the counter here at 1.
-	idCtr: 1,
-}
+// The registry is a slot array rather than a map. A handle encodes the index of
+// its slot in the low 32 bits and the generation of that slot in the high 32 bits.
+// Slots live in fixed-size segments which are never moved or freed once allocated,
+// so a lookup is two atomic loads and a generation check: it never takes a lock.
+// When the last reference to a handle is dropped, the slot's generation is bumped
+// before the slot is recycled, so stale handles are detected rather than silently
+// resolving to whatever object reuses the slot. The generation and the reference
+// count share one 64-bit word, so dropping the last reference and bumping the
+// generation are a single compare-and-swap: an incref racing with the final decref
+// either lands before it (and the slot stays live) or fails.
+//
+// Only allocating and releasing slots touches a lock, and those locks are sharded
+// so that concurrent threads creating objects rarely contend with each other.
+const (
+	segmentBits = 10
+	segmentSize = 1 << segmentBits
+	segmentMask = segmentSize - 1
+
+	// number of free-list shards; must be a power of two
+	numShards = 64
+	// number of fresh slot indices a shard claims at once when its free list is empty
+	slotBatch = 64
+	// size of the initial segment directory; it doubles as needed
+	initialSegments = 16
+)
+
+var CrossLangObjMap *xlangRefMap = newXlangRefMap()
 
 type xlangRefMap struct {
-	lock  *sync.RWMutex
-	m     map[Handle]*xlangRef
-	idCtr uint64
+	// *[]*segment, replaced (never modified) when the directory grows
+	dir unsafe.Pointer
+	// number of slot indices ever handed out to a shard
+	highWater uint32
+	// round-robin counter used to spread allocations across shards
+	nextShard uint32
+	growLock  sync.Mutex
+	shards    [numShards]refShard
 }
 
+type segment [segmentSize]xlangRef
+
 type xlangRef struct {
-	Ptr  unsafe.Pointer
-	refs uint32
+	Ptr unsafe.Pointer
+	// generation in the high 32 bits, reference count in the low 32 bits; a slot
+	// with a reference count of zero is free. Only accessed atomically, and 64-bit
+	// aligned because it follows a pointer.
+	state uint64
+}
+
+func slotGen(state uint64) uint32 {
+	return uint32(state >> 32)
+}
+
+func slotRefs(state uint64) uint32 {
+	return uint32(state)
+}
+
+type refShard struct {
+	lock sync.Mutex
+	free []uint32
+	live int
+	// keep each shard on its own cache line
+	_ [64]byte
+}
+
+func newXlangRefMap() *xlangRefMap {
+	m := &xlangRefMap{}
+	dir := make([]*segment, initialSegments)
+	m.dir = unsafe.Pointer(&dir)
+	return m
+}
+
+func (m *xlangRefMap) slot(idx uint32) *xlangRef {
+	dir := *(*[]*segment)(atomic.LoadPointer(&m.dir))
+	segIdx := int(idx >> segmentBits)
+	if segIdx >= len(dir) {
+		return nil
+	}
+	seg := (*segment)(atomic.LoadPointer((*unsafe.Pointer)(unsafe.Pointer(&dir[segIdx]))))
+	if seg == nil {
+		return nil
+	}
+	return &seg[idx&segmentMask]
+}
+
+// Make sure that every slot with index < limit is backed by a segment.
+func (m *xlangRefMap) ensureSegments(limit uint32) {
+	m.growLock.Lock()
+	defer m.growLock.Unlock()
+
+	dir := *(*[]*segment)(atomic.LoadPointer(&m.dir))
+	needed := int((uint64(limit) + segmentMask) >> segmentBits)
+	if needed > len(dir) {
+		newLen := len(dir)
+		for newLen < needed {
+			newLen *= 2
+		}
+		newDir := make([]*segment, newLen)
+		copy(newDir, dir)
+		atomic.StorePointer(&m.dir, unsafe.Pointer(&newDir))
+		dir = newDir
+	}
+	for i := 0; i < needed; i++ {
+		if dir[i] == nil {
+			seg := new(segment)
+			// generation 0 is never handed out, so that no handle can ever be 0
+			for j := range seg {
+				seg[j].state = 1 << 32
+			}
+			atomic.StorePointer((*unsafe.Pointer)(unsafe.Pointer(&dir[i])), unsafe.Pointer(seg))
+		}
+	}
 }
 
 func (m *xlangRefMap) Len() int {
-	m.lock.RLock()
-	l := len(m.m)
-	m.lock.RUnlock()
+	l := 0
+	for i := range m.shards {
+		s := &m.shards[i]
+		s.lock.Lock()
+		l += s.live
+		s.lock.Unlock()
+	}
 	return l
 }
 
 func (m *xlangRefMap) Add(fset unsafe.Pointer) Handle {
-	m.lock.Lock()
-	m.idCtr = m.idCtr + 1
-	id := m.idCtr
-	m.m[id] = &xlangRef{fset, 1}
-	m.lock.Unlock()
-	return id
+	s := &m.shards[atomic.AddUint32(&m.nextShard, 1)&(numShards-1)]
+	s.lock.Lock()
+	if len(s.free) == 0 {
+		start := atomic.AddUint32(&m.highWater, slotBatch) - slotBatch
+		if start > ^uint32(0)-slotBatch {
+			s.lock.Unlock()
+			panic(errors.New("Cross-language object registry is full"))
+		}
+		m.ensureSegments(start + slotBatch)
+		for i := uint32(slotBatch); i > 0; i-- {
+			s.free = append(s.free, start+i-1)
+		}
+	}
+	idx := s.free[len(s.free)-1]
+	s.free = s.free[:len(s.free)-1]
+	s.live++
+	s.lock.Unlock()
+
+	ref := m.slot(idx)
+	atomic.StorePointer(&ref.Ptr, fset)
+	// the slot is free, so nothing else can change its state until it is published here
+	gen := slotGen(atomic.LoadUint64(&ref.state))
+	atomic.StoreUint64(&ref.state, uint64(gen)<<32|1)
+	return uint64(gen)<<32 | uint64(idx)
+}
+
+// Return a slot to the free list once its last reference has been dropped and its
+// generation bumped. Slots are returned to a shard determined by their index, so a
+// slot freed by one thread can be reused by another.
+func (m *xlangRefMap) release(idx uint32, ref *xlangRef) {
+	// drop the pointer so the Go garbage collector can reclaim the object
+	atomic.StorePointer(&ref.Ptr, nil)
+
+	s := &m.shards[idx&(numShards-1)]
+	s.lock.Lock()
+	s.free = append(s.free, idx)
+	s.live--
+	s.lock.Unlock()
+}
+
+// Resolve a handle to its slot, or return nil if the handle is not live.
+func (m *xlangRefMap) lookup(id Handle) *xlangRef {
+	ref := m.slot(uint32(id))
+	if ref == nil {
+		return nil
+	}
+	state := atomic.LoadUint64(&ref.state)
+	if slotGen(state) != uint32(id>>32) || slotRefs(state) == 0 {
+		return nil
+	}
+	return ref
+}
+
+// Optional counters of incref/decref calls made from C++, used to measure how much
+// reference-count traffic crosses the language boundary. Counting is off by default
+// so that the counters don't become a point of contention.
+var (
+	countRefOps uint32
+	increfCalls uint64
+	decrefCalls uint64
+)
+
+//export setRefOpCounting
+func setRefOpCounting(enabled bool) {
+	if enabled {
+		atomic.StoreUint64(&increfCalls, 0)
+		atomic.StoreUint64(&decrefCalls, 0)
+		atomic.StoreUint32(&countRefOps, 1)
+	} else {
+		atomic.StoreUint32(&countRefOps, 0)
+	}
+}
+
+//export increfCount
+func increfCount() uint64 {
+	return atomic.LoadUint64(&increfCalls)
+}
+
+//export decrefCount
+func decrefCount() uint64 {
+	return atomic.LoadUint64(&decrefCalls)
 }
 
 //export incref
 func incref(handle Handle) {
+	if atomic.LoadUint32(&countRefOps) != 0 {
+		atomic.AddUint64(&increfCalls, 1)
+	}
 	CrossLangObjMap.Incref(handle)
 }
 
 func (m *xlangRefMap) Incref(id Handle) {
-	m.lock.RLock()
-	ref, ok := m.m[id]
-	m.lock.RUnlock()
+	ref := m.lookup(id)
 
-	if !ok {
+	if ref == nil {
 		panic(errors.New("Cannot find object for specified handle: " + strconv.FormatUint(id, 10)))
 	}
 
-	atomic.AddUint32(&ref.refs, 1)
+	// the handle may be released between the lookup and the increment, in which
+	// case its slot has been retired and must not be brought back to life
+	for {
+		state := atomic.LoadUint64(&ref.state)
+		if slotGen(state) != uint32(id>>32) || slotRefs(state) == 0 {
+			panic(errors.New("Cannot find object for specified handle: " + strconv.FormatUint(id, 10)))
+		}
+		if atomic.CompareAndSwapUint64(&ref.state, state, state+1) {
+			return
+		}
+	}
 }
 
 //export decref
 func decref(handle Handle) {
+	if atomic.LoadUint32(&countRefOps) != 0 {
+		atomic.AddUint64(&decrefCalls, 1)
+	}
 	CrossLangObjMap.Decref(handle)
 }
 
@@ -82,44 +269,50 @@ func refCount(handle Handle) uint32 {
 }
 
 func (m *xlangRefMap) RefCount(id Handle) uint32 {
-	m.lock.RLock()
-	ref, ok := m.m[id]
-	m.lock.RUnlock()
+	ref := m.lookup(id)
 
-	if !ok {
+	if ref == nil {
 		panic(errors.New("Cannot find object for specified handle: " + strconv.FormatUint(id, 10)))
 	}
 
-	return atomic.LoadUint32(&ref.refs)
+	return slotRefs(atomic.LoadUint64(&ref.state))
 }
 
 func (m *xlangRefMap) Decref(id Handle) {
-	m.lock.RLock()
-	ref, ok := m.m[id]
-	m.lock.RUnlock()
+	ref := m.lookup(id)
 
-	if !ok {
+	if ref == nil {
 		panic(errors.New("Cannot find object for specified handle: " + strconv.FormatUint(id, 10)))
 	}
 
-	refs := atomic.AddUint32(&ref.refs, ^uint32(0))
-	if refs != 0 {
-		return
-	}
-
-	m.lock.Lock()
-	if atomic.LoadUint32(&ref.refs) == 0 {
-		delete(m.m, id)
+	for {
+		state := atomic.LoadUint64(&ref.state)
+		if slotGen(state) != uint32(id>>32) || slotRefs(state) == 0 {
+			panic(errors.New("Cannot find object for specified handle: " + strconv.FormatUint(id, 10)))
+		}
+		if slotRefs(state) > 1 {
+			if atomic.CompareAndSwapUint64(&ref.state, state, state-1) {
+				return
+			}
+			continue
+		}
+		// dropping the last reference: retire the slot by bumping its generation in the
+		// same step, so that a concurrent Incref of this handle fails instead of reviving it
+		gen := slotGen(state) + 1
+		if gen == 0 {
+			gen = 1
+		}
+		if atomic.CompareAndSwapUint64(&ref.state, state, uint64(gen)<<32) {
+			m.release(uint32(id), ref)
+			return
+		}
 	}
-	m.lock.Unlock()
 }
 
 func (m *xlangRefMap) Get(id Handle) *xlangRef {
-	m.lock.RLock()
-	ref, ok := m.m[id]
-	m.lock.RUnlock()
+	ref := m.lookup(id)
 
-	if !ok {
+	if ref == nil {
 		panic(errors.New("Fatal error: unable to retrieve object for specified handle: " + strconv.FormatUint(id, 10)))
 	}
 
@@ -52,6 +52,7 @@ func getStoredBasisExtender(basisExtenderHandle Handle14) *ring.BasisExtender {
 
 //export lattigo_newRing
 func lattigo_newRing(n uint64, moduli *C.uint64_t, moduliLen uint64) Handle14 {
+	defer marshal.Track("lattigo_newRing").Done()
 	moduliTmp := make([]uint64, moduliLen)
 	size := unsafe.Sizeof(uint64(0))
 	basePtrIn := uintptr(unsafe.Pointer(&moduli))
@@ -69,6 +70,7 @@ func lattigo_newRing(n uint64, moduli *C.uint64_t, moduliLen uint64) Handle14 {
 
 //export lattigo_newPolyQP
 func lattigo_newPolyQP(ringHandle Handle14) Handle14 {
+	defer marshal.Track("lattigo_newPolyQP").Done()
 	r := getStoredRingQP(ringHandle)
 	poly := r.NewPoly()
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&poly))
@@ -76,6 +78,7 @@ func lattigo_newPolyQP(ringHandle Handle14) Handle14 {
 
 //export lattigo_copyNewPolyQP
 func lattigo_copyNewPolyQP(polyHandle Handle14) Handle14 {
+	defer marshal.Track("lattigo_copyNewPolyQP").Done()
 	srcPoly := getStoredPolyQP(polyHandle)
 	newPoly := srcPoly.CopyNew()
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(&newPoly))
@@ -83,6 +86,7 @@ func lattigo_copyNewPolyQP(polyHandle Handle14) Handle14 {
 
 //export lattigo_ringQPAddLvl
 func lattigo_ringQPAddLvl(ringHandle Handle14, levelQ, levelP uint64, poly1Handle, poly2Handle, outputHandle Handle14) {
+	defer marshal.Track("lattigo_ringQPAddLvl").Done()
 	r := getStoredRingQP(ringHandle)
 	p1 := getStoredPolyQP(poly1Handle)
 	p2 := getStoredPolyQP(poly2Handle)
@@ -92,6 +96,7 @@ func lattigo_ringQPAddLvl(ringHandle Handle14, levelQ, levelP uint64, poly1Handl
 
 //export lattigo_copyPolyQP
 func lattigo_copyPolyQP(polyTargetHandle, polySrcHandle Handle14) {
+	defer marshal.Track("lattigo_copyPolyQP").Done()
 	pTarget := getStoredPolyQP(polyTargetHandle)
 	pSrc := getStoredPolyQP(polySrcHandle)
 	pTarget.Copy(*pSrc)
@@ -99,6 +104,7 @@ func lattigo_copyPolyQP(polyTargetHandle, polySrcHandle Handle14) {
 
 //export lattigo_newUniformSampler
 func lattigo_newUniformSampler(prngHandle, baseRingHandle Handle14) Handle14 {
+	defer marshal.Track("lattigo_newUniformSampler").Done()
 	prng := utils.GetStoredKeyedPRNG(prngHandle)
 	r := getStoredRing(baseRingHandle)
 	sampler := ring.NewUniformSampler(prng, r)
@@ -107,6 +113,7 @@ func lattigo_newUniformSampler(prngHandle, baseRingHandle Handle14) Handle14 {
 
 //export lattigo_newBasisExtender
 func lattigo_newBasisExtender(ringQHandle, ringPHandle Handle14) Handle14 {
+	defer marshal.Track("lattigo_newBasisExtender").Done()
 	ringQ := getStoredRing(ringQHandle)
 	ringP := getStoredRing(ringPHandle)
 	basisExtender := ring.NewBasisExtender(ringQ, ringP)
@@ -115,6 +122,7 @@ func lattigo_newBasisExtender(ringQHandle, ringPHandle Handle14) Handle14 {
 
 //export lattigo_modUpQtoP
 func lattigo_modUpQtoP(basisExtenderHandle Handle14, levelQ, levelP uint64, polQHandle, polPHandle Handle14) {
+	defer marshal.Track("lattigo_modUpQtoP").Done()
 	basisExtender := getStoredBasisExtender(basisExtenderHandle)
 	polQ := GetStoredPoly(polQHandle)
 	polP := GetStoredPoly(polPHandle)
@@ -123,6 +131,7 @@ func lattigo_modUpQtoP(basisExtenderHandle Handle14, levelQ, levelP uint64, polQ
 
 //export lattigo_invNTTLvlRingQP
 func lattigo_invNTTLvlRingQP(ringQPHandle Handle14, levelQ, levelP uint64, pInHandle, pOutHandle Handle14) {
+	defer marshal.Track("lattigo_invNTTLvlRingQP").Done()
 	ringQP := getStoredRingQP(ringQPHandle)
 	pIn := getStoredPolyQP(pInHandle)
 	pOut := getStoredPolyQP(pOutHandle)
@@ -131,6 +140,7 @@ func lattigo_invNTTLvlRingQP(ringQPHandle Handle14, levelQ, levelP uint64, pInHa
 
 //export lattigo_nttLvlRingQP
 func lattigo_nttLvlRingQP(ringQPHandle Handle14, levelQ, levelP int, pInHandle, pOutHandle Handle14) {
+	defer marshal.Track("lattigo_nttLvlRingQP").Done()
 	ringQP := getStoredRingQP(ringQPHandle)
 	pIn := getStoredPolyQP(pInHandle)
 	pOut := getStoredPolyQP(pOutHandle)
@@ -139,6 +149,7 @@ func lattigo_nttLvlRingQP(ringQPHandle Handle14, levelQ, levelP int, pInHandle,
 
 //export lattigo_invNTTLvlRing
 func lattigo_invNTTLvlRing(ringHandle Handle14, level uint64, pInHandle, pOutHandle Handle14) {
+	defer marshal.Track("lattigo_invNTTLvlRing").Done()
 	ring := getStoredRing(ringHandle)
 	pIn := GetStoredPoly(pInHandle)
 	pOut := GetStoredPoly(pOutHandle)
@@ -147,6 +158,7 @@ func lattigo_invNTTLvlRing(ringHandle Handle14, level uint64, pInHandle, pOutHan
 
 //export lattigo_nttLvlRing
 func lattigo_nttLvlRing(ringHandle Handle14, level uint64, pInHandle, pOutHandle Handle14) {
+	defer marshal.Track("lattigo_nttLvlRing").Done()
 	ring := getStoredRing(ringHandle)
 	pIn := GetStoredPoly(pInHandle)
 	pOut := GetStoredPoly(pOutHandle)
@@ -155,6 +167,7 @@ func lattigo_nttLvlRing(ringHandle Handle14, level uint64, pInHandle, pOutHandle
 
 //export lattigo_invMFormLvlRingQP
 func lattigo_invMFormLvlRingQP(ringQPHandle Handle14, levelQ, levelP uint64, pInHandle, pOutHandle Handle14) {
+	defer marshal.Track("lattigo_invMFormLvlRingQP").Done()
 	ringQP := getStoredRingQP(ringQPHandle)
 	pIn := getStoredPolyQP(pInHandle)
 	pOut := getStoredPolyQP(pOutHandle)
@@ -163,6 +176,7 @@ func lattigo_invMFormLvlRingQP(ringQPHandle Handle14, levelQ, levelP uint64, pIn
 
 //export lattigo_mFormLvlRingQP
 func lattigo_mFormLvlRingQP(ringQPHandle Handle14, levelQ, levelP uint64, pInHandle, pOutHandle Handle14) {
+	defer marshal.Track("lattigo_mFormLvlRingQP").Done()
 	ringQP := getStoredRingQP(ringQPHandle)
 	pIn := getStoredPolyQP(pInHandle)
 	pOut := getStoredPolyQP(pOutHandle)
@@ -171,6 +185,7 @@ func lattigo_mFormLvlRingQP(ringQPHandle Handle14, levelQ, levelP uint64, pInHan
 
 //export lattigo_invMFormLvlRing
 func lattigo_invMFormLvlRing(ringHandle Handle14, level uint64, pInHandle, pOutHandle Handle14) {
+	defer marshal.Track("lattigo_invMFormLvlRing").Done()
 	ring := getStoredRing(ringHandle)
 	pIn := GetStoredPoly(pInHandle)
 	pOut := GetStoredPoly(pOutHandle)
@@ -179,6 +194,7 @@ func lattigo_invMFormLvlRing(ringHandle Handle14, level uint64, pInHandle, pOutH
 
 //export lattigo_mFormLvlRing
 func lattigo_mFormLvlRing(ringHandle Handle14, level uint64, pInHandle, pOutHandle Handle14) {
+	defer marshal.Track("lattigo_mFormLvlRing").Done()
 	ring := getStoredRing(ringHandle)
 	pIn := GetStoredPoly(pInHandle)
 	pOut := GetStoredPoly(pOutHandle)
@@ -187,18 +203,21 @@ func lattigo_mFormLvlRing(ringHandle Handle14, level uint64, pInHandle, pOutHand
 
 //export lattigo_polyQ
 func lattigo_polyQ(polyQPHandle Handle14) Handle14 {
+	defer marshal.Track("lattigo_polyQ").Done()
 	polyQP := getStoredPolyQP(polyQPHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(polyQP.Q))
 }
 
 //export lattigo_polyP
 func lattigo_polyP(polyQPHandle Handle14) Handle14 {
+	defer marshal.Track("lattigo_polyP").Done()
 	polyQP := getStoredPolyQP(polyQPHandle)
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(polyQP.P))
 }
 
 //export lattigo_copyLvl
 func lattigo_copyLvl(level uint64, sourcePolyHandle, targetPolyHandle Handle14) {
+	defer marshal.Track("lattigo_copyLvl").Done()
 	sourcePoly := GetStoredPoly(sourcePolyHandle)
 	targetPoly := GetStoredPoly(targetPolyHandle)
 	ring.CopyLvl(int(level), sourcePoly, targetPoly)
@@ -206,6 +225,7 @@ func lattigo_copyLvl(level uint64, sourcePolyHandle, targetPolyHandle Handle14)
 
 //export lattigo_copyLvlToOtherLvl
 func lattigo_copyLvlToOtherLvl(srcLevel, dstLevel uint64, srcPolyHandle, dstPolyHandle Handle14) {
+	defer marshal.Track("lattigo_copyLvlToOtherLvl").Done()
 	src := GetStoredPoly(srcPolyHandle)
 	dst := GetStoredPoly(dstPolyHandle)
 	copy(dst.Coeffs[int(dstLevel)], src.Coeffs[int(srcLevel)])
@@ -213,6 +233,7 @@ func lattigo_copyLvlToOtherLvl(srcLevel, dstLevel uint64, srcPolyHandle, dstPoly
 
 //export lattigo_newPoly
 func lattigo_newPoly(ringHandle Handle14) Handle14 {
+	defer marshal.Track("lattigo_newPoly").Done()
 	ring := getStoredRing(ringHandle)
 	poly := ring.NewPoly()
 	return marshal.CrossLangObjMap.Add(unsafe.Pointer(poly))
@@ -220,6 +241,7 @@ func lattigo_newPoly(ringHandle Handle14) Handle14 {
 
 //export lattigo_copyPoly
 func lattigo_copyPoly(polyTargetHandle, polySrcHandle Handle14) {
+	defer marshal.Track("lattigo_copyPoly").Done()
 	pTarget := GetStoredPoly(polyTargetHandle)
 	pSrc := GetStoredPoly(polySrcHandle)
 	pTarget.Copy(pSrc)
@@ -227,18 +249,21 @@ func lattigo_copyPoly(polyTargetHandle, polySrcHandle Handle14) {
 
 //export lattigo_polyDegree
 func lattigo_polyDegree(polyHandle Handle14) uint64 {
+	defer marshal.Track("lattigo_polyDegree").Done()
 	poly := GetStoredPoly(polyHandle)
 	return uint64(poly.N())
 }
 
 //export lattigo_ringN
 func lattigo_ringN(ringHandle Handle14) uint64 {
+	defer marshal.Track("lattigo_ringN").Done()
 	ring := getStoredRing(ringHandle)
 	return uint64(ring.N)
 }
 
 //export lattigo_permuteNTTIndex
 func lattigo_permuteNTTIndex(ringHandle Handle14, galEl uint64, outValues *C.constULong) {
+	defer marshal.Track("lattigo_permuteNTTIndex").Done()
 	ring := getStoredRing(ringHandle)
 	res := ring.PermuteNTTIndex(galEl)
 	size := unsafe.Sizeof(uint64(0))
@@ -250,6 +275,7 @@ func lattigo_permuteNTTIndex(ringHandle Handle14, galEl uint64, outValues *C.con
 
 //export lattigo_permuteNTTWithIndexLvl
 func lattigo_permuteNTTWithIndexLvl(ringHandle Handle14, level uint64, polyInHandle Handle14, index *C.constULong, polyOutHandle Handle14) {
+	defer marshal.Track("lattigo_permuteNTTWithIndexLvl").Done()
 	ring := getStoredRing(ringHandle)
 	polyIn := GetStoredPoly(polyInHandle)
 	polyOut := GetStoredPoly(polyOutHandle)
@@ -264,6 +290,7 @@ func lattigo_permuteNTTWithIndexLvl(ringHandle Handle14, level uint64, polyInHan
 
 //export lattigo_log2OfInnerSum
 func lattigo_log2OfInnerSum(levelQ uint64, ringQHandle, polyHandle Handle14) uint64 {
+	defer marshal.Track("lattigo_log2OfInnerSum").Done()
 	ringQ := getStoredRing(ringQHandle)
 	poly := GetStoredPoly(polyHandle)
 	return uint64(ringQ.Log2OfInnerSum(int(levelQ), poly))
@@ -271,6 +298,7 @@ func lattigo_log2OfInnerSum(levelQ uint64, ringQHandle, polyHandle Handle14) uin
 
 //export lattigo_mulCoeffsMontgomeryAndAddLvl
 func lattigo_mulCoeffsMontgomeryAndAddLvl(ringQPHandle Handle14, levelQ, levelP uint64, p1Handle, p2Handle, p3Handle Handle14) {
+	defer marshal.Track("lattigo_mulCoeffsMontgomeryAndAddLvl").Done()
 	p1 := getStoredPolyQP(p1Handle)
 	p2 := getStoredPolyQP(p2Handle)
 	p3 := getStoredPolyQP(p3Handle)
@@ -281,6 +309,7 @@ func lattigo_mulCoeffsMontgomeryAndAddLvl(ringQPHandle Handle14, levelQ, levelP
 
 //export lattigo_mulCoeffsMontgomeryAndAddLvlRing
 func lattigo_mulCoeffsMontgomeryAndAddLvlRing(ringHandle Handle14, level uint64, p1Handle, p2Handle, p3Handle Handle14) {
+	defer marshal.Track("lattigo_mulCoeffsMontgomeryAndAddLvlRing").Done()
 	p1 := GetStoredPoly(p1Handle)
 	p2 := GetStoredPoly(p2Handle)
 	p3 := GetStoredPoly(p3Handle)
@@ -290,6 +319,7 @@ func lattigo_mulCoeffsMontgomeryAndAddLvlRing(ringHandle Handle14, level uint64,
 
 //export lattigo_equals
 func lattigo_equals(p1Handle, p2Handle Handle14) uint64 {
+	defer marshal.Track("lattigo_equals").Done()
 	p1 := GetStoredPoly(p1Handle)
 	p2 := GetStoredPoly(p2Handle)
 	if p1.Equals(p2) {
@@ -21,6 +21,7 @@ func GetStoredKeyedPRNG(prngHandle Handle15) *utils.KeyedPRNG {
 
 //export lattigo_newPRNG
 func lattigo_newPRNG() Handle15 {
+	defer marshal.Track("lattigo_newPRNG").Done()
 	// prng is of type KeyedPRNG
 	prng, err := utils.NewPRNG()
 
@@ -32,6 +33,7 @@ func lattigo_newPRNG() Handle15 {
 
 //export lattigo_newKeyedPRNG
 func lattigo_newKeyedPRNG(key *C.char, keyLen uint64) Handle15 {
+	defer marshal.Track("lattigo_newKeyedPRNG").Done()
 	keyTmp := make([]byte, keyLen)
 	size := unsafe.Sizeof(byte(0))
 	basePtrIn := uintptr(unsafe.Pointer(&key))
@@ -2,16 +2,75 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "bootstrap.h"
+#include "latticpp/marshal/batch.h"
+#include "latticpp/marshal/completion.h"
+#include <chrono>
+#include <stdexcept>
 
 using namespace std;
 
 namespace latticpp {
 
-    Bootstrapper newBootstrapper(const Parameters &params, const BootstrappingParameters &bootParams, const BootstrappingKey &bootKey) {
+    double BootstrapStats::meanLatency() const {
+        if (latencies.empty()) {
+            return 0;
+        }
+        double total = 0;
+        for (double l : latencies) {
+            total += l;
+        }
+        return total / latencies.size();
+    }
+
+    double BootstrapStats::throughput() const {
+        if (wallSeconds <= 0) {
+            return 0;
+        }
+        return latencies.size() / wallSeconds;
+    }
+
+    Bootstrapper newBootstrapper(ParametersRef params, BootstrappingParametersRef bootParams, BootstrappingKeyRef bootKey) {
         return Bootstrapper(lattigo_newBootstrapper(params.getRawHandle(), bootParams.getRawHandle(), bootKey.getRawHandle()));
     }
 
-    Ciphertext bootstrap(const Bootstrapper &btp, const Ciphertext &ct) {
+    Ciphertext bootstrap(BootstrapperRef btp, CiphertextRef ct) {
         return Ciphertext(lattigo_bootstrap(btp.getRawHandle(), ct.getRawHandle()));
     }
+
+    future<Ciphertext> bootstrapAsync(BootstrapperRef btp, CiphertextRef ct) {
+        return callAsync<Ciphertext>([&](completionCallback callback, void *ctx) {
+            lattigo_bootstrapAsync(btp.getRawHandle(), ct.getRawHandle(), callback, ctx);
+        });
+    }
+
+    Bootstrapper shallowCopy(BootstrapperRef btp) {
+        return Bootstrapper(lattigo_bootstrapperShallowCopy(btp.getRawHandle()));
+    }
+
+    uint64_t shallowCopyBytes(BootstrapperRef btp) {
+        return lattigo_bootstrapperShallowCopyBytes(btp.getRawHandle());
+    }
+
+    vector<Ciphertext> bootstrapMany(BootstrapperRef btp, const vector<Ciphertext> &cts, uint64_t numWorkers, BootstrapStats *stats) {
+        if (numWorkers == 0) {
+            throw invalid_argument("bootstrapMany needs at least one worker");
+        }
+        vector<uint64_t> inHandles = rawHandles(cts, cts.size());
+        vector<uint64_t> outHandles(cts.size());
+        vector<uint64_t> nanos(cts.size());
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        lattigo_bootstrapMany(btp.getRawHandle(), inHandles.data(), cts.size(), numWorkers, outHandles.data(), nanos.data());
+        chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+        if (stats != nullptr) {
+            stats->latencies.resize(cts.size());
+            for (int i = 0; i < cts.size(); i++) {
+                stats->latencies[i] = nanos[i] / 1e9;
+            }
+            stats->wallSeconds = chrono::duration<double>(end - start).count();
+        }
+
+        return fromRawHandles<Ciphertext>(outHandles);
+    }
 }  // namespace latticpp
@@ -5,10 +5,45 @@
 
 #include "latticpp/marshal/gohandle.h"
 #include "cgo/bootstrap.h"
+#include <future>
+#include <vector>
 
 namespace latticpp {
 
-    Bootstrapper newBootstrapper(const Parameters &params, const BootstrappingParameters &bootParams, const BootstrappingKey &bootKey);
+    // Timing of a bootstrapMany call
+    struct BootstrapStats {
+        // time taken to bootstrap each ciphertext, in seconds, in the order of the inputs
+        std::vector<double> latencies;
+        // wall-clock time for the whole call, in seconds
+        double wallSeconds = 0;
 
-    Ciphertext bootstrap(const Bootstrapper &btp, const Ciphertext &ct);
+        double meanLatency() const;
+
+        // ciphertexts bootstrapped per second
+        double throughput() const;
+    };
+
+    Bootstrapper newBootstrapper(ParametersRef params, BootstrappingParametersRef bootParams, BootstrappingKeyRef bootKey);
+
+    Ciphertext bootstrap(BootstrapperRef btp, CiphertextRef ct);
+
+    // Bootstrap on a Go-managed thread and return immediately. `btp` must not be used by
+    // any other call until the returned future is ready.
+    std::future<Ciphertext> bootstrapAsync(BootstrapperRef btp, CiphertextRef ct);
+
+    // Create a bootstrapper which shares the bootstrapping keys with `btp` but has its own
+    // scratch buffers, so that the two can be used concurrently.
+    Bootstrapper shallowCopy(BootstrapperRef btp);
+
+    // Number of bytes of scratch buffers held by each shallow copy of `btp`. This walks the
+    // whole bootstrapper, so it is much slower than shallowCopy itself: call it once (as
+    // BootstrapperPool does), not on a hot path.
+    uint64_t shallowCopyBytes(BootstrapperRef btp);
+
+    // Bootstrap every ciphertext in `cts` concurrently, using up to `numWorkers` shallow copies
+    // of `btp`. Each copy holds its own scratch buffers, so numWorkers must be chosen by the
+    // caller and must be at least 1; BootstrapperPool::bootstrapMany instead derives it from a
+    // memory budget. If `stats` is not null, it is filled with the latency of each bootstrapping
+    // operation and the total wall-clock time.
+    std::vector<Ciphertext> bootstrapMany(BootstrapperRef btp, const std::vector<Ciphertext> &cts, uint64_t numWorkers, BootstrapStats *stats = nullptr);
 }  // namespace latticpp
@@ -15,7 +15,11 @@ namespace latticpp {
         return Parameters(lattigo_params(paramId));
     }
 
-    uint64_t ephemeralSecretWeight(const BootstrappingParameters &bootParams) {
+    uint64_t ephemeralSecretWeight(BootstrappingParametersRef bootParams) {
         return lattigo_ephemeralSecretWeight(bootParams.getRawHandle());
     }
+
+    uint64_t outputLevel(BootstrappingParametersRef bootParams) {
+        return lattigo_bootstrappingOutputLevel(bootParams.getRawHandle());
+    }
 }  // namespace latticpp
@@ -20,5 +20,8 @@ namespace latticpp {
 
     Parameters genParams(const NamedBootstrappingParams paramId);
 
-    uint64_t ephemeralSecretWeight(const BootstrappingParameters &bootParams);
+    uint64_t ephemeralSecretWeight(BootstrappingParametersRef bootParams);
+
+    // The level of a ciphertext output by a bootstrapper with these parameters
+    uint64_t outputLevel(BootstrappingParametersRef bootParams);
 }  // namespace latticpp
@@ -0,0 +1,122 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "bootstrapperpool.h"
+#include "latticpp/marshal/batch.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+namespace latticpp {
+
+    BootstrapperPool::Lease::Lease(BootstrapperPool *pool, Bootstrapper &&btp) : pool(pool), btp(move(btp)) { }
+
+    BootstrapperPool::Lease::Lease(Lease &&other) noexcept : pool(other.pool), btp(move(other.btp)) {
+        other.pool = nullptr;
+    }
+
+    BootstrapperPool::Lease::~Lease() {
+        if (pool != nullptr) {
+            pool->checkin(move(btp));
+        }
+    }
+
+    BootstrapperPool::BootstrapperPool(const Bootstrapper &prototype, uint64_t memoryBudget) : prototype(prototype) {
+        uint64_t copyBytes = max<uint64_t>(1, shallowCopyBytes(prototype));
+        maxSize = max<uint64_t>(1, memoryBudget / copyBytes);
+    }
+
+    bool BootstrapperPool::acquire(Bootstrapper &btp, bool wait) {
+        {
+            unique_lock<mutex> guard(lock);
+            if (wait) {
+                available.wait(guard, [this]() { return !idle.empty() || created < maxSize; });
+            }
+            if (!idle.empty()) {
+                btp = move(idle.back());
+                idle.pop_back();
+                return true;
+            }
+            if (created >= maxSize) {
+                return false;
+            }
+            // reserve the slot, so that concurrent callers cannot exceed maxSize
+            created++;
+        }
+        // Creating a shallow copy allocates fresh scratch buffers, so do it outside the lock
+        try {
+            btp = shallowCopy(prototype);
+        } catch (...) {
+            // give the slot back, or a failed copy would shrink the pool for good
+            {
+                lock_guard<mutex> guard(lock);
+                created--;
+            }
+            available.notify_one();
+            throw;
+        }
+        return true;
+    }
+
+    BootstrapperPool::Lease BootstrapperPool::checkout() {
+        Bootstrapper btp;
+        acquire(btp, true);
+        return Lease(this, move(btp));
+    }
+
+    vector<Ciphertext> BootstrapperPool::bootstrapMany(const vector<Ciphertext> &cts, BootstrapStats *stats) {
+        if (cts.empty()) {
+            if (stats != nullptr) {
+                *stats = BootstrapStats();
+            }
+            return vector<Ciphertext>();
+        }
+
+        // wait for one bootstrapper, then take as many more as are free right now
+        vector<Lease> leases;
+        leases.push_back(checkout());
+        while (leases.size() < cts.size()) {
+            Bootstrapper btp;
+            if (!acquire(btp, false)) {
+                break;
+            }
+            leases.push_back(Lease(this, move(btp)));
+        }
+
+        vector<uint64_t> btpHandles(leases.size());
+        for (size_t i = 0; i < leases.size(); i++) {
+            btpHandles[i] = leases[i].get().getRawHandle();
+        }
+        vector<uint64_t> inHandles = rawHandles(cts, cts.size());
+        vector<uint64_t> outHandles(cts.size());
+        vector<uint64_t> nanos(cts.size());
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        lattigo_bootstrapManyWith(btpHandles.data(), btpHandles.size(), inHandles.data(), cts.size(), outHandles.data(), nanos.data());
+        chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+        if (stats != nullptr) {
+            stats->latencies.resize(cts.size());
+            for (size_t i = 0; i < cts.size(); i++) {
+                stats->latencies[i] = nanos[i] / 1e9;
+            }
+            stats->wallSeconds = chrono::duration<double>(end - start).count();
+        }
+
+        return fromRawHandles<Ciphertext>(outHandles);
+    }
+
+    void BootstrapperPool::checkin(Bootstrapper &&btp) {
+        {
+            lock_guard<mutex> guard(lock);
+            idle.push_back(move(btp));
+        }
+        available.notify_one();
+    }
+
+    size_t BootstrapperPool::size() const {
+        lock_guard<mutex> guard(lock);
+        return created;
+    }
+}  // namespace latticpp
@@ -0,0 +1,86 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/ckks/bootstrap.h"
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace latticpp {
+
+    // Like EvaluatorPool, but for bootstrappers. Every bootstrapper in the pool is a shallow
+    // copy of a single prototype, so they all share the bootstrapping evaluation keys, but each
+    // copy still allocates its own scratch buffers. Since those buffers are large, the pool is
+    // bounded by a memory budget: at most `capacity()` copies are ever created, and checkout()
+    // blocks when all of them are in use.
+    class BootstrapperPool {
+    public:
+        // Exclusive use of one bootstrapper from the pool. The bootstrapper is returned to the
+        // pool when the lease is destroyed.
+        class Lease {
+        public:
+            Lease(Lease &&other) noexcept;
+
+            Lease(const Lease&) = delete;
+            Lease& operator= (const Lease&) = delete;
+            Lease& operator= (Lease&&) = delete;
+
+            ~Lease();
+
+            const Bootstrapper& get() const {
+                return btp;
+            }
+
+            operator BootstrapperRef() const {
+                return btp;
+            }
+
+        private:
+            friend class BootstrapperPool;
+
+            Lease(BootstrapperPool *pool, Bootstrapper &&btp);
+
+            BootstrapperPool *pool;
+            Bootstrapper btp;
+        };
+
+        // Create a pool whose bootstrappers use at most `memoryBudget` bytes of scratch space
+        // in total (but always at least one bootstrapper).
+        BootstrapperPool(const Bootstrapper &prototype, uint64_t memoryBudget);
+
+        BootstrapperPool(const BootstrapperPool&) = delete;
+        BootstrapperPool& operator= (const BootstrapperPool&) = delete;
+
+        // Borrow a bootstrapper, creating a new shallow copy of the prototype if none are idle
+        // and the pool is below capacity. Otherwise, wait until another lease is returned.
+        Lease checkout();
+
+        // Bootstrap every ciphertext in `cts` concurrently, on as many of the pool's
+        // bootstrappers as are available (at least one). See latticpp::bootstrapMany.
+        std::vector<Ciphertext> bootstrapMany(const std::vector<Ciphertext> &cts, BootstrapStats *stats = nullptr);
+
+        // Maximum number of bootstrappers this pool will create
+        size_t capacity() const {
+            return maxSize;
+        }
+
+        // Number of bootstrappers created by this pool so far
+        size_t size() const;
+
+    private:
+        // Take an idle bootstrapper or reserve room to create one. Returns false if `wait`
+        // is false and the pool is exhausted.
+        bool acquire(Bootstrapper &btp, bool wait);
+
+        void checkin(Bootstrapper &&btp);
+
+        Bootstrapper prototype;
+        size_t maxSize;
+        mutable std::mutex lock;
+        std::condition_variable available;
+        std::vector<Bootstrapper> idle;
+        size_t created = 0;
+    };
+}  // namespace latticpp
@@ -5,11 +5,11 @@
 
 namespace latticpp {
 
-    uint64_t level(const Ciphertext &ct) {
+    uint64_t level(CiphertextRef ct) {
         return lattigo_level(ct.getRawHandle());
     }
 
-    double scale(const Ciphertext &ct) {
+    double scale(CiphertextRef ct) {
         return lattigo_ciphertextGetScale(ct.getRawHandle());
     }
 
@@ -17,54 +17,54 @@ namespace latticpp {
         lattigo_ciphertextSetScale(ct.getRawHandle(), scale);
     }
 
-    uint64_t degree(const Ciphertext &ct) {
+    uint64_t degree(CiphertextRef ct) {
       return lattigo_ciphertextDegree(ct.getRawHandle());
     }
 
-    Ciphertext copyNew(const Ciphertext &ct) {
+    Ciphertext copyNew(CiphertextRef ct) {
         // a handle of 0 is an invalid Go reference (my equivalent of a nil/null pointer)
         if (ct.getRawHandle() == 0) {
-            return ct;
+            return Ciphertext(ct);
         }
         return lattigo_copyNew(ct.getRawHandle());
     }
 
-    CiphertextQP copyNew(const CiphertextQP &ctQP) {
+    CiphertextQP copyNew(CiphertextQPRef ctQP) {
         if (ctQP.getRawHandle() == 0) {
-            return ctQP;
+            return CiphertextQP(ctQP);
         }
         return lattigo_copyNewCiphertextQP(ctQP.getRawHandle());
     }
 
-    Ciphertext newCiphertext(const Parameters &params, uint64_t degree, uint64_t level) {
+    Ciphertext newCiphertext(ParametersRef params, uint64_t degree, uint64_t level) {
         return Ciphertext(lattigo_newCiphertext(params.getRawHandle(), degree, level));
     }
 
-    CiphertextQP newCiphertextQP(const Parameters &params) {
+    CiphertextQP newCiphertextQP(ParametersRef params) {
         return CiphertextQP(lattigo_newCiphertextQP(params.getRawHandle()));
     }
 
-    void setMetaData(Ciphertext &ctx, const MetaData &metaData) {
+    void setMetaData(Ciphertext &ctx, MetaDataRef metaData) {
       lattigo_setCiphertextMetaData(ctx.getRawHandle(), metaData.getRawHandle());
     }
 
-    void setMetaData(CiphertextQP &ctx, const MetaData &metaData) {
+    void setMetaData(CiphertextQP &ctx, MetaDataRef metaData) {
       lattigo_setCiphertextQPMetaData(ctx.getRawHandle(), metaData.getRawHandle());
     }
 
-    MetaData getMetaData(const CiphertextQP &ctxQP) {
+    MetaData getMetaData(CiphertextQPRef ctxQP) {
       return lattigo_getCiphertextQPMetaData(ctxQP.getRawHandle());
     }
 
-    MetaData getMetaData(const Ciphertext &ctx) {
+    MetaData getMetaData(CiphertextRef ctx) {
       return lattigo_getCiphertextMetaData(ctx.getRawHandle());
     }
 
-    Poly poly(const Ciphertext &ctx, uint64_t i) {
+    Poly poly(CiphertextRef ctx, uint64_t i) {
       return lattigo_getCiphertextPoly(ctx.getRawHandle(), i);
     }
 
-    PolyQP polyQP(const CiphertextQP &ctQP, uint64_t i) {
+    PolyQP polyQP(CiphertextQPRef ctQP, uint64_t i) {
       return lattigo_getCiphertextPolyQP(ctQP.getRawHandle(), i);
     }
 
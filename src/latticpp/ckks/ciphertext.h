@@ -8,31 +8,31 @@
 
 namespace latticpp {
 
-    uint64_t level(const Ciphertext &ct);
+    uint64_t level(CiphertextRef ct);
 
-    double scale(const Ciphertext &ct);
+    double scale(CiphertextRef ct);
 
     void setScale(Ciphertext &ct, double scale);
 
-    uint64_t degree(const Ciphertext &ct);
+    uint64_t degree(CiphertextRef ct);
 
-    Ciphertext copyNew(const Ciphertext &ct);
+    Ciphertext copyNew(CiphertextRef ct);
 
-    CiphertextQP copyNew(const CiphertextQP &ctQP);
+    CiphertextQP copyNew(CiphertextQPRef ctQP);
 
-    Ciphertext newCiphertext(const Parameters &params, uint64_t degree, uint64_t level);
+    Ciphertext newCiphertext(ParametersRef params, uint64_t degree, uint64_t level);
 
-    CiphertextQP newCiphertextQP(const Parameters &params);
+    CiphertextQP newCiphertextQP(ParametersRef params);
 
-    void setMetaData(Ciphertext &ctx, const MetaData &metaData);
+    void setMetaData(Ciphertext &ctx, MetaDataRef metaData);
 
-    void setMetaData(CiphertextQP &ctx, const MetaData &metaData);
+    void setMetaData(CiphertextQP &ctx, MetaDataRef metaData);
 
-    MetaData getMetaData(const CiphertextQP &ctxQP);
+    MetaData getMetaData(CiphertextQPRef ctxQP);
 
-    MetaData getMetaData(const Ciphertext &ctx);
+    MetaData getMetaData(CiphertextRef ctx);
 
-    Poly poly(const Ciphertext &ctx, uint64_t i);
+    Poly poly(CiphertextRef ctx, uint64_t i);
 
-    PolyQP polyQP(const CiphertextQP &ctQP, uint64_t i);
+    PolyQP polyQP(CiphertextQPRef ctQP, uint64_t i);
 }  // namespace latticpp
\ No newline at end of file
@@ -0,0 +1,428 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "circuit.h"
+#include "ciphertext.h"
+#include "evaluator.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+
+namespace latticpp {
+
+    Circuit::Value Circuit::addNode(Node &&node) {
+        for (Value arg : node.args) {
+            if (arg >= nodes.size()) {
+                throw invalid_argument("Circuit value " + to_string(arg) + " does not exist");
+            }
+        }
+        nodes.push_back(move(node));
+        return nodes.size() - 1;
+    }
+
+    Circuit::Value Circuit::input() {
+        Node node{Op::Input, {}};
+        node.k = inputs.size();
+        Value v = addNode(move(node));
+        inputs.push_back(v);
+        return v;
+    }
+
+    Circuit::Value Circuit::add(Value ct0, Value ct1) {
+        return addNode(Node{Op::Add, {ct0, ct1}});
+    }
+
+    Circuit::Value Circuit::sub(Value ct0, Value ct1) {
+        return addNode(Node{Op::Sub, {ct0, ct1}});
+    }
+
+    Circuit::Value Circuit::neg(Value ct) {
+        return addNode(Node{Op::Neg, {ct}});
+    }
+
+    Circuit::Value Circuit::mul(Value ct0, Value ct1) {
+        return addNode(Node{Op::Mul, {ct0, ct1}});
+    }
+
+    Circuit::Value Circuit::mulRelin(Value ct0, Value ct1) {
+        return addNode(Node{Op::MulRelin, {ct0, ct1}});
+    }
+
+    Circuit::Value Circuit::relinearize(Value ct) {
+        return addNode(Node{Op::Relinearize, {ct}});
+    }
+
+    Circuit::Value Circuit::rescale(Value ct, double scale) {
+        Node node{Op::Rescale, {ct}};
+        node.constant = scale;
+        return addNode(move(node));
+    }
+
+    Circuit::Value Circuit::rotate(Value ct, uint64_t k) {
+        Node node{Op::Rotate, {ct}};
+        node.k = k;
+        return addNode(move(node));
+    }
+
+    Circuit::Value Circuit::multByConst(Value ct, double constant) {
+        Node node{Op::MultByConst, {ct}};
+        node.constant = constant;
+        return addNode(move(node));
+    }
+
+    Circuit::Value Circuit::addConst(Value ct, double constant) {
+        Node node{Op::AddConst, {ct}};
+        node.constant = constant;
+        return addNode(move(node));
+    }
+
+    Circuit::Value Circuit::mulPlain(Value ct, PlaintextRef pt) {
+        Node node{Op::MulPlain, {ct}};
+        node.pt = Plaintext(pt);
+        return addNode(move(node));
+    }
+
+    Circuit::Value Circuit::addPlain(Value ct, PlaintextRef pt) {
+        Node node{Op::AddPlain, {ct}};
+        node.pt = Plaintext(pt);
+        return addNode(move(node));
+    }
+
+    Circuit::Value Circuit::subPlain(Value ct, PlaintextRef pt) {
+        Node node{Op::SubPlain, {ct}};
+        node.pt = Plaintext(pt);
+        return addNode(move(node));
+    }
+
+    Circuit::Value Circuit::dropLevel(Value ct, uint64_t levels) {
+        Node node{Op::DropLevel, {ct}};
+        node.k = levels;
+        return addNode(move(node));
+    }
+
+    Circuit::Value Circuit::bootstrap(Value ct) {
+        return addNode(Node{Op::Bootstrap, {ct}});
+    }
+
+    void Circuit::output(Value ct) {
+        if (ct >= nodes.size()) {
+            throw invalid_argument("Circuit value " + to_string(ct) + " does not exist");
+        }
+        outputs.push_back(ct);
+    }
+
+    size_t Circuit::numInputs() const {
+        return inputs.size();
+    }
+
+    size_t Circuit::numNodes() const {
+        return nodes.size();
+    }
+
+    // The state of one run of a circuit. Each node has a count of arguments which are not yet
+    // computed and a count of consumers which have not yet run (plus one per output mark).
+    // Running a node decrements the first count of its consumers, queueing those which become
+    // ready, and the second count of its arguments, releasing those which are no longer needed.
+    class Circuit::Execution {
+    public:
+        Execution(const Circuit &circuit, ParametersRef params, EvaluatorPool &pool, BootstrapperPool *bootstrappers,
+                  const vector<Ciphertext> &inputs, size_t numWorkers)
+            : circuit(circuit), params(params), pool(pool), bootstrappers(bootstrappers), inputs(inputs),
+              results(circuit.nodes.size()), consumers(circuit.nodes.size()),
+              missingArgs(new atomic<size_t>[circuit.nodes.size()]),
+              remainingUses(new atomic<size_t>[circuit.nodes.size()]),
+              queues(numWorkers), remaining(circuit.nodes.size()) {
+            const vector<Node> &nodes = circuit.nodes;
+            for (size_t i = 0; i < nodes.size(); i++) {
+                missingArgs[i] = nodes[i].args.size();
+                remainingUses[i] = 0;
+            }
+            for (size_t i = 0; i < nodes.size(); i++) {
+                for (Value arg : nodes[i].args) {
+                    consumers[arg].push_back(i);
+                    remainingUses[arg]++;
+                }
+            }
+            for (Value out : circuit.outputs) {
+                remainingUses[out]++;
+            }
+            // inputs are the only nodes without arguments
+            size_t w = 0;
+            for (Value in : circuit.inputs) {
+                queues[w].tasks.push_back(in);
+                w = (w + 1) % queues.size();
+            }
+            queued = circuit.inputs.size();
+        }
+
+        void work(size_t worker) {
+            EvaluatorPool::Lease eval = pool.checkout();
+            size_t node;
+            while (next(worker, node)) {
+                if (!failed) {
+                    try {
+                        run(eval, node);
+                    } catch (...) {
+                        fail(current_exception());
+                    }
+                }
+                finish(worker, node);
+            }
+        }
+
+        vector<Ciphertext> collect() {
+            if (error) {
+                rethrow_exception(error);
+            }
+            vector<Ciphertext> out;
+            out.reserve(circuit.outputs.size());
+            for (Value v : circuit.outputs) {
+                out.push_back(results[v]);
+            }
+            return out;
+        }
+
+    private:
+        struct WorkQueue {
+            mutex lock;
+            deque<size_t> tasks;
+        };
+
+        // Take the newest task from our own queue, or else the oldest from another worker's.
+        // Returns false once every node has run.
+        bool next(size_t worker, size_t &node) {
+            while (true) {
+                for (size_t i = 0; i < queues.size(); i++) {
+                    WorkQueue &queue = queues[(worker + i) % queues.size()];
+                    lock_guard<mutex> guard(queue.lock);
+                    if (!queue.tasks.empty()) {
+                        if (i == 0) {
+                            node = queue.tasks.back();
+                            queue.tasks.pop_back();
+                        } else {
+                            node = queue.tasks.front();
+                            queue.tasks.pop_front();
+                        }
+                        queued--;
+                        return true;
+                    }
+                }
+                unique_lock<mutex> guard(idleLock);
+                if (remaining == 0) {
+                    return false;
+                }
+                wake.wait(guard, [this]() { return queued > 0 || remaining == 0; });
+            }
+        }
+
+        void push(size_t worker, size_t node) {
+            {
+                lock_guard<mutex> guard(queues[worker].lock);
+                queues[worker].tasks.push_back(node);
+            }
+            {
+                lock_guard<mutex> guard(idleLock);
+                queued++;
+            }
+            wake.notify_one();
+        }
+
+        void release(size_t node) {
+            if (--remainingUses[node] == 0) {
+                results[node] = Ciphertext();
+            }
+        }
+
+        void finish(size_t worker, size_t node) {
+            // a result nobody uses is dropped at once; this must be checked before any consumer
+            // is queued, since consumers release the result when they finish
+            if (remainingUses[node] == 0) {
+                results[node] = Ciphertext();
+            }
+            for (size_t consumer : consumers[node]) {
+                if (--missingArgs[consumer] == 0) {
+                    push(worker, consumer);
+                }
+            }
+            for (Value arg : circuit.nodes[node].args) {
+                release(arg);
+            }
+            bool done;
+            {
+                lock_guard<mutex> guard(idleLock);
+                done = --remaining == 0;
+            }
+            if (done) {
+                wake.notify_all();
+            }
+        }
+
+        void fail(exception_ptr e) {
+            lock_guard<mutex> guard(idleLock);
+            if (!error) {
+                error = e;
+            }
+            failed = true;
+        }
+
+        Ciphertext alloc(uint64_t degree, uint64_t level) {
+            return newCiphertext(params, degree, level);
+        }
+
+        void run(EvaluatorRef eval, size_t i) {
+            const Node &node = circuit.nodes[i];
+            if (node.op == Op::Input) {
+                results[i] = inputs[node.k];
+                return;
+            }
+
+            const Ciphertext &ct0 = results[node.args[0]];
+            uint64_t deg = latticpp::degree(ct0);
+            uint64_t lvl = latticpp::level(ct0);
+            if (node.args.size() > 1) {
+                const Ciphertext &ct1 = results[node.args[1]];
+                deg = max(deg, latticpp::degree(ct1));
+                lvl = min(lvl, latticpp::level(ct1));
+            }
+
+            Ciphertext out;
+            switch (node.op) {
+                case Op::Input:
+                    break;
+                case Op::Add:
+                    out = alloc(deg, lvl);
+                    latticpp::add(eval, ct0, results[node.args[1]], out);
+                    break;
+                case Op::Sub:
+                    out = alloc(deg, lvl);
+                    latticpp::sub(eval, ct0, results[node.args[1]], out);
+                    break;
+                case Op::Neg:
+                    out = alloc(deg, lvl);
+                    latticpp::neg(eval, ct0, out);
+                    break;
+                case Op::Mul:
+                    out = alloc(2, lvl);
+                    latticpp::mul(eval, ct0, results[node.args[1]], out);
+                    break;
+                case Op::MulRelin:
+                    out = alloc(1, lvl);
+                    latticpp::mulRelin(eval, ct0, results[node.args[1]], out);
+                    break;
+                case Op::Relinearize:
+                    out = alloc(1, lvl);
+                    latticpp::relinearize(eval, ct0, out);
+                    break;
+                case Op::Rescale:
+                    out = alloc(deg, lvl);
+                    latticpp::rescale(eval, ct0, node.constant, out);
+                    break;
+                case Op::Rotate:
+                    out = alloc(1, lvl);
+                    latticpp::rotate(eval, ct0, node.k, out);
+                    break;
+                case Op::MultByConst:
+                    out = alloc(deg, lvl);
+                    latticpp::multByConst(eval, ct0, node.constant, out);
+                    break;
+                case Op::AddConst:
+                    out = alloc(deg, lvl);
+                    latticpp::addConst(eval, ct0, node.constant, out);
+                    break;
+                case Op::MulPlain:
+                    out = alloc(deg, lvl);
+                    latticpp::mulPlain(eval, ct0, node.pt, out);
+                    break;
+                case Op::AddPlain:
+                    out = alloc(deg, lvl);
+                    latticpp::addPlain(eval, ct0, node.pt, out);
+                    break;
+                case Op::SubPlain:
+                    out = alloc(deg, lvl);
+                    latticpp::subPlain(eval, ct0, node.pt, out);
+                    break;
+                case Op::DropLevel:
+                    out = copyNew(ct0);
+                    latticpp::dropLevel(eval, out, node.k);
+                    break;
+                case Op::Bootstrap: {
+                    if (bootstrappers == nullptr) {
+                        throw invalid_argument("Circuit has bootstrap operations, but no BootstrapperPool was given");
+                    }
+                    BootstrapperPool::Lease btp = bootstrappers->checkout();
+                    out = latticpp::bootstrap(btp, ct0);
+                    break;
+                }
+            }
+            results[i] = move(out);
+        }
+
+        const Circuit &circuit;
+        ParametersRef params;
+        EvaluatorPool &pool;
+        BootstrapperPool *bootstrappers;
+        const vector<Ciphertext> &inputs;
+
+        vector<Ciphertext> results;
+        vector<vector<size_t>> consumers;
+        unique_ptr<atomic<size_t>[]> missingArgs;
+        unique_ptr<atomic<size_t>[]> remainingUses;
+
+        vector<WorkQueue> queues;
+        // guards `remaining`, `queued` and `error`, and is used to park idle workers
+        mutex idleLock;
+        condition_variable wake;
+        size_t remaining;
+        atomic<size_t> queued{0};
+        atomic<bool> failed{false};
+        exception_ptr error;
+    };
+
+    vector<Ciphertext> Circuit::execute(ParametersRef params, EvaluatorPool &pool,
+                                        const vector<Ciphertext> &inputs, size_t numWorkers) const {
+        return run(params, pool, nullptr, inputs, numWorkers);
+    }
+
+    vector<Ciphertext> Circuit::execute(ParametersRef params, EvaluatorPool &pool, BootstrapperPool &bootstrappers,
+                                        const vector<Ciphertext> &inputs, size_t numWorkers) const {
+        return run(params, pool, &bootstrappers, inputs, numWorkers);
+    }
+
+    vector<Ciphertext> Circuit::run(ParametersRef params, EvaluatorPool &pool, BootstrapperPool *bootstrappers,
+                                    const vector<Ciphertext> &inputs, size_t numWorkers) const {
+        if (inputs.size() != this->inputs.size()) {
+            throw invalid_argument("Circuit has " + to_string(this->inputs.size()) + " inputs, but " +
+                                   to_string(inputs.size()) + " ciphertexts were given");
+        }
+        if (numWorkers == 0) {
+            numWorkers = max(1u, thread::hardware_concurrency());
+        }
+        numWorkers = max<size_t>(1, min(numWorkers, nodes.size()));
+
+        Execution execution(*this, params, pool, bootstrappers, inputs, numWorkers);
+        vector<thread> threads;
+        for (size_t w = 1; w < numWorkers; w++) {
+            threads.emplace_back([&execution, w]() { execution.work(w); });
+        }
+        execution.work(0);
+        for (thread &t : threads) {
+            t.join();
+        }
+        return execution.collect();
+    }
+
+    vector<Ciphertext> Circuit::execute(ParametersRef params, EvaluatorRef eval,
+                                        const vector<Ciphertext> &inputs, size_t numWorkers) const {
+        EvaluatorPool pool{Evaluator(eval)};
+        return execute(params, pool, inputs, numWorkers);
+    }
+
+}  // namespace latticpp
@@ -0,0 +1,135 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+#include "latticpp/ckks/bootstrapperpool.h"
+#include "latticpp/ckks/evaluatorpool.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace latticpp {
+
+    // A circuit is a DAG of evaluator operations over symbolic ciphertexts, built once and
+    // executed any number of times. Each builder method adds a node and returns the symbolic
+    // value it produces; values are only usable in the circuit which created them.
+    //
+    // execute() runs the circuit on a pool of worker threads with work stealing: each worker
+    // runs ready nodes from its own queue and steals from the others when it runs dry, using an
+    // evaluator from the pool (a shallow copy of a single prototype). Output ciphertexts are
+    // allocated by the executor. An intermediate result is released as soon as its last
+    // consumer has run, so the memory held at any time is bounded by the circuit's width rather
+    // than its size.
+    //
+    // Plaintexts passed to the builder are kept alive by the circuit. Building is not
+    // thread-safe, but a built circuit may be executed by several threads at once.
+    class Circuit {
+    public:
+        using Value = size_t;
+
+        // A placeholder for the next ciphertext passed to execute()
+        Value input();
+
+        Value add(Value ct0, Value ct1);
+
+        Value sub(Value ct0, Value ct1);
+
+        Value neg(Value ct);
+
+        // The product has degree 2; see mulRelin
+        Value mul(Value ct0, Value ct1);
+
+        Value mulRelin(Value ct0, Value ct1);
+
+        Value relinearize(Value ct);
+
+        Value rescale(Value ct, double scale);
+
+        Value rotate(Value ct, uint64_t k);
+
+        Value multByConst(Value ct, double constant);
+
+        Value addConst(Value ct, double constant);
+
+        Value mulPlain(Value ct, PlaintextRef pt);
+
+        Value addPlain(Value ct, PlaintextRef pt);
+
+        Value subPlain(Value ct, PlaintextRef pt);
+
+        Value dropLevel(Value ct, uint64_t levels);
+
+        // Bootstrapping requires a BootstrapperPool to be passed to execute()
+        Value bootstrap(Value ct);
+
+        // Mark a value as an output; execute() returns outputs in the order they were marked
+        void output(Value ct);
+
+        size_t numInputs() const;
+
+        size_t numNodes() const;
+
+        // Run the circuit on `inputs`, one per call to input(), with `numWorkers` threads (one
+        // per CPU if 0), one of which is the calling thread. Inputs are not modified. If an
+        // operation throws, the remaining nodes are skipped and the exception is rethrown.
+        std::vector<Ciphertext> execute(ParametersRef params, EvaluatorPool &pool,
+                                        const std::vector<Ciphertext> &inputs, size_t numWorkers = 0) const;
+
+        // As above, with a pool of shallow copies of `eval` created for this call
+        std::vector<Ciphertext> execute(ParametersRef params, EvaluatorRef eval,
+                                        const std::vector<Ciphertext> &inputs, size_t numWorkers = 0) const;
+
+        // As above, for circuits with bootstrap operations. Each bootstrap borrows a
+        // bootstrapper from `bootstrappers` for its duration.
+        std::vector<Ciphertext> execute(ParametersRef params, EvaluatorPool &pool, BootstrapperPool &bootstrappers,
+                                        const std::vector<Ciphertext> &inputs, size_t numWorkers = 0) const;
+
+    private:
+        enum class Op {
+            Input,
+            Add,
+            Sub,
+            Neg,
+            Mul,
+            MulRelin,
+            Relinearize,
+            Rescale,
+            Rotate,
+            MultByConst,
+            AddConst,
+            MulPlain,
+            AddPlain,
+            SubPlain,
+            DropLevel,
+            Bootstrap
+        };
+
+        struct Node {
+            Node(Op op, std::vector<Value> args) : op(op), args(std::move(args)) { }
+
+            Op op;
+            std::vector<Value> args;
+            // input index, rotation or number of levels, depending on op
+            uint64_t k = 0;
+            // constant or scale, depending on op
+            double constant = 0;
+            Plaintext pt;
+        };
+
+        class Execution;
+        // the level planner (planner.cpp) reads and rewrites circuits
+        friend class Planner;
+
+        Value addNode(Node &&node);
+
+        std::vector<Ciphertext> run(ParametersRef params, EvaluatorPool &pool, BootstrapperPool *bootstrappers,
+                                    const std::vector<Ciphertext> &inputs, size_t numWorkers) const;
+
+        std::vector<Node> nodes;
+        std::vector<Value> inputs;
+        std::vector<Value> outputs;
+    };
+
+}  // namespace latticpp
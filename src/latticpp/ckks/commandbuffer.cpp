@@ -0,0 +1,156 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "commandbuffer.h"
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+namespace latticpp {
+
+    void CommandBuffer::record(Op op) {
+        ops.push_back(op);
+        numOps++;
+    }
+
+    void CommandBuffer::recordHandle(uint64_t rawHandle) {
+        // a handle of 0 is an invalid Go reference (my equivalent of a nil/null pointer)
+        if (rawHandle == 0) {
+            throw invalid_argument("CommandBuffer: cannot record an operation on an empty handle");
+        }
+        auto it = handleIndex.find(rawHandle);
+        if (it == handleIndex.end()) {
+            it = handleIndex.emplace(rawHandle, handles.size()).first;
+            handles.push_back(rawHandle);
+        }
+        ops.push_back(it->second);
+    }
+
+    void CommandBuffer::recordDouble(double value) {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        ops.push_back(bits);
+    }
+
+    void CommandBuffer::add(CiphertextRef ct0, CiphertextRef ct1, CiphertextRef ctOut) {
+        record(Add);
+        recordHandle(ct0.getRawHandle());
+        recordHandle(ct1.getRawHandle());
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::addPlain(CiphertextRef ctIn, PlaintextRef pt, CiphertextRef ctOut) {
+        record(AddPlain);
+        recordHandle(ctIn.getRawHandle());
+        recordHandle(pt.getRawHandle());
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::sub(CiphertextRef ct0, CiphertextRef ct1, CiphertextRef ctOut) {
+        record(Sub);
+        recordHandle(ct0.getRawHandle());
+        recordHandle(ct1.getRawHandle());
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::subPlain(CiphertextRef ctIn, PlaintextRef pt, CiphertextRef ctOut) {
+        record(SubPlain);
+        recordHandle(ctIn.getRawHandle());
+        recordHandle(pt.getRawHandle());
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::neg(CiphertextRef ctIn, CiphertextRef ctOut) {
+        record(Neg);
+        recordHandle(ctIn.getRawHandle());
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::mul(CiphertextRef ct0, CiphertextRef ct1, CiphertextRef ctOut) {
+        record(Mul);
+        recordHandle(ct0.getRawHandle());
+        recordHandle(ct1.getRawHandle());
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::mulPlain(CiphertextRef ctIn, PlaintextRef pt, CiphertextRef ctOut) {
+        record(MulPlain);
+        recordHandle(ctIn.getRawHandle());
+        recordHandle(pt.getRawHandle());
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::mulRelin(CiphertextRef ct0, CiphertextRef ct1, CiphertextRef ctOut) {
+        record(MulRelin);
+        recordHandle(ct0.getRawHandle());
+        recordHandle(ct1.getRawHandle());
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::relinearize(CiphertextRef ctIn, CiphertextRef ctOut) {
+        record(Relinearize);
+        recordHandle(ctIn.getRawHandle());
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::multByConst(CiphertextRef ctIn, double constant, CiphertextRef ctOut) {
+        record(MultByConst);
+        recordHandle(ctIn.getRawHandle());
+        recordDouble(constant);
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::addConst(CiphertextRef ctIn, double constant, CiphertextRef ctOut) {
+        record(AddConst);
+        recordHandle(ctIn.getRawHandle());
+        recordDouble(constant);
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::multByGaussianIntegerAndAdd(CiphertextRef ctIn, uint64_t cReal, uint64_t cImag, CiphertextRef ctOut) {
+        record(MultByGaussianIntegerAndAdd);
+        recordHandle(ctIn.getRawHandle());
+        ops.push_back(cReal);
+        ops.push_back(cImag);
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::rescale(CiphertextRef ctIn, double scale, CiphertextRef ctOut) {
+        record(Rescale);
+        recordHandle(ctIn.getRawHandle());
+        recordDouble(scale);
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::rotate(CiphertextRef ctIn, uint64_t k, CiphertextRef ctOut) {
+        record(Rotate);
+        recordHandle(ctIn.getRawHandle());
+        ops.push_back(k);
+        recordHandle(ctOut.getRawHandle());
+    }
+
+    void CommandBuffer::dropLevel(CiphertextRef ct, uint64_t levels) {
+        record(DropLevel);
+        recordHandle(ct.getRawHandle());
+        ops.push_back(levels);
+    }
+
+    void CommandBuffer::submit(EvaluatorRef eval) const {
+        if (ops.empty()) {
+            return;
+        }
+        lattigo_executeCommands(eval.getRawHandle(), handles.data(), handles.size(), ops.data(), ops.size());
+    }
+
+    void CommandBuffer::clear() {
+        handles.clear();
+        handleIndex.clear();
+        ops.clear();
+        numOps = 0;
+    }
+
+    size_t CommandBuffer::size() const {
+        return numOps;
+    }
+}  // namespace latticpp
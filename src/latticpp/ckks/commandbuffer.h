@@ -0,0 +1,94 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+#include "latticpp/ckks/evaluator.h"
+#include <unordered_map>
+#include <vector>
+
+namespace latticpp {
+
+    // Records a sequence of evaluator operations and executes all of them with a single
+    // call into Go. Each distinct handle is resolved once per submission, no matter how
+    // many operations refer to it. This is useful for circuits made of many cheap
+    // operations, where the cost of crossing into Go dominates.
+    //
+    // The buffer only borrows the handles passed to it: every ciphertext and plaintext
+    // must stay alive until `submit` returns. As with the functions in evaluator.h,
+    // output ciphertexts must already be allocated.
+    class CommandBuffer {
+    public:
+        // These values must match the cmd* constants in gowrapper/ckks/evaluator.go.
+        enum Op : uint64_t {
+            Add,
+            AddPlain,
+            Sub,
+            SubPlain,
+            Neg,
+            Mul,
+            MulPlain,
+            MulRelin,
+            Relinearize,
+            MultByConst,
+            AddConst,
+            MultByGaussianIntegerAndAdd,
+            Rescale,
+            Rotate,
+            DropLevel
+        };
+
+        void add(CiphertextRef ct0, CiphertextRef ct1, CiphertextRef ctOut);
+
+        void addPlain(CiphertextRef ctIn, PlaintextRef pt, CiphertextRef ctOut);
+
+        void sub(CiphertextRef ct0, CiphertextRef ct1, CiphertextRef ctOut);
+
+        void subPlain(CiphertextRef ctIn, PlaintextRef pt, CiphertextRef ctOut);
+
+        void neg(CiphertextRef ctIn, CiphertextRef ctOut);
+
+        void mul(CiphertextRef ct0, CiphertextRef ct1, CiphertextRef ctOut);
+
+        void mulPlain(CiphertextRef ctIn, PlaintextRef pt, CiphertextRef ctOut);
+
+        void mulRelin(CiphertextRef ct0, CiphertextRef ct1, CiphertextRef ctOut);
+
+        void relinearize(CiphertextRef ctIn, CiphertextRef ctOut);
+
+        void multByConst(CiphertextRef ctIn, double constant, CiphertextRef ctOut);
+
+        void addConst(CiphertextRef ctIn, double constant, CiphertextRef ctOut);
+
+        void multByGaussianIntegerAndAdd(CiphertextRef ctIn, uint64_t cReal, uint64_t cImag, CiphertextRef ctOut);
+
+        void rescale(CiphertextRef ctIn, double scale, CiphertextRef ctOut);
+
+        void rotate(CiphertextRef ctIn, uint64_t k, CiphertextRef ctOut);
+
+        void dropLevel(CiphertextRef ct, uint64_t levels);
+
+        // Execute all recorded operations in order. The buffer is left unchanged, so it can be
+        // submitted again (e.g., to run the same circuit on new inputs written to the same handles).
+        void submit(EvaluatorRef eval) const;
+
+        // Remove all recorded operations
+        void clear();
+
+        // Number of recorded operations
+        size_t size() const;
+
+    private:
+        void record(Op op);
+
+        void recordHandle(uint64_t rawHandle);
+
+        void recordDouble(double value);
+
+        std::vector<uint64_t> handles;
+        std::unordered_map<uint64_t, uint64_t> handleIndex;
+        std::vector<uint64_t> ops;
+        size_t numOps = 0;
+    };
+}  // namespace latticpp
@@ -6,137 +6,137 @@ using namespace std;
 
 namespace latticpp {
 
-    CKGProtocol newCKGProtocol(const Parameters &params) {
+    CKGProtocol newCKGProtocol(ParametersRef params) {
         return CKGProtocol(lattigo_newCKGProtocol(params.getRawHandle()));
     }
 
-    CKGShare ckgAllocateShare(const CKGProtocol &protocol) {
+    CKGShare ckgAllocateShare(CKGProtocolRef protocol) {
         return CKGShare(lattigo_ckgAllocateShare(protocol.getRawHandle()));
     }
 
-    CKGCRP ckgSampleCRP(const CKGProtocol &protocol, const PRNG &prng) {
+    CKGCRP ckgSampleCRP(CKGProtocolRef protocol, PRNGRef prng) {
         return CKGCRP(lattigo_ckgSampleCRP(protocol.getRawHandle(), prng.getRawHandle()));
     }    
 
-    void ckgGenShare(const CKGProtocol &protocol, const SecretKey &sk,
-                    const CKGCRP &crp, CKGShare &shareOut) {
+    void ckgGenShare(CKGProtocolRef protocol, SecretKeyRef sk,
+                    CKGCRPRef crp, CKGShare &shareOut) {
         lattigo_ckgGenShare(protocol.getRawHandle(), sk.getRawHandle(),
                             crp.getRawHandle(), shareOut.getRawHandle());
     }
 
-    void ckgAggregateShares(const CKGProtocol &protocol, const CKGShare &share1,
-                            const CKGShare &share2, CKGShare &shareOut) {
+    void ckgAggregateShares(CKGProtocolRef protocol, CKGShareRef share1,
+                            CKGShareRef share2, CKGShare &shareOut) {
         lattigo_ckgAggregateShares(protocol.getRawHandle(), share1.getRawHandle(),
                                     share2.getRawHandle(), shareOut.getRawHandle());
     }
 
-    void ckgGenPublicKey(const CKGProtocol &protocol, const CKGShare &roundShare,
-                        const CKGCRP &crp, PublicKey &pk) {
+    void ckgGenPublicKey(CKGProtocolRef protocol, CKGShareRef roundShare,
+                        CKGCRPRef crp, PublicKey &pk) {
         lattigo_ckgGenPublicKey(protocol.getRawHandle(), roundShare.getRawHandle(),
                                 crp.getRawHandle(), pk.getRawHandle());
     }
 
-    RKGProtocol newRKGProtocol(const Parameters &params) {
+    RKGProtocol newRKGProtocol(ParametersRef params) {
         return RKGProtocol(lattigo_newRKGProtocol(params.getRawHandle()));
     }
 
     RKGShare newRKGShare() { return RKGShare(lattigo_newRKGShare()); }
 
-    void rkgAllocateShare(const RKGProtocol &protocol, SecretKey &ephSk,
+    void rkgAllocateShare(RKGProtocolRef protocol, SecretKey &ephSk,
                         RKGShare &share1, RKGShare &share2) {
         lattigo_rkgAllocateShare(protocol.getRawHandle(), ephSk.getRawHandle(),
                                     share1.getRawHandle(), share2.getRawHandle());
     }
 
-    RKGCRP rkgSampleCRP(const RKGProtocol &protocol, const PRNG &prng) {
+    RKGCRP rkgSampleCRP(RKGProtocolRef protocol, PRNGRef prng) {
         return RKGCRP(lattigo_rkgSampleCRP(protocol.getRawHandle(), prng.getRawHandle()));
     }
 
-    void rkgGenShareRoundOne(const RKGProtocol &protocol, const SecretKey &sk,
-                            const RKGCRP &crp, SecretKey &ephSkOut,
+    void rkgGenShareRoundOne(RKGProtocolRef protocol, SecretKeyRef sk,
+                            RKGCRPRef crp, SecretKey &ephSkOut,
                             RKGShare &shareOut) {
         lattigo_rkgGenShareRoundOne(protocol.getRawHandle(), sk.getRawHandle(),
                                     crp.getRawHandle(), ephSkOut.getRawHandle(),
                                     shareOut.getRawHandle());
     }
 
-    void rkgGenShareRoundTwo(const RKGProtocol &protocol, const SecretKey &ephSk,
-                            const SecretKey &sk, const RKGShare &round1,
+    void rkgGenShareRoundTwo(RKGProtocolRef protocol, SecretKeyRef ephSk,
+                            SecretKeyRef sk, RKGShareRef round1,
                             RKGShare &shareOut) {
         lattigo_rkgGenShareRoundTwo(protocol.getRawHandle(), ephSk.getRawHandle(),
                                     sk.getRawHandle(), round1.getRawHandle(),
                                     shareOut.getRawHandle());
     }
 
-    void rkgAggregateShares(const RKGProtocol &protocol, const RKGShare &share1,
-                            const RKGShare &share2, RKGShare &shareOut) {
+    void rkgAggregateShares(RKGProtocolRef protocol, RKGShareRef share1,
+                            RKGShareRef share2, RKGShare &shareOut) {
         lattigo_rkgAggregateShares(protocol.getRawHandle(), share1.getRawHandle(),
                                     share2.getRawHandle(), shareOut.getRawHandle());
     }
 
-    void rkgGenRelinearizationKey(const RKGProtocol &protocol,
-                                const RKGShare &round1, const RKGShare &round2,
+    void rkgGenRelinearizationKey(RKGProtocolRef protocol,
+                                RKGShareRef round1, RKGShareRef round2,
                                 RelinearizationKey &rlnKeyOut) {
         lattigo_rkgGenRelinearizationKey(protocol.getRawHandle(),
                                         round1.getRawHandle(), round2.getRawHandle(),
                                         rlnKeyOut.getRawHandle());
     }
 
-    CKSProtocol newCKSProtocol(const Parameters &params, double sigmaSmudging) {
+    CKSProtocol newCKSProtocol(ParametersRef params, double sigmaSmudging) {
         return CKSProtocol(
             lattigo_newCKSProtocol(params.getRawHandle(), sigmaSmudging));
     }
 
-    CKSShare cksAllocateShare(const CKSProtocol &protocol, uint64_t level) {
+    CKSShare cksAllocateShare(CKSProtocolRef protocol, uint64_t level) {
         return CKSShare(lattigo_cksAllocateShare(protocol.getRawHandle(), level));
     }
 
-    void cksGenShare(const CKSProtocol &protocol, const SecretKey &skInput,
-                    const SecretKey &skOutput, const Ciphertext &ct,
+    void cksGenShare(CKSProtocolRef protocol, SecretKeyRef skInput,
+                    SecretKeyRef skOutput, CiphertextRef ct,
                     CKSShare &shareOut) {
         lattigo_cksGenShare(protocol.getRawHandle(), skInput.getRawHandle(),
                             skOutput.getRawHandle(), ct.getRawHandle(),
                             shareOut.getRawHandle());
     }
 
-    void cksAggregateShares(const CKSProtocol &protocol, const CKSShare &share1,
-                            const CKSShare &share2, CKSShare &shareOut) {
+    void cksAggregateShares(CKSProtocolRef protocol, CKSShareRef share1,
+                            CKSShareRef share2, CKSShare &shareOut) {
         lattigo_cksAggregateShares(protocol.getRawHandle(), share1.getRawHandle(),
                                     share2.getRawHandle(), shareOut.getRawHandle());
     }
 
-    void cksKeySwitch(const CKSProtocol &protocol, const Ciphertext &ct,
-                    const CKSShare &combined, Ciphertext &ctOut) {
+    void cksKeySwitch(CKSProtocolRef protocol, CiphertextRef ct,
+                    CKSShareRef combined, Ciphertext &ctOut) {
         lattigo_cksKeySwitch(protocol.getRawHandle(), ct.getRawHandle(),
                             combined.getRawHandle(), ctOut.getRawHandle());
     }
 
-    RTGProtocol newRTGProtocol(const Parameters &params) {
+    RTGProtocol newRTGProtocol(ParametersRef params) {
         return RTGProtocol(lattigo_newRTGProtocol(params.getRawHandle()));
     }
 
-    RTGShare rtgAllocateShare(const RTGProtocol &protocol) {
+    RTGShare rtgAllocateShare(RTGProtocolRef protocol) {
         return RTGShare(lattigo_rtgAllocateShare(protocol.getRawHandle()));
     }
 
-    RTGCRP rtgSampleCRP(const RTGProtocol &protocol, const PRNG &prng) {
+    RTGCRP rtgSampleCRP(RTGProtocolRef protocol, PRNGRef prng) {
         return RTGCRP(lattigo_rtgSampleCRP(protocol.getRawHandle(), prng.getRawHandle()));
     }    
 
-    void rtgGenShare(const RTGProtocol &protocol, const SecretKey &sk,
-                    uint64_t galEl, const RTGCRP &crp, RTGShare &shareOut) {
+    void rtgGenShare(RTGProtocolRef protocol, SecretKeyRef sk,
+                    uint64_t galEl, RTGCRPRef crp, RTGShare &shareOut) {
         lattigo_rtgGenShare(protocol.getRawHandle(), sk.getRawHandle(), galEl,
                             crp.getRawHandle(), shareOut.getRawHandle());
     }
 
-    void rtgAggregateShares(const RTGProtocol &protocol, const RTGShare &share1,
-                    const RTGShare &share2, RTGShare &shareOut) {
+    void rtgAggregateShares(RTGProtocolRef protocol, RTGShareRef share1,
+                    RTGShareRef share2, RTGShare &shareOut) {
         lattigo_rtgAggregateShares(protocol.getRawHandle(), share1.getRawHandle(),
                             share2.getRawHandle(), shareOut.getRawHandle());
     }
 
-    void rtgGenRotationKey(const RTGProtocol &protocol, const RTGShare &share,
-                        const RTGCRP &crp, SwitchingKey &rotKey) {
+    void rtgGenRotationKey(RTGProtocolRef protocol, RTGShareRef share,
+                        RTGCRPRef crp, SwitchingKey &rotKey) {
         lattigo_rtgGenRotationKey(protocol.getRawHandle(), share.getRawHandle(),
                                     crp.getRawHandle(), rotKey.getRawHandle());
     }
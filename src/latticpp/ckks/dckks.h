@@ -8,72 +8,72 @@
 
 namespace latticpp {
 
-    CKGProtocol newCKGProtocol(const Parameters &params);
+    CKGProtocol newCKGProtocol(ParametersRef params);
 
-    CKGShare ckgAllocateShare(const CKGProtocol &protocol);
+    CKGShare ckgAllocateShare(CKGProtocolRef protocol);
 
-    CKGCRP ckgSampleCRP(const CKGProtocol &protocol, const PRNG &prng);
+    CKGCRP ckgSampleCRP(CKGProtocolRef protocol, PRNGRef prng);
 
-    void ckgGenShare(const CKGProtocol &protocol, const SecretKey &sk,
-                    const CKGCRP &crp, CKGShare &shareOut);
+    void ckgGenShare(CKGProtocolRef protocol, SecretKeyRef sk,
+                    CKGCRPRef crp, CKGShare &shareOut);
 
-    void ckgAggregateShares(const CKGProtocol &protocol, const CKGShare &share1,
-                            const CKGShare &share2, CKGShare &shareOut);
+    void ckgAggregateShares(CKGProtocolRef protocol, CKGShareRef share1,
+                            CKGShareRef share2, CKGShare &shareOut);
 
-    void ckgGenPublicKey(const CKGProtocol &protocol, const CKGShare &roundShare,
-                        const CKGCRP &crp, PublicKey &pk);
+    void ckgGenPublicKey(CKGProtocolRef protocol, CKGShareRef roundShare,
+                        CKGCRPRef crp, PublicKey &pk);
 
-    RKGProtocol newRKGProtocol(const Parameters &params);
+    RKGProtocol newRKGProtocol(ParametersRef params);
 
     RKGShare newRKGShare();
 
-    void rkgAllocateShare(const RKGProtocol &protocol, SecretKey &ephSk,
+    void rkgAllocateShare(RKGProtocolRef protocol, SecretKey &ephSk,
                         RKGShare &share1, RKGShare &share2);
 
-    RKGCRP rkgSampleCRP(const RKGProtocol &protocol, const PRNG &prng);
+    RKGCRP rkgSampleCRP(RKGProtocolRef protocol, PRNGRef prng);
 
-    void rkgGenShareRoundOne(const RKGProtocol &protocol, const SecretKey &sk,
-                            const RKGCRP &crp, SecretKey &ephSkOut,
+    void rkgGenShareRoundOne(RKGProtocolRef protocol, SecretKeyRef sk,
+                            RKGCRPRef crp, SecretKey &ephSkOut,
                             RKGShare &shareOut);
 
-    void rkgGenShareRoundTwo(const RKGProtocol &protocol, const SecretKey &ephSk,
-                            const SecretKey &sk, const RKGShare &round1,
+    void rkgGenShareRoundTwo(RKGProtocolRef protocol, SecretKeyRef ephSk,
+                            SecretKeyRef sk, RKGShareRef round1,
                             RKGShare &shareOut);
 
-    void rkgAggregateShares(const RKGProtocol &protocol, const RKGShare &share1,
-                            const RKGShare &share2, RKGShare &shareOut);
+    void rkgAggregateShares(RKGProtocolRef protocol, RKGShareRef share1,
+                            RKGShareRef share2, RKGShare &shareOut);
 
-    void rkgGenRelinearizationKey(const RKGProtocol &protocol,
-                                const RKGShare &round1, const RKGShare &round2,
+    void rkgGenRelinearizationKey(RKGProtocolRef protocol,
+                                RKGShareRef round1, RKGShareRef round2,
                                 RelinearizationKey &rlnKeyOut);
 
-    CKSProtocol newCKSProtocol(const Parameters &params, double sigmaSmudging);
+    CKSProtocol newCKSProtocol(ParametersRef params, double sigmaSmudging);
 
-    CKSShare cksAllocateShare(const CKSProtocol &protocol, uint64_t level);
+    CKSShare cksAllocateShare(CKSProtocolRef protocol, uint64_t level);
 
-    void cksGenShare(const CKSProtocol &protocol, const SecretKey &skInput,
-                    const SecretKey &skOutput, const Ciphertext &ct,
+    void cksGenShare(CKSProtocolRef protocol, SecretKeyRef skInput,
+                    SecretKeyRef skOutput, CiphertextRef ct,
                     CKSShare &shareOut);
 
-    void cksAggregateShares(const CKSProtocol &protocol, const CKSShare &share1,
-                            const CKSShare &share2, CKSShare &shareOut);
+    void cksAggregateShares(CKSProtocolRef protocol, CKSShareRef share1,
+                            CKSShareRef share2, CKSShare &shareOut);
 
-    void cksKeySwitch(const CKSProtocol &protocol, const Ciphertext &ct,
-                    const CKSShare &combined, Ciphertext &ctOut);
+    void cksKeySwitch(CKSProtocolRef protocol, CiphertextRef ct,
+                    CKSShareRef combined, Ciphertext &ctOut);
 
-    RTGProtocol newRTGProtocol(const Parameters &params);
+    RTGProtocol newRTGProtocol(ParametersRef params);
 
-    RTGShare rtgAllocateShare(const RTGProtocol &protocol);
+    RTGShare rtgAllocateShare(RTGProtocolRef protocol);
 
-    RTGCRP rtgSampleCRP(const RTGProtocol &protocol, const PRNG &prng);
+    RTGCRP rtgSampleCRP(RTGProtocolRef protocol, PRNGRef prng);
 
-    void rtgGenShare(const RTGProtocol &protocol, const SecretKey &sk,
-                    uint64_t galEl, const RTGCRP &crp,
+    void rtgGenShare(RTGProtocolRef protocol, SecretKeyRef sk,
+                    uint64_t galEl, RTGCRPRef crp,
                     RTGShare &shareOut);
 
-    void rtgAggregateShares(const RTGProtocol &protocol, const RTGShare &share1,
-                    const RTGShare &share2, RTGShare &shareOut);
+    void rtgAggregateShares(RTGProtocolRef protocol, RTGShareRef share1,
+                    RTGShareRef share2, RTGShare &shareOut);
 
-    void rtgGenRotationKey(const RTGProtocol &protocol, const RTGShare &share,
-                        const RTGCRP &crp, SwitchingKey &rotKey);
+    void rtgGenRotationKey(RTGProtocolRef protocol, RTGShareRef share,
+                        RTGCRPRef crp, SwitchingKey &rotKey);
 } // namespace latticpp
\ No newline at end of file
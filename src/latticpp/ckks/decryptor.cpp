@@ -5,11 +5,11 @@
 
 namespace latticpp {
 
-    Decryptor newDecryptor(const Parameters &params, const SecretKey &sk) {
+    Decryptor newDecryptor(ParametersRef params, SecretKeyRef sk) {
         return Decryptor(lattigo_newDecryptor(params.getRawHandle(), sk.getRawHandle()));
     }
 
-    Plaintext decryptNew(const Decryptor &decryptor, const Ciphertext &ct) {
+    Plaintext decryptNew(DecryptorRef decryptor, CiphertextRef ct) {
         return Plaintext(lattigo_decryptNew(decryptor.getRawHandle(), ct.getRawHandle()));
     }
 }  // namespace latticpp
@@ -8,7 +8,7 @@
 
 namespace latticpp {
 
-    Decryptor newDecryptor(const Parameters &params, const SecretKey &sk);
+    Decryptor newDecryptor(ParametersRef params, SecretKeyRef sk);
 
-    Plaintext decryptNew(const Decryptor &decryptor, const Ciphertext &ct);
+    Plaintext decryptNew(DecryptorRef decryptor, CiphertextRef ct);
 }  // namespace latticpp
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "encoder.h"
+#include "latticpp/marshal/batch.h"
 #include <cmath>
 #include <stdexcept>
 #include <iostream>
@@ -10,11 +11,11 @@ using namespace std;
 
 namespace latticpp {
 
-    Encoder newEncoder(const Parameters &params) {
+    Encoder newEncoder(ParametersRef params) {
         return Encoder(lattigo_newEncoder(params.getRawHandle()));
     }
 
-    void encode(const Encoder &encoder, const vector<double> &values, Plaintext &outPt) {
+    void encode(EncoderRef encoder, const vector<double> &values, Plaintext &outPt) {
         int len = values.size();
         int logLen = log2(len);
 
@@ -25,7 +26,7 @@ namespace latticpp {
         lattigo_encode(encoder.getRawHandle(), values.data(), logLen, outPt.getRawHandle());
     }
 
-    Plaintext encodeNew(const Encoder &encoder, const std::vector<double> &values, uint64_t level, double scale) {
+    Plaintext encodeNew(EncoderRef encoder, const std::vector<double> &values, uint64_t level, double scale) {
         int len = values.size();
         int logLen = log2(len);
 
@@ -36,10 +37,68 @@ namespace latticpp {
         return Plaintext(lattigo_encodeNew(encoder.getRawHandle(), values.data(), level, scale, logLen));
     }
 
-    vector<double> decode(const Encoder &encoder, const Plaintext &pt, uint64_t logSlots) {
+    vector<double> decode(EncoderRef encoder, PlaintextRef pt, uint64_t logSlots) {
         vector<double> coeffs(((uint64_t)1) << logSlots);
         lattigo_decode(encoder.getRawHandle(), pt.getRawHandle(), logSlots, coeffs.data());
         return coeffs;
     }
 
+    // std::complex<double> is guaranteed to have the layout of double[2], which is also
+    // the layout of a Go complex128, so Go reads and writes these buffers in place.
+    static uint64_t complexLogLen(size_t len) {
+        if (len == 0) {
+            throw invalid_argument("Invalid input length for complex encode/decode");
+        }
+        int logLen = log2(len);
+        if (len != pow(2, logLen)) {
+            throw invalid_argument("Invalid input length for complex encode/decode");
+        }
+        return logLen;
+    }
+
+    void encode(EncoderRef encoder, const complex<double> *values, size_t len, Plaintext &outPt) {
+        uint64_t logLen = complexLogLen(len);
+        lattigo_encodeComplex(encoder.getRawHandle(), reinterpret_cast<const double*>(values), logLen, outPt.getRawHandle());
+    }
+
+    void encode(EncoderRef encoder, const vector<complex<double>> &values, Plaintext &outPt) {
+        encode(encoder, values.data(), values.size(), outPt);
+    }
+
+    Plaintext encodeNew(EncoderRef encoder, const complex<double> *values, size_t len, uint64_t level, double scale) {
+        uint64_t logLen = complexLogLen(len);
+        return Plaintext(lattigo_encodeComplexNew(encoder.getRawHandle(), reinterpret_cast<const double*>(values), level, scale, logLen));
+    }
+
+    Plaintext encodeNew(EncoderRef encoder, const vector<complex<double>> &values, uint64_t level, double scale) {
+        return encodeNew(encoder, values.data(), values.size(), level, scale);
+    }
+
+    void decode(EncoderRef encoder, PlaintextRef pt, complex<double> *out, size_t len) {
+        uint64_t logSlots = complexLogLen(len);
+        lattigo_decodeComplex(encoder.getRawHandle(), pt.getRawHandle(), logSlots, reinterpret_cast<double*>(out));
+    }
+
+    vector<complex<double>> decodeComplex(EncoderRef encoder, PlaintextRef pt, uint64_t logSlots) {
+        vector<complex<double>> values(((uint64_t)1) << logSlots);
+        decode(encoder, pt, values.data(), values.size());
+        return values;
+    }
+
+    vector<Plaintext> encodeBatch(EncoderRef encoder, const vector<vector<double>> &rows,
+                                  uint64_t level, double scale, uint64_t numWorkers) {
+        uint64_t logLen;
+        vector<const double*> ptrs = rowPointers(rows, logLen);
+        vector<uint64_t> handles(rows.size());
+        lattigo_encodeBatch(encoder.getRawHandle(), ptrs.data(), rows.size(), logLen, level, scale, handles.data(), true, numWorkers);
+        return fromRawHandles<Plaintext>(handles);
+    }
+
+    void encodeBatch(EncoderRef encoder, const vector<vector<double>> &rows,
+                     vector<Plaintext> &outPts, uint64_t numWorkers) {
+        uint64_t logLen;
+        vector<const double*> ptrs = rowPointers(rows, logLen);
+        vector<uint64_t> handles = rawHandles(outPts, rows.size());
+        lattigo_encodeBatch(encoder.getRawHandle(), ptrs.data(), rows.size(), logLen, 0, 0, handles.data(), false, numWorkers);
+    }
 }  // namespace latticpp
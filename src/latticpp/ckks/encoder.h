@@ -5,15 +5,40 @@
 
 #include "latticpp/marshal/gohandle.h"
 #include "cgo/encoder.h"
+#include <complex>
 #include <vector>
 
 namespace latticpp {
 
-    Encoder newEncoder(const Parameters &params);
+    Encoder newEncoder(ParametersRef params);
 
-    void encode(const Encoder &encoder, const std::vector<double> &values, Plaintext &outPt);
+    void encode(EncoderRef encoder, const std::vector<double> &values, Plaintext &outPt);
 
-    Plaintext encodeNew(const Encoder &encoder, const std::vector<double> &values, uint64_t level, double scale);
+    Plaintext encodeNew(EncoderRef encoder, const std::vector<double> &values, uint64_t level, double scale);
 
-    std::vector<double> decode(const Encoder &encoder, const Plaintext &pt, uint64_t logSlots);
+    std::vector<double> decode(EncoderRef encoder, PlaintextRef pt, uint64_t logSlots);
+
+    // Complex-valued variants, which use both the real and imaginary part of each slot. The
+    // values are read directly from (or written directly to) the caller's buffer, whose
+    // length must be a power of two; it determines the number of slots used.
+    void encode(EncoderRef encoder, const std::complex<double> *values, size_t len, Plaintext &outPt);
+
+    void encode(EncoderRef encoder, const std::vector<std::complex<double>> &values, Plaintext &outPt);
+
+    Plaintext encodeNew(EncoderRef encoder, const std::complex<double> *values, size_t len, uint64_t level, double scale);
+
+    Plaintext encodeNew(EncoderRef encoder, const std::vector<std::complex<double>> &values, uint64_t level, double scale);
+
+    void decode(EncoderRef encoder, PlaintextRef pt, std::complex<double> *out, size_t len);
+
+    std::vector<std::complex<double>> decodeComplex(EncoderRef encoder, PlaintextRef pt, uint64_t logSlots);
+
+    // Encode many rows at once, spread across `numWorkers` shallow copies of the encoder (one
+    // per CPU if numWorkers is 0). All rows must have the same power-of-two length.
+    std::vector<Plaintext> encodeBatch(EncoderRef encoder, const std::vector<std::vector<double>> &rows,
+                                       uint64_t level, double scale, uint64_t numWorkers = 0);
+
+    // As above, but encode into existing plaintexts (at their own level and scale)
+    void encodeBatch(EncoderRef encoder, const std::vector<std::vector<double>> &rows,
+                     std::vector<Plaintext> &outPts, uint64_t numWorkers = 0);
 }  // namespace latticpp
@@ -2,23 +2,59 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "encryptor.h"
+#include "latticpp/marshal/batch.h"
+
+using namespace std;
 
 namespace latticpp {
 
-    Encryptor newEncryptor(const Parameters &params, const SecretKey &sk) {
+    Encryptor newEncryptor(ParametersRef params, SecretKeyRef sk) {
         return Encryptor(lattigo_newEncryptorFromSk(params.getRawHandle(), sk.getRawHandle()));
     }
 
-    Encryptor newEncryptor(const Parameters &params, const PublicKey &pk) {
+    Encryptor newEncryptor(ParametersRef params, PublicKeyRef pk) {
         return Encryptor(lattigo_newEncryptorFromPk(params.getRawHandle(), pk.getRawHandle()));
     }
 
-    Ciphertext encryptNew(const Encryptor &encryptor, const Plaintext &pt) {
+    Ciphertext encryptNew(EncryptorRef encryptor, PlaintextRef pt) {
         return Ciphertext(lattigo_encryptNew(encryptor.getRawHandle(), pt.getRawHandle()));
     }
 
-    void encryptZeroQP(const Parameters &params, const SecretKey &sk, CiphertextQP &ctxQP){
+    vector<Ciphertext> encryptBatch(EncryptorRef encryptor, const vector<Plaintext> &pts, uint64_t numWorkers) {
+        vector<uint64_t> ptHandles = rawHandles(pts, pts.size());
+        vector<uint64_t> ctHandles(pts.size());
+        lattigo_encryptBatch(encryptor.getRawHandle(), ptHandles.data(), pts.size(), ctHandles.data(), true, numWorkers);
+        return fromRawHandles<Ciphertext>(ctHandles);
+    }
+
+    void encryptBatch(EncryptorRef encryptor, const vector<Plaintext> &pts, vector<Ciphertext> &outCts, uint64_t numWorkers) {
+        vector<uint64_t> ptHandles = rawHandles(pts, pts.size());
+        vector<uint64_t> ctHandles = rawHandles(outCts, pts.size());
+        lattigo_encryptBatch(encryptor.getRawHandle(), ptHandles.data(), pts.size(), ctHandles.data(), false, numWorkers);
+    }
+
+    void encryptZeroQP(ParametersRef params, SecretKeyRef sk, CiphertextQP &ctxQP){
         lattigo_encryptZeroQP(params.getRawHandle(), sk.getRawHandle(), ctxQP.getRawHandle());
     }
 
+    vector<Ciphertext> encodeEncryptBatch(ParametersRef params, EncoderRef encoder, EncryptorRef encryptor,
+                                          const vector<vector<double>> &rows,
+                                          uint64_t level, double scale, uint64_t numWorkers) {
+        uint64_t logLen;
+        vector<const double*> ptrs = rowPointers(rows, logLen);
+        vector<uint64_t> handles(rows.size());
+        lattigo_encodeEncryptBatch(params.getRawHandle(), encoder.getRawHandle(), encryptor.getRawHandle(),
+                                   ptrs.data(), rows.size(), logLen, level, scale, handles.data(), true, numWorkers);
+        return fromRawHandles<Ciphertext>(handles);
+    }
+
+    void encodeEncryptBatch(ParametersRef params, EncoderRef encoder, EncryptorRef encryptor,
+                            const vector<vector<double>> &rows, uint64_t level, double scale,
+                            vector<Ciphertext> &outCts, uint64_t numWorkers) {
+        uint64_t logLen;
+        vector<const double*> ptrs = rowPointers(rows, logLen);
+        vector<uint64_t> handles = rawHandles(outCts, rows.size());
+        lattigo_encodeEncryptBatch(params.getRawHandle(), encoder.getRawHandle(), encryptor.getRawHandle(),
+                                   ptrs.data(), rows.size(), logLen, level, scale, handles.data(), false, numWorkers);
+    }
 }  // namespace latticpp
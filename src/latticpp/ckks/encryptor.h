@@ -5,14 +5,34 @@
 
 #include "latticpp/marshal/gohandle.h"
 #include "cgo/encryptor.h"
+#include <vector>
 
 namespace latticpp {
 
-    Encryptor newEncryptor(const Parameters &params, const SecretKey &sk);
+    Encryptor newEncryptor(ParametersRef params, SecretKeyRef sk);
 
-    Encryptor newEncryptor(const Parameters &params, const PublicKey &pk);
+    Encryptor newEncryptor(ParametersRef params, PublicKeyRef pk);
 
-    Ciphertext encryptNew(const Encryptor &encryptor, const Plaintext &pt);
+    Ciphertext encryptNew(EncryptorRef encryptor, PlaintextRef pt);
 
-    void encryptZeroQP(const Parameters &params, const SecretKey &sk, CiphertextQP &ctxQP);
+    // Encrypt many plaintexts at once, spread across `numWorkers` shallow copies of the
+    // encryptor (one per CPU if numWorkers is 0). See also encodeEncryptBatch.
+    std::vector<Ciphertext> encryptBatch(EncryptorRef encryptor, const std::vector<Plaintext> &pts, uint64_t numWorkers = 0);
+
+    // As above, but encrypt into existing ciphertexts
+    void encryptBatch(EncryptorRef encryptor, const std::vector<Plaintext> &pts, std::vector<Ciphertext> &outCts, uint64_t numWorkers = 0);
+
+    // Encode and encrypt many rows at once. All rows must have the same power-of-two length.
+    // Each worker uses its own shallow copies of the encoder and encryptor and a single scratch
+    // plaintext, so no plaintext handles are created.
+    std::vector<Ciphertext> encodeEncryptBatch(ParametersRef params, EncoderRef encoder, EncryptorRef encryptor,
+                                               const std::vector<std::vector<double>> &rows,
+                                               uint64_t level, double scale, uint64_t numWorkers = 0);
+
+    // As above, but encrypt into existing ciphertexts
+    void encodeEncryptBatch(ParametersRef params, EncoderRef encoder, EncryptorRef encryptor,
+                            const std::vector<std::vector<double>> &rows, uint64_t level, double scale,
+                            std::vector<Ciphertext> &outCts, uint64_t numWorkers = 0);
+
+    void encryptZeroQP(ParametersRef params, SecretKeyRef sk, CiphertextQP &ctxQP);
 }  // namespace latticpp
@@ -2,26 +2,35 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "evaluator.h"
+#include "ciphertext.h"
+#include "latticpp/marshal/batch.h"
+#include "latticpp/marshal/completion.h"
+#include <cmath>
+#include <stdexcept>
 
 using namespace std;
 
 namespace latticpp {
 
-    Evaluator newEvaluator(const Parameters &params, const EvaluationKey &evalKey) {
+    Evaluator newEvaluator(ParametersRef params, EvaluationKeyRef evalKey) {
         return Evaluator(lattigo_newEvaluator(params.getRawHandle(), evalKey.getRawHandle()));
     }
 
-    Evaluator evaluatorWithKey(const Evaluator &eval,
-                               const EvaluationKey &evalKey) {
+    Evaluator evaluatorWithKey(EvaluatorRef eval,
+                               EvaluationKeyRef evalKey) {
       return Evaluator(lattigo_evaluatorWithKey(eval.getRawHandle(),
                                                 evalKey.getRawHandle()));
     }
 
-    void rotate(const Evaluator &eval, const Ciphertext &ctIn, uint64_t k, Ciphertext &ctOut) {
+    Evaluator shallowCopy(EvaluatorRef eval) {
+        return Evaluator(lattigo_evaluatorShallowCopy(eval.getRawHandle()));
+    }
+
+    void rotate(EvaluatorRef eval, CiphertextRef ctIn, uint64_t k, Ciphertext &ctOut) {
         lattigo_rotate(eval.getRawHandle(), ctIn.getRawHandle(), k, ctOut.getRawHandle());
     }
 
-    vector<Ciphertext> rotateHoisted(const Evaluator &eval, const Ciphertext &ctIn, vector<uint64_t> ks) {
+    vector<Ciphertext> rotateHoisted(EvaluatorRef eval, CiphertextRef ctIn, vector<uint64_t> ks) {
         vector<uint64_t> outputHandles(ks.size());
         lattigo_rotateHoisted(eval.getRawHandle(), ctIn.getRawHandle(), ks.data(), ks.size(), outputHandles.data());
         vector<Ciphertext> outputCts(ks.size());
@@ -31,67 +40,218 @@ namespace latticpp {
         return outputCts;
     }
 
-    void multByConst(const Evaluator &eval, const Ciphertext &ctIn, double constant, Ciphertext &ctOut) {
+    RotationPlan newRotationPlan(ParametersRef params, EvaluationKeyRef evalKey) {
+        return RotationPlan(lattigo_newRotationPlan(params.getRawHandle(), evalKey.getRawHandle()));
+    }
+
+    void decompose(RotationPlanRef plan, CiphertextRef ct) {
+        lattigo_rotationPlanDecompose(plan.getRawHandle(), ct.getRawHandle());
+    }
+
+    void rotateHoisted(RotationPlanRef plan, uint64_t k, Ciphertext &ctOut) {
+        uint64_t outHandle = ctOut.getRawHandle();
+        lattigo_rotationPlanRotate(plan.getRawHandle(), &k, &outHandle, 1);
+    }
+
+    void rotateHoisted(RotationPlanRef plan, const vector<uint64_t> &ks, vector<Ciphertext> &ctOut) {
+        vector<uint64_t> outHandles = rawHandles(ctOut, ks.size());
+        lattigo_rotationPlanRotate(plan.getRawHandle(), ks.data(), outHandles.data(), ks.size());
+    }
+
+    void multByConst(EvaluatorRef eval, CiphertextRef ctIn, double constant, Ciphertext &ctOut) {
         lattigo_multByConst(eval.getRawHandle(), ctIn.getRawHandle(), constant, ctOut.getRawHandle());
     }
 
-    void addConst(const Evaluator &eval, const Ciphertext &ctIn, double constant, Ciphertext &ctOut) {
+    void addConst(EvaluatorRef eval, CiphertextRef ctIn, double constant, Ciphertext &ctOut) {
         lattigo_addConst(eval.getRawHandle(), ctIn.getRawHandle(), constant, ctOut.getRawHandle());
     }
 
-    void rescale(const Evaluator &eval, const Ciphertext &ctIn, double scale, Ciphertext &ctOut) {
+    void rescale(EvaluatorRef eval, CiphertextRef ctIn, double scale, Ciphertext &ctOut) {
         lattigo_rescale(eval.getRawHandle(), ctIn.getRawHandle(), scale, ctOut.getRawHandle());
     }
 
-    Ciphertext mulRelinNew(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1) {
+    uint64_t polyDepth(uint64_t degree) {
+        uint64_t depth = 0;
+        while (degree > 0) {
+            depth++;
+            degree >>= 1;
+        }
+        return depth;
+    }
+
+    uint64_t polyDepth(uint64_t degree, PolyBasis basis, pair<double, double> interval) {
+        if (basis != PolyBasis::Chebyshev || (interval.first == -1 && interval.second == 1)) {
+            return polyDepth(degree);
+        }
+        // the map to [-1, 1] multiplies by 2 / (b - a), which Lattigo leaves unscaled, and so
+        // does not rescale, when it is an integer
+        double factor = 2 / (interval.second - interval.first);
+        return polyDepth(degree) + (trunc(factor) == factor ? 0 : 1);
+    }
+
+    Ciphertext evaluatePoly(EvaluatorRef eval, CiphertextRef ct, const vector<double> &coeffs, PolyBasis basis,
+                            double targetScale, pair<double, double> interval, uint64_t *levelsConsumed) {
+        if (coeffs.empty()) {
+            throw invalid_argument("A polynomial needs at least one coefficient");
+        }
+        uint64_t consumed;
+        Ciphertext result(lattigo_evaluatePoly(eval.getRawHandle(), ct.getRawHandle(), coeffs.data(), coeffs.size(),
+                                               basis == PolyBasis::Chebyshev, interval.first, interval.second,
+                                               targetScale, &consumed));
+        if (levelsConsumed != nullptr) {
+            *levelsConsumed = consumed;
+        }
+        return result;
+    }
+
+    Ciphertext evaluateChebyshev(EvaluatorRef eval, CiphertextRef ct, const function<double(double)> &f,
+                                 pair<double, double> interval, uint64_t degree, uint64_t *levelsConsumed) {
+        constexpr double pi = 3.14159265358979323846;
+        // interpolate f at the degree+1 Chebyshev nodes of the interval
+        uint64_t n = degree + 1;
+        double mid = (interval.first + interval.second) / 2;
+        double halfWidth = (interval.second - interval.first) / 2;
+        vector<double> samples(n);
+        for (uint64_t k = 0; k < n; k++) {
+            samples[k] = f(mid + halfWidth * cos(pi * (k + 0.5) / n));
+        }
+
+        vector<double> coeffs(n);
+        for (uint64_t j = 0; j < n; j++) {
+            double sum = 0;
+            for (uint64_t k = 0; k < n; k++) {
+                sum += samples[k] * cos(pi * j * (k + 0.5) / n);
+            }
+            coeffs[j] = 2 * sum / n;
+        }
+        coeffs[0] /= 2;
+
+        return evaluatePoly(eval, ct, coeffs, PolyBasis::Chebyshev, scale(ct), interval, levelsConsumed);
+    }
+
+    Ciphertext mulRelinNew(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1) {
         return Ciphertext(lattigo_mulRelinNew(eval.getRawHandle(), ct0.getRawHandle(), ct1.getRawHandle()));
     }
 
-    void mulRelin(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1, Ciphertext &ctOut) {
+    void mulRelin(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1, Ciphertext &ctOut) {
         lattigo_mulRelin(eval.getRawHandle(), ct0.getRawHandle(), ct1.getRawHandle(), ctOut.getRawHandle());
     }
 
-    void mul(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1, Ciphertext &ctOut) {
+    void mul(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1, Ciphertext &ctOut) {
         lattigo_mul(eval.getRawHandle(), ct0.getRawHandle(), ct1.getRawHandle(), ctOut.getRawHandle());
     }
 
-    void mulPlain(const Evaluator &eval, const Ciphertext &ctIn, const Plaintext &pt, Ciphertext &ctOut) {
+    void mulPlain(EvaluatorRef eval, CiphertextRef ctIn, PlaintextRef pt, Ciphertext &ctOut) {
         lattigo_mulPlain(eval.getRawHandle(), ctIn.getRawHandle(), pt.getRawHandle(), ctOut.getRawHandle());
     }
 
-    void add(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1, Ciphertext &ctOut) {
+    void add(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1, Ciphertext &ctOut) {
         lattigo_add(eval.getRawHandle(), ct0.getRawHandle(), ct1.getRawHandle(), ctOut.getRawHandle());
     }
 
-    void addPlain(const Evaluator &eval, const Ciphertext &ctIn, const Plaintext &pt, Ciphertext &ctOut) {
+    void addPlain(EvaluatorRef eval, CiphertextRef ctIn, PlaintextRef pt, Ciphertext &ctOut) {
         lattigo_addPlain(eval.getRawHandle(), ctIn.getRawHandle(), pt.getRawHandle(), ctOut.getRawHandle());
     }
 
-    void neg(const Evaluator &eval, const Ciphertext &ctIn, Ciphertext &ctOut) {
+    void neg(EvaluatorRef eval, CiphertextRef ctIn, Ciphertext &ctOut) {
         lattigo_neg(eval.getRawHandle(), ctIn.getRawHandle(), ctOut.getRawHandle());
     }
 
-    void sub(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1, Ciphertext &ctOut) {
+    void sub(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1, Ciphertext &ctOut) {
         lattigo_sub(eval.getRawHandle(), ct0.getRawHandle(), ct1.getRawHandle(), ctOut.getRawHandle());
     }
 
-    void subPlain(const Evaluator &eval, const Ciphertext &ctIn, const Plaintext &pt, Ciphertext &ctOut) {
+    void subPlain(EvaluatorRef eval, CiphertextRef ctIn, PlaintextRef pt, Ciphertext &ctOut) {
         lattigo_subPlain(eval.getRawHandle(), ctIn.getRawHandle(), pt.getRawHandle(), ctOut.getRawHandle());
     }
 
-    void multByGaussianIntegerAndAdd(const Evaluator &eval, const Ciphertext &ctIn, uint64_t cReal, uint64_t cImag, Ciphertext &ctOut) {
+    void multByGaussianIntegerAndAdd(EvaluatorRef eval, CiphertextRef ctIn, uint64_t cReal, uint64_t cImag, Ciphertext &ctOut) {
         lattigo_multByGaussianIntegerAndAdd(eval.getRawHandle(), ctIn.getRawHandle(), cReal, cImag, ctOut.getRawHandle());
     }
 
-    void dropLevel(const Evaluator &eval, Ciphertext &ct, uint64_t levels) {
+    void dropLevel(EvaluatorRef eval, Ciphertext &ct, uint64_t levels) {
         lattigo_dropLevel(eval.getRawHandle(), ct.getRawHandle(), levels);
     }
 
-    void relinearize(const Evaluator &eval, const Ciphertext &ctIn, Ciphertext &ctOut) {
+    void relinearize(EvaluatorRef eval, CiphertextRef ctIn, Ciphertext &ctOut) {
         lattigo_relinearize(eval.getRawHandle(), ctIn.getRawHandle(), ctOut.getRawHandle());
     }
 
-    void switchKeys(const Evaluator &eval, const Ciphertext &ctxIn, const SwitchingKey &swk, const Ciphertext &ctxOut) {
+    void addBatch(EvaluatorRef eval, const vector<Ciphertext> &ct0, const vector<Ciphertext> &ct1, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> op0Handles = rawHandles(ct0, ct0.size());
+        vector<uint64_t> op1Handles = rawHandles(ct1, ct0.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ct0.size());
+        lattigo_addBatch(eval.getRawHandle(), op0Handles.data(), op1Handles.data(), outHandles.data(), ct0.size(), numWorkers, nullptr, nullptr);
+    }
+
+    void mulRelinBatch(EvaluatorRef eval, const vector<Ciphertext> &ct0, const vector<Ciphertext> &ct1, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> op0Handles = rawHandles(ct0, ct0.size());
+        vector<uint64_t> op1Handles = rawHandles(ct1, ct0.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ct0.size());
+        lattigo_mulRelinBatch(eval.getRawHandle(), op0Handles.data(), op1Handles.data(), outHandles.data(), ct0.size(), numWorkers, nullptr, nullptr);
+    }
+
+    void multByConstBatch(EvaluatorRef eval, const vector<Ciphertext> &ctIn, double constant, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> inHandles = rawHandles(ctIn, ctIn.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ctIn.size());
+        lattigo_multByConstBatch(eval.getRawHandle(), inHandles.data(), constant, outHandles.data(), ctIn.size(), numWorkers, nullptr, nullptr);
+    }
+
+    void rotateBatch(EvaluatorRef eval, const vector<Ciphertext> &ctIn, uint64_t k, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> inHandles = rawHandles(ctIn, ctIn.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ctIn.size());
+        lattigo_rotateBatch(eval.getRawHandle(), inHandles.data(), k, outHandles.data(), ctIn.size(), numWorkers, nullptr, nullptr);
+    }
+
+    void rescaleBatch(EvaluatorRef eval, const vector<Ciphertext> &ctIn, double scale, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> inHandles = rawHandles(ctIn, ctIn.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ctIn.size());
+        lattigo_rescaleBatch(eval.getRawHandle(), inHandles.data(), scale, outHandles.data(), ctIn.size(), numWorkers, nullptr, nullptr);
+    }
+
+    future<void> addBatchAsync(EvaluatorRef eval, const vector<Ciphertext> &ct0, const vector<Ciphertext> &ct1, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> op0Handles = rawHandles(ct0, ct0.size());
+        vector<uint64_t> op1Handles = rawHandles(ct1, ct0.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ct0.size());
+        return callAsync<void>([&](completionCallback callback, void *ctx) {
+            lattigo_addBatch(eval.getRawHandle(), op0Handles.data(), op1Handles.data(), outHandles.data(), ct0.size(), numWorkers, callback, ctx);
+        });
+    }
+
+    future<void> mulRelinBatchAsync(EvaluatorRef eval, const vector<Ciphertext> &ct0, const vector<Ciphertext> &ct1, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> op0Handles = rawHandles(ct0, ct0.size());
+        vector<uint64_t> op1Handles = rawHandles(ct1, ct0.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ct0.size());
+        return callAsync<void>([&](completionCallback callback, void *ctx) {
+            lattigo_mulRelinBatch(eval.getRawHandle(), op0Handles.data(), op1Handles.data(), outHandles.data(), ct0.size(), numWorkers, callback, ctx);
+        });
+    }
+
+    future<void> multByConstBatchAsync(EvaluatorRef eval, const vector<Ciphertext> &ctIn, double constant, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> inHandles = rawHandles(ctIn, ctIn.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ctIn.size());
+        return callAsync<void>([&](completionCallback callback, void *ctx) {
+            lattigo_multByConstBatch(eval.getRawHandle(), inHandles.data(), constant, outHandles.data(), ctIn.size(), numWorkers, callback, ctx);
+        });
+    }
+
+    future<void> rotateBatchAsync(EvaluatorRef eval, const vector<Ciphertext> &ctIn, uint64_t k, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> inHandles = rawHandles(ctIn, ctIn.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ctIn.size());
+        return callAsync<void>([&](completionCallback callback, void *ctx) {
+            lattigo_rotateBatch(eval.getRawHandle(), inHandles.data(), k, outHandles.data(), ctIn.size(), numWorkers, callback, ctx);
+        });
+    }
+
+    future<void> rescaleBatchAsync(EvaluatorRef eval, const vector<Ciphertext> &ctIn, double scale, vector<Ciphertext> &ctOut, uint64_t numWorkers) {
+        vector<uint64_t> inHandles = rawHandles(ctIn, ctIn.size());
+        vector<uint64_t> outHandles = rawHandles(ctOut, ctIn.size());
+        return callAsync<void>([&](completionCallback callback, void *ctx) {
+            lattigo_rescaleBatch(eval.getRawHandle(), inHandles.data(), scale, outHandles.data(), ctIn.size(), numWorkers, callback, ctx);
+        });
+    }
+
+    void switchKeys(EvaluatorRef eval, CiphertextRef ctxIn, SwitchingKeyRef swk, CiphertextRef ctxOut) {
         lattigo_switchKeys(eval.getRawHandle(), ctxIn.getRawHandle(), swk.getRawHandle(), ctxOut.getRawHandle());
     }
 } // namespace latticpp
\ No newline at end of file
@@ -5,47 +5,128 @@
 
 #include "latticpp/marshal/gohandle.h"
 #include "cgo/evaluator.h"
+#include <functional>
+#include <future>
+#include <utility>
 #include <vector>
 
 namespace latticpp {
 
-    Evaluator newEvaluator(const Parameters &params, const EvaluationKey &evalKey);
+    Evaluator newEvaluator(ParametersRef params, EvaluationKeyRef evalKey);
 
-    Evaluator evaluatorWithKey(const Evaluator &eval, const EvaluationKey &evalKey);
+    Evaluator evaluatorWithKey(EvaluatorRef eval, EvaluationKeyRef evalKey);
 
-    void rotate(const Evaluator &eval, const Ciphertext &ctIn, uint64_t k, Ciphertext &ctOut);
+    // Create an evaluator which shares the parameters and keys of `eval` but has its own
+    // scratch space, so that the two can be used concurrently. See also EvaluatorPool.
+    Evaluator shallowCopy(EvaluatorRef eval);
 
-    std::vector<Ciphertext> rotateHoisted(const Evaluator &eval, const Ciphertext &ctIn, std::vector<uint64_t> ks);
+    void rotate(EvaluatorRef eval, CiphertextRef ctIn, uint64_t k, Ciphertext &ctOut);
 
-    void multByConst(const Evaluator &eval, const Ciphertext &ctIn, double constant, Ciphertext &ctOut);
+    std::vector<Ciphertext> rotateHoisted(EvaluatorRef eval, CiphertextRef ctIn, std::vector<uint64_t> ks);
 
-    void addConst(const Evaluator &eval, const Ciphertext &ctIn, double constant, Ciphertext &ctOut);
+    // A RotationPlan computes many rotations of one ciphertext while paying for the
+    // key-switching decomposition only once. Call decompose() with the input ciphertext,
+    // then rotateHoisted() as many times as needed; outputs are written into existing
+    // ciphertexts, so no new handles are created. The evaluation key must contain a
+    // rotation key for every rotation used. A plan must not be used by several threads
+    // at once.
+    RotationPlan newRotationPlan(ParametersRef params, EvaluationKeyRef evalKey);
 
-    void rescale(const Evaluator &eval, const Ciphertext &ctIn, double scale, Ciphertext &ctOut);
+    // `ct` must not be modified while the plan is in use
+    void decompose(RotationPlanRef plan, CiphertextRef ct);
 
-    Ciphertext mulRelinNew(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1);
+    void rotateHoisted(RotationPlanRef plan, uint64_t k, Ciphertext &ctOut);
 
-    void mulRelin(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1, Ciphertext &ctOut);
+    // Rotate by ks[i] into ctOut[i] for every i, in a single call
+    void rotateHoisted(RotationPlanRef plan, const std::vector<uint64_t> &ks, std::vector<Ciphertext> &ctOut);
 
-    void mul(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1, Ciphertext &ctOut);
+    void multByConst(EvaluatorRef eval, CiphertextRef ctIn, double constant, Ciphertext &ctOut);
 
-    void mulPlain(const Evaluator &eval, const Ciphertext &ctIn, const Plaintext &pt, Ciphertext &ctOut);
+    void addConst(EvaluatorRef eval, CiphertextRef ctIn, double constant, Ciphertext &ctOut);
 
-    void add(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1, Ciphertext &ctOut);
+    void rescale(EvaluatorRef eval, CiphertextRef ctIn, double scale, Ciphertext &ctOut);
 
-    void addPlain(const Evaluator &eval, const Ciphertext &ctIn, const Plaintext &pt, Ciphertext &ctOut);
+    enum class PolyBasis { Monomial, Chebyshev };
 
-    void neg(const Evaluator &eval, const Ciphertext &ctIn, Ciphertext &ctOut);
+    // Number of levels consumed by evaluatePoly for a monomial-basis polynomial of the given
+    // degree, or a Chebyshev-basis one on [-1, 1]
+    uint64_t polyDepth(uint64_t degree);
 
-    void sub(const Evaluator &eval, const Ciphertext &ct0, const Ciphertext &ct1, Ciphertext &ctOut);
+    // Number of levels consumed by evaluatePoly for a polynomial of the given degree, basis
+    // and interval: a Chebyshev polynomial on an interval [a, b] other than [-1, 1] needs one
+    // more level to map its inputs to [-1, 1], unless 2 / (b - a) is an integer.
+    uint64_t polyDepth(uint64_t degree, PolyBasis basis, std::pair<double, double> interval);
 
-    void subPlain(const Evaluator &eval, const Ciphertext &ctIn, const Plaintext &pt, Ciphertext &ctOut);
+    // Evaluate a polynomial on `ct` in a single call, with depth-optimal scheduling. For the
+    // Chebyshev basis, `interval` is the interval the polynomial is defined on, and inputs are
+    // mapped from it to [-1, 1] homomorphically; it is ignored for the monomial basis. The
+    // result has scale `targetScale`. If `levelsConsumed` is not null, it is set to the number
+    // of levels used, which is polyDepth(coeffs.size() - 1, basis, interval).
+    Ciphertext evaluatePoly(EvaluatorRef eval, CiphertextRef ct, const std::vector<double> &coeffs, PolyBasis basis,
+                            double targetScale, std::pair<double, double> interval = {-1, 1},
+                            uint64_t *levelsConsumed = nullptr);
 
-    void multByGaussianIntegerAndAdd(const Evaluator &eval, const Ciphertext &ctIn, uint64_t cReal, uint64_t cImag, Ciphertext &ctOut);
+    // Evaluate the Chebyshev interpolant of `f` of the given degree over `interval`. The
+    // coefficients are computed in C++ and the polynomial is evaluated with evaluatePoly,
+    // keeping the scale of `ct`.
+    Ciphertext evaluateChebyshev(EvaluatorRef eval, CiphertextRef ct, const std::function<double(double)> &f,
+                                 std::pair<double, double> interval, uint64_t degree,
+                                 uint64_t *levelsConsumed = nullptr);
 
-    void dropLevel(const Evaluator &eval, Ciphertext &ct, uint64_t levels);
+    Ciphertext mulRelinNew(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1);
 
-    void relinearize(const Evaluator &eval, const Ciphertext &ctIn, Ciphertext &ctOut);
+    void mulRelin(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1, Ciphertext &ctOut);
 
-    void switchKeys(const Evaluator &eval, const Ciphertext &ctxIn, const SwitchingKey &swk, const Ciphertext &ctxOut);
+    void mul(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1, Ciphertext &ctOut);
+
+    void mulPlain(EvaluatorRef eval, CiphertextRef ctIn, PlaintextRef pt, Ciphertext &ctOut);
+
+    void add(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1, Ciphertext &ctOut);
+
+    void addPlain(EvaluatorRef eval, CiphertextRef ctIn, PlaintextRef pt, Ciphertext &ctOut);
+
+    void neg(EvaluatorRef eval, CiphertextRef ctIn, Ciphertext &ctOut);
+
+    void sub(EvaluatorRef eval, CiphertextRef ct0, CiphertextRef ct1, Ciphertext &ctOut);
+
+    void subPlain(EvaluatorRef eval, CiphertextRef ctIn, PlaintextRef pt, Ciphertext &ctOut);
+
+    void multByGaussianIntegerAndAdd(EvaluatorRef eval, CiphertextRef ctIn, uint64_t cReal, uint64_t cImag, Ciphertext &ctOut);
+
+    void dropLevel(EvaluatorRef eval, Ciphertext &ct, uint64_t levels);
+
+    void relinearize(EvaluatorRef eval, CiphertextRef ctIn, Ciphertext &ctOut);
+
+    // Batch variants of the operations above. Each applies the operation to every element of
+    // the input vectors with a single call into Go, which spreads the work across `numWorkers`
+    // goroutines (one per CPU if numWorkers is 0). The shallow copies of `eval` used by the
+    // workers are kept with `eval` and reused by later batches. Output ciphertexts must be
+    // allocated in advance. Each element is processed on its own, so ctOut[i] may be the
+    // input at index i (in-place use), but since the elements are processed concurrently,
+    // ctOut must not contain the same ciphertext twice and no output may be an input at a
+    // different index.
+    void addBatch(EvaluatorRef eval, const std::vector<Ciphertext> &ct0, const std::vector<Ciphertext> &ct1, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    void mulRelinBatch(EvaluatorRef eval, const std::vector<Ciphertext> &ct0, const std::vector<Ciphertext> &ct1, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    void multByConstBatch(EvaluatorRef eval, const std::vector<Ciphertext> &ctIn, double constant, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    void rotateBatch(EvaluatorRef eval, const std::vector<Ciphertext> &ctIn, uint64_t k, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    void rescaleBatch(EvaluatorRef eval, const std::vector<Ciphertext> &ctIn, double scale, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    // Asynchronous versions of the batch operations. These return immediately; the returned
+    // future becomes ready once every output has been written, or throws std::runtime_error
+    // if the operation failed. `eval` must not be used by any other call until then.
+    std::future<void> addBatchAsync(EvaluatorRef eval, const std::vector<Ciphertext> &ct0, const std::vector<Ciphertext> &ct1, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    std::future<void> mulRelinBatchAsync(EvaluatorRef eval, const std::vector<Ciphertext> &ct0, const std::vector<Ciphertext> &ct1, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    std::future<void> multByConstBatchAsync(EvaluatorRef eval, const std::vector<Ciphertext> &ctIn, double constant, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    std::future<void> rotateBatchAsync(EvaluatorRef eval, const std::vector<Ciphertext> &ctIn, uint64_t k, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    std::future<void> rescaleBatchAsync(EvaluatorRef eval, const std::vector<Ciphertext> &ctIn, double scale, std::vector<Ciphertext> &ctOut, uint64_t numWorkers = 0);
+
+    void switchKeys(EvaluatorRef eval, CiphertextRef ctxIn, SwitchingKeyRef swk, CiphertextRef ctxOut);
 }  // namespace latticpp
\ No newline at end of file
@@ -0,0 +1,52 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "evaluatorpool.h"
+#include "evaluator.h"
+
+using namespace std;
+
+namespace latticpp {
+
+    EvaluatorPool::Lease::Lease(EvaluatorPool *pool, Evaluator &&eval) : pool(pool), eval(move(eval)) { }
+
+    EvaluatorPool::Lease::Lease(Lease &&other) noexcept : pool(other.pool), eval(move(other.eval)) {
+        other.pool = nullptr;
+    }
+
+    EvaluatorPool::Lease::~Lease() {
+        if (pool != nullptr) {
+            pool->checkin(move(eval));
+        }
+    }
+
+    EvaluatorPool::EvaluatorPool(const Evaluator &prototype) : prototype(prototype) { }
+
+    EvaluatorPool::EvaluatorPool(ParametersRef params, EvaluationKeyRef evalKey)
+        : prototype(newEvaluator(params, evalKey)) { }
+
+    EvaluatorPool::Lease EvaluatorPool::checkout() {
+        {
+            lock_guard<mutex> guard(lock);
+            if (!idle.empty()) {
+                Evaluator eval = move(idle.back());
+                idle.pop_back();
+                return Lease(this, move(eval));
+            }
+            created++;
+        }
+        // Creating a shallow copy allocates fresh scratch buffers, so do it outside the lock.
+        // ShallowCopy only reads the prototype, so it is safe to call concurrently.
+        return Lease(this, shallowCopy(prototype));
+    }
+
+    void EvaluatorPool::checkin(Evaluator &&eval) {
+        lock_guard<mutex> guard(lock);
+        idle.push_back(move(eval));
+    }
+
+    size_t EvaluatorPool::size() const {
+        lock_guard<mutex> guard(lock);
+        return created;
+    }
+}  // namespace latticpp
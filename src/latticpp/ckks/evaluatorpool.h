@@ -0,0 +1,71 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+#include <mutex>
+#include <vector>
+
+namespace latticpp {
+
+    // A Lattigo evaluator has internal scratch buffers, so a single Evaluator must not be
+    // used by several threads at once. An EvaluatorPool hands out evaluators for exclusive
+    // use by one thread at a time. All evaluators in the pool are shallow copies of a single
+    // prototype, so they share the (potentially very large) evaluation keys.
+    //
+    // Evaluators are created on demand and are reused once they are returned, so a pool
+    // used by N threads holds at most N evaluators. The pool must outlive all of its leases.
+    class EvaluatorPool {
+    public:
+        // Exclusive use of one evaluator from the pool. The evaluator is returned to the
+        // pool when the lease is destroyed.
+        class Lease {
+        public:
+            Lease(Lease &&other) noexcept;
+
+            Lease(const Lease&) = delete;
+            Lease& operator= (const Lease&) = delete;
+            Lease& operator= (Lease&&) = delete;
+
+            ~Lease();
+
+            const Evaluator& get() const {
+                return eval;
+            }
+
+            operator EvaluatorRef() const {
+                return eval;
+            }
+
+        private:
+            friend class EvaluatorPool;
+
+            Lease(EvaluatorPool *pool, Evaluator &&eval);
+
+            EvaluatorPool *pool;
+            Evaluator eval;
+        };
+
+        explicit EvaluatorPool(const Evaluator &prototype);
+
+        EvaluatorPool(ParametersRef params, EvaluationKeyRef evalKey);
+
+        EvaluatorPool(const EvaluatorPool&) = delete;
+        EvaluatorPool& operator= (const EvaluatorPool&) = delete;
+
+        // Borrow an evaluator, creating a new shallow copy of the prototype if none are idle
+        Lease checkout();
+
+        // Number of evaluators created by this pool so far
+        size_t size() const;
+
+    private:
+        void checkin(Evaluator &&eval);
+
+        Evaluator prototype;
+        mutable std::mutex lock;
+        std::vector<Evaluator> idle;
+        size_t created = 0;
+    };
+}  // namespace latticpp
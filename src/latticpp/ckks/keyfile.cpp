@@ -0,0 +1,45 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "keyfile.h"
+#include <stdexcept>
+
+using namespace std;
+
+namespace latticpp {
+
+    RotationKeyFile openRotationKeyFile(const string &path) {
+        return RotationKeyFile(lattigo_openRotationKeyFile(const_cast<char*>(path.c_str())));
+    }
+
+    vector<uint64_t> galoisElements(RotationKeyFileRef file) {
+        vector<uint64_t> res(lattigo_keyFileNumKeys(file.getRawHandle()));
+        lattigo_keyFileGaloisElements(file.getRawHandle(), res.data());
+        return res;
+    }
+
+    uint64_t switchingKeyExist(RotationKeyFileRef file, uint64_t galEl) {
+        return lattigo_keyFileSwitchingKeyExist(file.getRawHandle(), galEl);
+    }
+
+    SwitchingKey getSwitchingKey(RotationKeyFileRef file, uint64_t galEl) {
+        if (!switchingKeyExist(file, galEl)) {
+            throw invalid_argument("Rotation key file has no key for Galois element " + to_string(galEl));
+        }
+        return SwitchingKey(lattigo_keyFileGetSwitchingKey(file.getRawHandle(), galEl));
+    }
+
+    RotationKeys loadRotationKeys(RotationKeyFileRef file, const vector<uint64_t> &galEls) {
+        for (uint64_t galEl : galEls) {
+            if (!switchingKeyExist(file, galEl)) {
+                throw invalid_argument("Rotation key file has no key for Galois element " + to_string(galEl));
+            }
+        }
+        return RotationKeys(lattigo_keyFileRotationKeys(file.getRawHandle(), galEls.data(), galEls.size()));
+    }
+
+    uint64_t numLoadedKeys(RotationKeyFileRef file) {
+        return lattigo_keyFileNumLoaded(file.getRawHandle());
+    }
+
+}  // namespace latticpp
@@ -0,0 +1,33 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+#include "cgo/keyfile.h"
+#include <string>
+#include <vector>
+
+namespace latticpp {
+
+    // A rotation key file (written by writeRotationKeyFile) is memory-mapped when it is opened,
+    // and only its index is read. Switching keys are deserialized the first time they are
+    // requested and are then shared by every caller, so memory use grows with the rotations
+    // a program actually uses rather than with the size of the file.
+    RotationKeyFile openRotationKeyFile(const std::string &path);
+
+    std::vector<uint64_t> galoisElements(RotationKeyFileRef file);
+
+    uint64_t switchingKeyExist(RotationKeyFileRef file, uint64_t galEl);
+
+    SwitchingKey getSwitchingKey(RotationKeyFileRef file, uint64_t galEl);
+
+    // Create a rotation key set holding only the keys for the given Galois elements, e.g., to
+    // pass to makeEvaluationKey. Throws std::invalid_argument if the file has no key for one
+    // of them.
+    RotationKeys loadRotationKeys(RotationKeyFileRef file, const std::vector<uint64_t> &galEls);
+
+    // The number of keys which have been deserialized so far
+    uint64_t numLoadedKeys(RotationKeyFileRef file);
+
+}  // namespace latticpp
@@ -2,103 +2,104 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "keygen.h"
+#include "latticpp/marshal/completion.h"
 
 using namespace std;
 
 namespace latticpp {
 
-    KeyGenerator newKeyGenerator(const Parameters &params) {
+    KeyGenerator newKeyGenerator(ParametersRef params) {
         return KeyGenerator(lattigo_newKeyGenerator(params.getRawHandle()));
     }
 
-    SwitchingKey getSwitchingKey(const RotationKeys &rotationKeys, uint64_t galEl) {
+    SwitchingKey getSwitchingKey(RotationKeysRef rotationKeys, uint64_t galEl) {
       return SwitchingKey(lattigo_getSwitchingKey(rotationKeys.getRawHandle(), galEl));
     }
 
-    void setSwitchingKey(const RotationKeys &rotKeys, const SwitchingKey &swk, uint64_t galEl) {
+    void setSwitchingKey(RotationKeysRef rotKeys, SwitchingKeyRef swk, uint64_t galEl) {
       lattigo_setSwitchingKey(rotKeys.getRawHandle(), swk.getRawHandle(), galEl);
     }
 
-    uint64_t switchingKeyExist(const RotationKeys &rotationKeys, uint64_t galEl) {
+    uint64_t switchingKeyExist(RotationKeysRef rotationKeys, uint64_t galEl) {
       return lattigo_switchingKeyExist(rotationKeys.getRawHandle(), galEl);
     }
 
-    vector<uint64_t> getGaloisElementsOfRotationKeys(const RotationKeys &rotationKeys) {
+    vector<uint64_t> getGaloisElementsOfRotationKeys(RotationKeysRef rotationKeys) {
       vector<uint64_t> res(lattigo_getNumSwitchingKeys(rotationKeys.getRawHandle()));
       lattigo_getGaloisElementsOfRotationKeys(rotationKeys.getRawHandle(), res.data());
       return res;
     }
 
-    SwitchingKey copyNew(const SwitchingKey &swk) {
+    SwitchingKey copyNew(SwitchingKeyRef swk) {
       return SwitchingKey(lattigo_copyNewSwitchingKey(swk.getRawHandle()));
     }
 
-    uint64_t numOfDecomp(const SwitchingKey &swk) {
+    uint64_t numOfDecomp(SwitchingKeyRef swk) {
       return lattigo_numOfDecomp(swk.getRawHandle());
     }
 
-    uint64_t galoisElementForColumnRotationBy(const Parameters &params, uint64_t rotationStep) {
+    uint64_t galoisElementForColumnRotationBy(ParametersRef params, uint64_t rotationStep) {
       return lattigo_galoisElementForColumnRotationBy(params.getRawHandle(),
                                                       rotationStep);
     }
 
-    uint64_t switchingKeyIsCorrect(const SwitchingKey &swk, uint64_t galEl, const SecretKey &sk, const Parameters &params, uint64_t log2Bound) {
+    uint64_t switchingKeyIsCorrect(SwitchingKeyRef swk, uint64_t galEl, SecretKeyRef sk, ParametersRef params, uint64_t log2Bound) {
       return lattigo_switchingKeyIsCorrect(swk.getRawHandle(), galEl,
                                           sk.getRawHandle(), params.getRawHandle(),
                                           log2Bound);
     }
 
-    SecretKey newSecretKey(const Parameters &params) {
+    SecretKey newSecretKey(ParametersRef params) {
       return SecretKey(lattigo_newSecretKey(params.getRawHandle()));
     }
 
-    SecretKey copyNewSecretKey(const SecretKey &sk) {
+    SecretKey copyNewSecretKey(SecretKeyRef sk) {
       return SecretKey(lattigo_copyNewSecretKey(sk.getRawHandle()));
     }
 
-    PolyQP polyQP(const SecretKey &sk) {
+    PolyQP polyQP(SecretKeyRef sk) {
       return PolyQP(lattigo_polyQPSecretKey(sk.getRawHandle()));
     }
 
-    PublicKey newPublicKey(const Parameters &params) {
+    PublicKey newPublicKey(ParametersRef params) {
       return PublicKey(lattigo_newPublicKey(params.getRawHandle()));
     }
 
-    RelinearizationKey newRelinearizationKey(const Parameters &params) {
+    RelinearizationKey newRelinearizationKey(ParametersRef params) {
       return RelinearizationKey(
           lattigo_newRelinearizationKey(params.getRawHandle()));
     }
 
-    RotationKeys newRotationKeys(const Parameters &params,
+    RotationKeys newRotationKeys(ParametersRef params,
                                  vector<uint64_t> galoisElements) {
       return RotationKeys(lattigo_newRotationKeys(
           params.getRawHandle(), galoisElements.data(), galoisElements.size()));
     }
 
-    SecretKey genSecretKey(const KeyGenerator &keygen) {
+    SecretKey genSecretKey(KeyGeneratorRef keygen) {
       return SecretKey(lattigo_genSecretKey(keygen.getRawHandle()));
     }
 
-    PublicKey genPublicKey(const KeyGenerator &keygen, const SecretKey &sk) {
+    PublicKey genPublicKey(KeyGeneratorRef keygen, SecretKeyRef sk) {
       return PublicKey(
           lattigo_genPublicKey(keygen.getRawHandle(), sk.getRawHandle()));
     }
 
-    KeyPairHandle genKeyPair(const KeyGenerator &keygen) {
+    KeyPairHandle genKeyPair(KeyGeneratorRef keygen) {
         Lattigo_KeyPairHandle kp = lattigo_genKeyPair(keygen.getRawHandle());
         return KeyPairHandle { SecretKey(kp.sk), PublicKey(kp.pk) };
     }
 
-    KeyPairHandle genKeyPairSparse(const KeyGenerator &keygen, uint64_t hw) {
+    KeyPairHandle genKeyPairSparse(KeyGeneratorRef keygen, uint64_t hw) {
         Lattigo_KeyPairHandle kp = lattigo_genKeyPairSparse(keygen.getRawHandle(), hw);
         return KeyPairHandle { SecretKey(kp.sk), PublicKey(kp.pk) };
     }
 
-    RelinearizationKey genRelinKey(const KeyGenerator &keygen, const SecretKey &sk) {
+    RelinearizationKey genRelinKey(KeyGeneratorRef keygen, SecretKeyRef sk) {
         return RelinearizationKey(lattigo_genRelinearizationKey(keygen.getRawHandle(), sk.getRawHandle()));
     }
 
-    RotationKeys genRotationKeysForRotations(const KeyGenerator &keygen, const SecretKey &sk, vector<int> shifts) {
+    RotationKeys genRotationKeysForRotations(KeyGeneratorRef keygen, SecretKeyRef sk, vector<int> shifts) {
         // convert from variable-sized int to fixed-size SIGNED int64_t
         vector<int64_t> fixed_width_shifts(shifts.size());
         for (int i = 0; i < shifts.size(); i++) {
@@ -107,19 +108,26 @@ namespace latticpp {
         return RotationKeys(lattigo_genRotationKeysForRotations(keygen.getRawHandle(), sk.getRawHandle(), fixed_width_shifts.data(), shifts.size()));
     }
 
-    CiphertextQP getCiphertextQP(const SwitchingKey &swk, uint64_t i, uint64_t j) {
+    future<RotationKeys> genRotationKeysForRotationsAsync(KeyGeneratorRef keygen, SecretKeyRef sk, vector<int> shifts) {
+        vector<int64_t> fixed_width_shifts(shifts.begin(), shifts.end());
+        return callAsync<RotationKeys>([&](completionCallback callback, void *ctx) {
+            lattigo_genRotationKeysForRotationsAsync(keygen.getRawHandle(), sk.getRawHandle(), fixed_width_shifts.data(), shifts.size(), callback, ctx);
+        });
+    }
+
+    CiphertextQP getCiphertextQP(SwitchingKeyRef swk, uint64_t i, uint64_t j) {
       return CiphertextQP(lattigo_getCiphertextQP(swk.getRawHandle(), i, j));
     }
 
-    void setCiphertextQP(SwitchingKey &swk, const CiphertextQP &ctQP, uint64_t i, uint64_t j) {
+    void setCiphertextQP(SwitchingKey &swk, CiphertextQPRef ctQP, uint64_t i, uint64_t j) {
       lattigo_setCiphertextQP(swk.getRawHandle(), ctQP.getRawHandle(), i, j);
     }
 
-    EvaluationKey makeEvaluationKey(const RelinearizationKey &relinKey) {
+    EvaluationKey makeEvaluationKey(RelinearizationKeyRef relinKey) {
         return EvaluationKey(lattigo_makeEvaluationKeyOnlyRelin(relinKey.getRawHandle()));
     }    
 
-    EvaluationKey makeEvaluationKey(const RelinearizationKey &relinKey, const RotationKeys &rotKeys) {
+    EvaluationKey makeEvaluationKey(RelinearizationKeyRef relinKey, RotationKeysRef rotKeys) {
         return EvaluationKey(lattigo_makeEvaluationKey(relinKey.getRawHandle(), rotKeys.getRawHandle()));
     }
 
@@ -127,23 +135,29 @@ namespace latticpp {
       return EvaluationKey(lattigo_makeEmptyEvaluationKey());
     }
 
-    void setRelinKeyForEvaluationKey(const EvaluationKey &evalKey,
-                                     const RelinearizationKey &relinKey) {
+    void setRelinKeyForEvaluationKey(EvaluationKeyRef evalKey,
+                                     RelinearizationKeyRef relinKey) {
       lattigo_setRelinKeyForEvaluationKey(evalKey.getRawHandle(),
                                           relinKey.getRawHandle());
     }
 
-    void setRotKeysForEvaluationKey(const EvaluationKey &evalKey,
-                                    const RotationKeys &rotKeys) {
+    void setRotKeysForEvaluationKey(EvaluationKeyRef evalKey,
+                                    RotationKeysRef rotKeys) {
       lattigo_setRotKeysForEvaluationKey(evalKey.getRawHandle(),
                                          rotKeys.getRawHandle());
     }
 
-    BootstrappingKey genBootstrappingKey(const KeyGenerator &keygen, const Parameters &params, const BootstrappingParameters &bootParams, const SecretKey &sk, const RelinearizationKey &relinKey, const RotationKeys &rotKeys) {
+    BootstrappingKey genBootstrappingKey(KeyGeneratorRef keygen, ParametersRef params, BootstrappingParametersRef bootParams, SecretKeyRef sk, RelinearizationKeyRef relinKey, RotationKeysRef rotKeys) {
         return BootstrappingKey(lattigo_genBootstrappingKey(keygen.getRawHandle(), params.getRawHandle(), bootParams.getRawHandle(), sk.getRawHandle(), relinKey.getRawHandle(), rotKeys.getRawHandle()));
     }
 
-    SwitchingKey newSwitchingKey(const Parameters &params, uint64_t levelQ, uint64_t levelP) {
+    future<BootstrappingKey> genBootstrappingKeyAsync(ParametersRef params, BootstrappingParametersRef bootParams, SecretKeyRef sk) {
+        return callAsync<BootstrappingKey>([&](completionCallback callback, void *ctx) {
+            lattigo_genBootstrappingKeyAsync(params.getRawHandle(), bootParams.getRawHandle(), sk.getRawHandle(), callback, ctx);
+        });
+    }
+
+    SwitchingKey newSwitchingKey(ParametersRef params, uint64_t levelQ, uint64_t levelP) {
       return SwitchingKey(lattigo_newSwitchingKey(params.getRawHandle(), levelQ, levelP));
     }
 }  // namespace latticpp
\ No newline at end of file
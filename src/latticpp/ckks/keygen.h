@@ -5,6 +5,7 @@
 
 #include "latticpp/marshal/gohandle.h"
 #include "cgo/keygen.h"
+#include <future>
 #include <vector>
 
 namespace latticpp {
@@ -14,72 +15,79 @@ namespace latticpp {
         PublicKey pk;
     };
 
-    KeyGenerator newKeyGenerator(const Parameters &params);
+    KeyGenerator newKeyGenerator(ParametersRef params);
 
-    SwitchingKey getSwitchingKey(const RotationKeys &rtks, uint64_t galEl);
+    SwitchingKey getSwitchingKey(RotationKeysRef rtks, uint64_t galEl);
 
-    void setSwitchingKey(const RotationKeys &rotKeys, const SwitchingKey &swk, uint64_t galEl);
+    void setSwitchingKey(RotationKeysRef rotKeys, SwitchingKeyRef swk, uint64_t galEl);
 
-    uint64_t switchingKeyExist(const RotationKeys &rotationKeys, uint64_t galEl);
+    uint64_t switchingKeyExist(RotationKeysRef rotationKeys, uint64_t galEl);
 
-    std::vector<uint64_t> getGaloisElementsOfRotationKeys(const RotationKeys &rotationKeys);
+    std::vector<uint64_t> getGaloisElementsOfRotationKeys(RotationKeysRef rotationKeys);
 
-    SwitchingKey copyNew(const SwitchingKey &rotKey);
+    SwitchingKey copyNew(SwitchingKeyRef rotKey);
 
-    uint64_t numOfDecomp(const SwitchingKey &swk);
+    uint64_t numOfDecomp(SwitchingKeyRef swk);
 
-    uint64_t galoisElementForColumnRotationBy(const Parameters &params,
+    uint64_t galoisElementForColumnRotationBy(ParametersRef params,
                                               uint64_t rotationStep);
 
-    uint64_t switchingKeyIsCorrect(const SwitchingKey &swk, uint64_t galEl,
-                                  const SecretKey &sk, const Parameters &params,
+    uint64_t switchingKeyIsCorrect(SwitchingKeyRef swk, uint64_t galEl,
+                                  SecretKeyRef sk, ParametersRef params,
                                   uint64_t log2Bound);
 
-    CiphertextQP getCiphertextQP(const SwitchingKey& swk, uint64_t i, uint64_t j);
+    CiphertextQP getCiphertextQP(SwitchingKeyRef swk, uint64_t i, uint64_t j);
 
-    void setCiphertextQP(const SwitchingKey& swk, const CiphertextQP& ctQP, uint64_t i, uint64_t j);
+    void setCiphertextQP(SwitchingKeyRef swk, CiphertextQPRef ctQP, uint64_t i, uint64_t j);
 
-    SecretKey newSecretKey(const Parameters &params);
+    SecretKey newSecretKey(ParametersRef params);
 
-    SecretKey copyNewSecretKey(const SecretKey &sk);
+    SecretKey copyNewSecretKey(SecretKeyRef sk);
 
-    PolyQP polyQP(const SecretKey &sk);
+    PolyQP polyQP(SecretKeyRef sk);
 
-    PublicKey newPublicKey(const Parameters &params);
+    PublicKey newPublicKey(ParametersRef params);
 
-    RelinearizationKey newRelinearizationKey(const Parameters &params);
+    RelinearizationKey newRelinearizationKey(ParametersRef params);
 
-    RotationKeys newRotationKeys(const Parameters &params, std::vector<uint64_t> galoisElements);
+    RotationKeys newRotationKeys(ParametersRef params, std::vector<uint64_t> galoisElements);
 
-    SecretKey genSecretKey(const KeyGenerator &keygen);
+    SecretKey genSecretKey(KeyGeneratorRef keygen);
 
-    PublicKey genPublicKey(const KeyGenerator &keygen, const SecretKey &sk);
+    PublicKey genPublicKey(KeyGeneratorRef keygen, SecretKeyRef sk);
 
-    KeyPairHandle genKeyPair(const KeyGenerator &keygen);
+    KeyPairHandle genKeyPair(KeyGeneratorRef keygen);
 
-    KeyPairHandle genKeyPairSparse(const KeyGenerator &keygen, uint64_t hw);
+    KeyPairHandle genKeyPairSparse(KeyGeneratorRef keygen, uint64_t hw);
 
-    RelinearizationKey genRelinKey(const KeyGenerator &keygen, const SecretKey &sk);
+    RelinearizationKey genRelinKey(KeyGeneratorRef keygen, SecretKeyRef sk);
 
-    RotationKeys genRotationKeysForRotations(const KeyGenerator &keygen, const SecretKey &sk, std::vector<int> shifts);
+    RotationKeys genRotationKeysForRotations(KeyGeneratorRef keygen, SecretKeyRef sk, std::vector<int> shifts);
 
-    EvaluationKey makeEvaluationKey(const RelinearizationKey &relinKey);
+    // Generate the keys on a Go-managed thread and return immediately. `keygen` must not be
+    // used by any other call until the returned future is ready.
+    std::future<RotationKeys> genRotationKeysForRotationsAsync(KeyGeneratorRef keygen, SecretKeyRef sk, std::vector<int> shifts);
 
-    EvaluationKey makeEvaluationKey(const RelinearizationKey &relinKey, const RotationKeys &rotKeys);
+    EvaluationKey makeEvaluationKey(RelinearizationKeyRef relinKey);
+
+    EvaluationKey makeEvaluationKey(RelinearizationKeyRef relinKey, RotationKeysRef rotKeys);
 
     EvaluationKey makeEmptyEvaluationKey();
 
-    void setRelinKeyForEvaluationKey(const EvaluationKey &evalKey,
-                                     const RelinearizationKey &relinKey);
+    void setRelinKeyForEvaluationKey(EvaluationKeyRef evalKey,
+                                     RelinearizationKeyRef relinKey);
+
+    void setRotKeysForEvaluationKey(EvaluationKeyRef evalKey,
+                                    RotationKeysRef rotKeys);
 
-    void setRotKeysForEvaluationKey(const EvaluationKey &evalKey,
-                                    const RotationKeys &rotKeys);
+    BootstrappingKey genBootstrappingKey(KeyGeneratorRef keygen, ParametersRef params, BootstrappingParametersRef bootParams, SecretKeyRef sk, RelinearizationKeyRef relinKey, RotationKeysRef rotKeys);
 
-    BootstrappingKey genBootstrappingKey(const KeyGenerator &keygen, const Parameters &params, const BootstrappingParameters &bootParams, const SecretKey &sk, const RelinearizationKey &relinKey, const RotationKeys &rotKeys);
+    // Generate the bootstrapping key on a Go-managed thread and return immediately.
+    std::future<BootstrappingKey> genBootstrappingKeyAsync(ParametersRef params, BootstrappingParametersRef bootParams, SecretKeyRef sk);
 
-    PolyQP polyQP(const SecretKey &sk);
+    PolyQP polyQP(SecretKeyRef sk);
 
-    SwitchingKey newSwitchingKey(const Parameters &params, uint64_t levelQ, uint64_t levelP);
+    SwitchingKey newSwitchingKey(ParametersRef params, uint64_t levelQ, uint64_t levelP);
 
-    void switchKeys(const Evaluator &eval, const Ciphertext &ctxIn, const SwitchingKey &swk, const Ciphertext &ctxOut);
+    void switchKeys(EvaluatorRef eval, CiphertextRef ctxIn, SwitchingKeyRef swk, CiphertextRef ctxOut);
 }  // namespace latticpp
\ No newline at end of file
@@ -0,0 +1,162 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "lazyciphertext.h"
+#include "ciphertext.h"
+#include "evaluator.h"
+#include "params.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace latticpp {
+
+    LazyCiphertext::LazyCiphertext(ParametersRef params, EvaluatorRef eval, CiphertextRef ct, double targetScale)
+        : params(params), eval(eval), targetScale(targetScale), ct(ct),
+          ctDegree(latticpp::degree(ct)), ctLevel(latticpp::level(ct)), ctScale(latticpp::scale(ct)),
+          pendingRescale(false) { }
+
+    LazyCiphertext::LazyCiphertext(ParametersRef params, EvaluatorRef eval, CiphertextRef ct)
+        : LazyCiphertext(params, eval, ct, latticpp::scale(params)) { }
+
+    LazyCiphertext::LazyCiphertext(const LazyCiphertext &like, Ciphertext &&ct, bool pendingRescale)
+        : params(like.params), eval(like.eval), targetScale(like.targetScale), ct(move(ct)),
+          ctDegree(latticpp::degree(this->ct)), ctLevel(latticpp::level(this->ct)), ctScale(latticpp::scale(this->ct)),
+          pendingRescale(pendingRescale) { }
+
+    Ciphertext LazyCiphertext::alloc(uint64_t degree, uint64_t level) const {
+        return newCiphertext(params, degree, level);
+    }
+
+    void LazyCiphertext::relinearize() const {
+        if (ctDegree <= 1) {
+            return;
+        }
+        Ciphertext out = alloc(1, ctLevel);
+        latticpp::relinearize(eval, ct, out);
+        ct = move(out);
+        ctDegree = 1;
+    }
+
+    void LazyCiphertext::rescale() const {
+        if (!pendingRescale) {
+            return;
+        }
+        Ciphertext out = alloc(ctDegree, ctLevel);
+        latticpp::rescale(eval, ct, targetScale, out);
+        ct = move(out);
+        ctLevel = latticpp::level(ct);
+        ctScale = latticpp::scale(ct);
+        pendingRescale = false;
+    }
+
+    LazyCiphertext LazyCiphertext::mul(const LazyCiphertext &other) const {
+        relinearize();
+        rescale();
+        other.relinearize();
+        other.rescale();
+        Ciphertext out = alloc(2, min(ctLevel, other.ctLevel));
+        latticpp::mul(eval, ct, other.ct, out);
+        return LazyCiphertext(*this, move(out), true);
+    }
+
+    // Multiplying by a plaintext works at any degree, so only a pending rescale is applied
+    LazyCiphertext LazyCiphertext::mulPlain(PlaintextRef pt) const {
+        rescale();
+        Ciphertext out = alloc(ctDegree, ctLevel);
+        latticpp::mulPlain(eval, ct, pt, out);
+        return LazyCiphertext(*this, move(out), true);
+    }
+
+    // Integer constants leave the scale unchanged, in which case no rescale is needed
+    LazyCiphertext LazyCiphertext::multByConst(double constant) const {
+        rescale();
+        Ciphertext out = alloc(ctDegree, ctLevel);
+        latticpp::multByConst(eval, ct, constant, out);
+        return LazyCiphertext(*this, move(out), latticpp::scale(out) > ctScale);
+    }
+
+    // Sums of products keep their pending rescale. If only one operand has one, it is rescaled
+    // so that the two scales match.
+    LazyCiphertext LazyCiphertext::add(const LazyCiphertext &other) const {
+        if (pendingRescale != other.pendingRescale) {
+            rescale();
+            other.rescale();
+        }
+        Ciphertext out = alloc(max(ctDegree, other.ctDegree), min(ctLevel, other.ctLevel));
+        latticpp::add(eval, ct, other.ct, out);
+        return LazyCiphertext(*this, move(out), pendingRescale);
+    }
+
+    LazyCiphertext LazyCiphertext::sub(const LazyCiphertext &other) const {
+        if (pendingRescale != other.pendingRescale) {
+            rescale();
+            other.rescale();
+        }
+        Ciphertext out = alloc(max(ctDegree, other.ctDegree), min(ctLevel, other.ctLevel));
+        latticpp::sub(eval, ct, other.ct, out);
+        return LazyCiphertext(*this, move(out), pendingRescale);
+    }
+
+    LazyCiphertext LazyCiphertext::addPlain(PlaintextRef pt) const {
+        Ciphertext out = alloc(ctDegree, ctLevel);
+        latticpp::addPlain(eval, ct, pt, out);
+        return LazyCiphertext(*this, move(out), pendingRescale);
+    }
+
+    LazyCiphertext LazyCiphertext::subPlain(PlaintextRef pt) const {
+        Ciphertext out = alloc(ctDegree, ctLevel);
+        latticpp::subPlain(eval, ct, pt, out);
+        return LazyCiphertext(*this, move(out), pendingRescale);
+    }
+
+    LazyCiphertext LazyCiphertext::neg() const {
+        Ciphertext out = alloc(ctDegree, ctLevel);
+        latticpp::neg(eval, ct, out);
+        return LazyCiphertext(*this, move(out), pendingRescale);
+    }
+
+    // Rotation is a key switch, which needs a degree-1 input; the scale is unaffected, so a
+    // pending rescale stays pending
+    LazyCiphertext LazyCiphertext::rotate(uint64_t k) const {
+        relinearize();
+        Ciphertext out = alloc(1, ctLevel);
+        latticpp::rotate(eval, ct, k, out);
+        return LazyCiphertext(*this, move(out), pendingRescale);
+    }
+
+    CiphertextRef LazyCiphertext::materialize() const {
+        relinearize();
+        rescale();
+        return ct;
+    }
+
+    uint64_t LazyCiphertext::degree() const {
+        return ctDegree;
+    }
+
+    double LazyCiphertext::scale() const {
+        return ctScale;
+    }
+
+    uint64_t LazyCiphertext::level() const {
+        return ctLevel;
+    }
+
+    bool LazyCiphertext::rescalePending() const {
+        return pendingRescale;
+    }
+
+    LazyCiphertext operator+ (const LazyCiphertext &ct0, const LazyCiphertext &ct1) {
+        return ct0.add(ct1);
+    }
+
+    LazyCiphertext operator- (const LazyCiphertext &ct0, const LazyCiphertext &ct1) {
+        return ct0.sub(ct1);
+    }
+
+    LazyCiphertext operator* (const LazyCiphertext &ct0, const LazyCiphertext &ct1) {
+        return ct0.mul(ct1);
+    }
+
+}  // namespace latticpp
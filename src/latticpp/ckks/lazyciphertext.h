@@ -0,0 +1,89 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+
+namespace latticpp {
+
+    // A ciphertext whose relinearization and rescaling are deferred until they are needed. The
+    // product of two ciphertexts is left at degree 2 and at the product of their scales, and
+    // sums of such products stay that way, so an inner product of n terms costs one
+    // relinearization and one rescale instead of n of each. A ciphertext is relinearized before
+    // a rotation or a ciphertext multiplication, rescaled before any multiplication, and both
+    // in materialize().
+    //
+    // Operations return new LazyCiphertexts and never modify their inputs' contents, but a
+    // LazyCiphertext caches its own relinearized and rescaled forms, so it must not be used by
+    // several threads at once. Plaintexts which are added or subtracted must be encoded at
+    // scale(), which is the product of scales while a rescale is pending.
+    class LazyCiphertext {
+    public:
+        // `targetScale` is the scale passed to rescale; by default, the scale of the parameters.
+        // `ct` is shared rather than copied, so it must not be modified while this
+        // LazyCiphertext (or a copy of it) is in use.
+        LazyCiphertext(ParametersRef params, EvaluatorRef eval, CiphertextRef ct, double targetScale);
+
+        LazyCiphertext(ParametersRef params, EvaluatorRef eval, CiphertextRef ct);
+
+        LazyCiphertext mul(const LazyCiphertext &other) const;
+
+        LazyCiphertext mulPlain(PlaintextRef pt) const;
+
+        LazyCiphertext multByConst(double constant) const;
+
+        LazyCiphertext add(const LazyCiphertext &other) const;
+
+        LazyCiphertext sub(const LazyCiphertext &other) const;
+
+        LazyCiphertext addPlain(PlaintextRef pt) const;
+
+        LazyCiphertext subPlain(PlaintextRef pt) const;
+
+        LazyCiphertext neg() const;
+
+        LazyCiphertext rotate(uint64_t k) const;
+
+        // A degree-1 ciphertext with every pending rescale applied. This is a view of the
+        // LazyCiphertext's own cached ciphertext, which other LazyCiphertexts may share, so it
+        // is only valid while this LazyCiphertext is alive and must never be used as the output
+        // of an operation. Use copyNew(materialize()) for a ciphertext that can be modified.
+        CiphertextRef materialize() const;
+
+        uint64_t degree() const;
+
+        double scale() const;
+
+        uint64_t level() const;
+
+        bool rescalePending() const;
+
+    private:
+        LazyCiphertext(const LazyCiphertext &like, Ciphertext &&ct, bool pendingRescale);
+
+        Ciphertext alloc(uint64_t degree, uint64_t level) const;
+
+        void relinearize() const;
+
+        void rescale() const;
+
+        Parameters params;
+        Evaluator eval;
+        double targetScale;
+
+        // the current representation, replaced when it is relinearized or rescaled
+        mutable Ciphertext ct;
+        mutable uint64_t ctDegree;
+        mutable uint64_t ctLevel;
+        mutable double ctScale;
+        mutable bool pendingRescale;
+    };
+
+    LazyCiphertext operator+ (const LazyCiphertext &ct0, const LazyCiphertext &ct1);
+
+    LazyCiphertext operator- (const LazyCiphertext &ct0, const LazyCiphertext &ct1);
+
+    LazyCiphertext operator* (const LazyCiphertext &ct0, const LazyCiphertext &ct1);
+
+}  // namespace latticpp
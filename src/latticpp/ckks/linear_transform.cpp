@@ -0,0 +1,76 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "linear_transform.h"
+#include "params.h"
+#include <cmath>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+namespace latticpp {
+
+    LinearTransform newLinearTransform(ParametersRef params, EncoderRef encoder,
+                                       const map<int, vector<double>> &diagonals,
+                                       uint64_t level, double scale, uint64_t logBSGSRatio) {
+        if (diagonals.empty()) {
+            throw invalid_argument("A linear transform needs at least one diagonal");
+        }
+
+        size_t len = diagonals.begin()->second.size();
+        if (len == 0 || len > numSlots(params)) {
+            throw invalid_argument("Invalid diagonal length for newLinearTransform");
+        }
+        int logLen = log2(len);
+        if (len != pow(2, logLen)) {
+            throw invalid_argument("Invalid diagonal length for newLinearTransform");
+        }
+
+        // Lattigo reduces each index modulo the diagonal length, so an index outside
+        // (-len, len), or two indices that reduce to the same diagonal, would silently
+        // overwrite another diagonal.
+        int64_t slots = len;
+        set<int64_t> reduced;
+        vector<int64_t> indices;
+        vector<const double*> values;
+        for (const auto &diag : diagonals) {
+            if (diag.second.size() != len) {
+                throw invalid_argument("All diagonals of a linear transform must have the same length");
+            }
+            if (diag.first <= -slots || diag.first >= slots) {
+                throw invalid_argument("Diagonal index " + to_string(diag.first) + " is out of range for " +
+                                       to_string(slots) + " slots");
+            }
+            if (!reduced.insert((diag.first + slots) % slots).second) {
+                throw invalid_argument("Diagonal index " + to_string(diag.first) + " refers to the same diagonal as another index");
+            }
+            indices.push_back(diag.first);
+            values.push_back(diag.second.data());
+        }
+
+        return LinearTransform(lattigo_newLinearTransform(encoder.getRawHandle(), indices.data(), indices.size(),
+                                                          values.data(), logLen, level, scale, logBSGSRatio));
+    }
+
+    uint64_t level(LinearTransformRef lt) {
+        return lattigo_linearTransformLevel(lt.getRawHandle());
+    }
+
+    vector<int> rotations(LinearTransformRef lt) {
+        vector<int64_t> res(lattigo_linearTransformNumRotations(lt.getRawHandle()));
+        lattigo_linearTransformRotations(lt.getRawHandle(), res.data());
+        return vector<int>(res.begin(), res.end());
+    }
+
+    vector<uint64_t> galoisElements(ParametersRef params, LinearTransformRef lt) {
+        vector<uint64_t> res(lattigo_linearTransformNumRotations(lt.getRawHandle()));
+        lattigo_linearTransformGaloisElements(params.getRawHandle(), lt.getRawHandle(), res.data());
+        return res;
+    }
+
+    void linearTransform(EvaluatorRef eval, LinearTransformRef lt, CiphertextRef ctIn, Ciphertext &ctOut) {
+        lattigo_linearTransform(eval.getRawHandle(), lt.getRawHandle(), ctIn.getRawHandle(), ctOut.getRawHandle());
+    }
+}  // namespace latticpp
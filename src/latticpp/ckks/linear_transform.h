@@ -0,0 +1,38 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+#include "cgo/linear_transform.h"
+#include <map>
+#include <vector>
+
+namespace latticpp {
+
+    // Encode the diagonals of a plaintext matrix for multiplication with an encrypted vector.
+    // `diagonals` maps the index of each non-zero diagonal to its values; every diagonal must
+    // have the same power-of-two length `len`, at most numSlots(params), and every index must be
+    // in (-len, len), with a negative index -i naming diagonal len - i. Any other index, or two
+    // indices naming the same diagonal, throws std::invalid_argument. The diagonals are encoded once,
+    // at the given level and scale, and can then be applied to any number of ciphertexts at
+    // that level. The transform is evaluated with the baby-step giant-step algorithm, where
+    // logBSGSRatio is log2 of the ratio between the number of giant and baby steps.
+    LinearTransform newLinearTransform(ParametersRef params, EncoderRef encoder,
+                                       const std::map<int, std::vector<double>> &diagonals,
+                                       uint64_t level, double scale, uint64_t logBSGSRatio = 1);
+
+    uint64_t level(LinearTransformRef lt);
+
+    // The rotations needed to evaluate `lt`. Pass these to genRotationKeysForRotations to
+    // generate exactly the keys the transform uses.
+    std::vector<int> rotations(LinearTransformRef lt);
+
+    // The Galois elements corresponding to rotations(lt)
+    std::vector<uint64_t> galoisElements(ParametersRef params, LinearTransformRef lt);
+
+    // Compute the product of the matrix encoded in `lt` and the vector encrypted in `ctIn`.
+    // The evaluation key of `eval` must include every rotation in rotations(lt). The result
+    // is not rescaled.
+    void linearTransform(EvaluatorRef eval, LinearTransformRef lt, CiphertextRef ctIn, Ciphertext &ctOut);
+}  // namespace latticpp
@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "marshaler.h"
-#include <iterator>
-#include <sstream>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <unistd.h>
 #include <vector>
 
 using namespace std;
@@ -14,71 +17,583 @@ namespace latticpp {
         (*((ostream*)ostreamPtr)).write((const char*)data, len);
     }
 
-    void marshalBinaryCiphertext(const Ciphertext &ct, std::ostream &stream) {
+    static uint64_t readFromStream(void* istreamPtr, void* data, uint64_t len) {
+        istream &stream = *((istream*)istreamPtr);
+        stream.read((char*)data, len);
+        return stream.gcount();
+    }
+
+    // Read everything left in the stream using block reads. If the stream is seekable, the
+    // buffer is allocated once at the right size.
+    static vector<char> readRemaining(istream &stream) {
+        vector<char> buffer;
+        streampos start = stream.tellg();
+        if (start != streampos(-1) && stream.seekg(0, ios::end)) {
+            streampos end = stream.tellg();
+            stream.seekg(start);
+            buffer.resize(end - start);
+            stream.read(buffer.data(), buffer.size());
+            buffer.resize(stream.gcount());
+            return buffer;
+        }
+        stream.clear();
+
+        const size_t blockSize = 1 << 20;
+        size_t used = 0;
+        while (stream) {
+            buffer.resize(used + blockSize);
+            stream.read(buffer.data() + used, blockSize);
+            used += stream.gcount();
+        }
+        buffer.resize(used);
+        return buffer;
+    }
+
+    void marshalBinaryCiphertext(CiphertextRef ct, std::ostream &stream) {
         lattigo_marshalBinaryCiphertext(ct.getRawHandle(), &writeToStream, (void*)(&stream));
     }
 
-    void marshalBinaryParameters(const Parameters &params, std::ostream &stream) {
+    void marshalBinaryParameters(ParametersRef params, std::ostream &stream) {
         lattigo_marshalBinaryParameters(params.getRawHandle(), &writeToStream, (void*)(&stream));
     }
 
-    void marshalBinaryBootstrapParameters(const BootstrappingParameters &btp_params, std::ostream &stream) {
+    void marshalBinaryBootstrapParameters(BootstrappingParametersRef btp_params, std::ostream &stream) {
         lattigo_marshalBinaryBootstrapParameters(btp_params.getRawHandle(), &writeToStream, (void*)(&stream));
     }
 
-    void marshalBinarySecretKey(const SecretKey &sk, std::ostream &stream) {
+    void marshalBinarySecretKey(SecretKeyRef sk, std::ostream &stream) {
         lattigo_marshalBinarySecretKey(sk.getRawHandle(), &writeToStream, (void*)(&stream));
     }
 
-    void marshalBinaryPublicKey(const PublicKey &pk, std::ostream &stream) {
+    void marshalBinaryPublicKey(PublicKeyRef pk, std::ostream &stream) {
         lattigo_marshalBinaryPublicKey(pk.getRawHandle(), &writeToStream, (void*)(&stream));
     }
 
-    void marshalBinaryRelinearizationKey(const RelinearizationKey &relinKey, std::ostream &stream) {
+    void marshalBinaryRelinearizationKey(RelinearizationKeyRef relinKey, std::ostream &stream) {
         lattigo_marshalBinaryRelinearizationKey(relinKey.getRawHandle(), &writeToStream, (void*)(&stream));
     }
 
-    void marshalBinaryRotationKeys(const RotationKeys &rotKeys, std::ostream &stream) {
+    void marshalBinaryRotationKeys(RotationKeysRef rotKeys, std::ostream &stream) {
         lattigo_marshalBinaryRotationKeys(rotKeys.getRawHandle(), &writeToStream, (void*)(&stream));
     }
 
+    void marshalBinaryBootstrappingKey(BootstrappingKeyRef btpKey, std::ostream &stream) {
+        lattigo_marshalBinaryBootstrappingKey(btpKey.getRawHandle(), &writeToStream, (void*)(&stream));
+    }
+
+    void writeRotationKeyFile(RotationKeysRef rotKeys, std::ostream &stream) {
+        lattigo_writeRotationKeyFile(rotKeys.getRawHandle(), &writeToStream, (void*)(&stream));
+    }
+
     Ciphertext unmarshalBinaryCiphertext(istream &stream) {
-        // Note: the next line is a well-known hard parsing problem for C++.
-        // See https://stackoverflow.com/questions/4423361/constructing-a-vector-with-istream-iterators
-        // and https://arstechnica.com/civis/viewtopic.php?f=20&t=767929
-        // In addition to the difficult parsing problem, you also must import the <vector> and <iterator>
-        // headers. Without them, you get obscure errors.
-        vector<char> buffer(istreambuf_iterator<char>{stream}, {});
+        vector<char> buffer = readRemaining(stream);
         return Ciphertext(lattigo_unmarshalBinaryCiphertext(buffer.data(), buffer.size()));
     }
 
     Parameters unmarshalBinaryParameters(istream &stream) {
-        vector<char> buffer(istreambuf_iterator<char>{stream}, {});
+        vector<char> buffer = readRemaining(stream);
         return Parameters(lattigo_unmarshalBinaryParameters(buffer.data(), buffer.size()));
     }
 
     BootstrappingParameters unmarshalBinaryBootstrapParameters(std::istream &stream) {
-        vector<char> buffer(istreambuf_iterator<char>{stream}, {});
+        vector<char> buffer = readRemaining(stream);
         return BootstrappingParameters(lattigo_unmarshalBinaryBootstrapParameters(buffer.data(), buffer.size()));
     }
 
     SecretKey unmarshalBinarySecretKey(istream &stream) {
-        vector<char> buffer(istreambuf_iterator<char>{stream}, {});
+        vector<char> buffer = readRemaining(stream);
         return SecretKey(lattigo_unmarshalBinarySecretKey(buffer.data(), buffer.size()));
     }
 
     PublicKey unmarshalBinaryPublicKey(istream &stream) {
-        vector<char> buffer(istreambuf_iterator<char>{stream}, {});
+        vector<char> buffer = readRemaining(stream);
         return PublicKey(lattigo_unmarshalBinaryPublicKey(buffer.data(), buffer.size()));
     }
 
     RelinearizationKey unmarshalBinaryRelinearizationKey(istream &stream) {
-        vector<char> buffer(istreambuf_iterator<char>{stream}, {});
+        vector<char> buffer = readRemaining(stream);
         return RelinearizationKey(lattigo_unmarshalBinaryRelinearizationKey(buffer.data(), buffer.size()));
     }
 
     RotationKeys unmarshalBinaryRotationKeys(istream &stream) {
-        vector<char> buffer(istreambuf_iterator<char>{stream}, {});
+        vector<char> buffer = readRemaining(stream);
         return RotationKeys(lattigo_unmarshalBinaryRotationKeys(buffer.data(), buffer.size()));
     }
-}  // namespace latticpp
\ No newline at end of file
+
+    BootstrappingKey unmarshalBinaryBootstrappingKey(istream &stream) {
+        return BootstrappingKey(lattigo_readBinaryBootstrappingKey(&readFromStream, (void*)(&stream)));
+    }
+
+    static void checkSeeded(uint64_t written) {
+        if (!written) {
+            throw invalid_argument("Object has no seed, or has been modified since it was seeded");
+        }
+    }
+
+    void marshalBinarySeededCiphertext(CiphertextRef ct, std::ostream &stream) {
+        checkSeeded(lattigo_marshalBinarySeededCiphertext(ct.getRawHandle(), &writeToStream, (void*)(&stream)));
+    }
+
+    void marshalBinarySeededPublicKey(PublicKeyRef pk, std::ostream &stream) {
+        checkSeeded(lattigo_marshalBinarySeededPublicKey(pk.getRawHandle(), &writeToStream, (void*)(&stream)));
+    }
+
+    void marshalBinarySeededRelinearizationKey(RelinearizationKeyRef relinKey, std::ostream &stream) {
+        checkSeeded(lattigo_marshalBinarySeededRelinearizationKey(relinKey.getRawHandle(), &writeToStream, (void*)(&stream)));
+    }
+
+    void marshalBinarySeededRotationKeys(RotationKeysRef rotKeys, std::ostream &stream) {
+        checkSeeded(lattigo_marshalBinarySeededRotationKeys(rotKeys.getRawHandle(), &writeToStream, (void*)(&stream)));
+    }
+
+    Ciphertext unmarshalBinarySeededCiphertext(ParametersRef params, istream &stream) {
+        vector<char> buffer = readRemaining(stream);
+        return Ciphertext(lattigo_unmarshalBinarySeededCiphertext(params.getRawHandle(), buffer.data(), buffer.size()));
+    }
+
+    PublicKey unmarshalBinarySeededPublicKey(ParametersRef params, istream &stream) {
+        vector<char> buffer = readRemaining(stream);
+        return PublicKey(lattigo_unmarshalBinarySeededPublicKey(params.getRawHandle(), buffer.data(), buffer.size()));
+    }
+
+    RelinearizationKey unmarshalBinarySeededRelinearizationKey(ParametersRef params, istream &stream) {
+        vector<char> buffer = readRemaining(stream);
+        return RelinearizationKey(lattigo_unmarshalBinarySeededRelinearizationKey(params.getRawHandle(), buffer.data(), buffer.size()));
+    }
+
+    RotationKeys unmarshalBinarySeededRotationKeys(ParametersRef params, istream &stream) {
+        vector<char> buffer = readRemaining(stream);
+        return RotationKeys(lattigo_unmarshalBinarySeededRotationKeys(params.getRawHandle(), buffer.data(), buffer.size()));
+    }
+
+    // The marshalInto exports return the size of the object without writing anything if the
+    // buffer is too small, so that objects which can only be sized by serializing them are
+    // serialized once
+    static void checkBufferSize(uint64_t required, uint64_t size) {
+        if (size < required) {
+            throw invalid_argument("Buffer of " + to_string(size) + " bytes is too small for an object of " +
+                                   to_string(required) + " bytes");
+        }
+    }
+
+    static char* bufferPtr(const void *buffer) {
+        return static_cast<char*>(const_cast<void*>(buffer));
+    }
+
+    uint64_t marshalBinarySize(CiphertextRef ct) {
+        return lattigo_marshalBinarySizeCiphertext(ct.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(ParametersRef params) {
+        return lattigo_marshalBinarySizeParameters(params.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(SecretKeyRef sk) {
+        return lattigo_marshalBinarySizeSecretKey(sk.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(PublicKeyRef pk) {
+        return lattigo_marshalBinarySizePublicKey(pk.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(RelinearizationKeyRef relinKey) {
+        return lattigo_marshalBinarySizeRelinearizationKey(relinKey.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(RotationKeysRef rotKeys) {
+        return lattigo_marshalBinarySizeRotationKeys(rotKeys.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(PlaintextRef pt) {
+        return lattigo_marshalBinarySizePlaintext(pt.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(SwitchingKeyRef swk) {
+        return lattigo_marshalBinarySizeSwitchingKey(swk.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(BootstrappingKeyRef btpKey) {
+        return lattigo_marshalBinarySizeBootstrappingKey(btpKey.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(CKGShareRef share) {
+        return lattigo_marshalBinarySizeCKGShare(share.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(RKGShareRef share) {
+        return lattigo_marshalBinarySizeRKGShare(share.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(CKSShareRef share) {
+        return lattigo_marshalBinarySizeCKSShare(share.getRawHandle());
+    }
+
+    uint64_t marshalBinarySize(RTGShareRef share) {
+        return lattigo_marshalBinarySizeRTGShare(share.getRawHandle());
+    }
+
+    uint64_t marshalInto(CiphertextRef ct, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryCiphertext(ct.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(ParametersRef params, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryParameters(params.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(SecretKeyRef sk, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinarySecretKey(sk.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(PublicKeyRef pk, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryPublicKey(pk.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(RelinearizationKeyRef relinKey, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryRelinearizationKey(relinKey.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(RotationKeysRef rotKeys, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryRotationKeys(rotKeys.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(PlaintextRef pt, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryPlaintext(pt.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(SwitchingKeyRef swk, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinarySwitchingKey(swk.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(BootstrappingKeyRef btpKey, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryBootstrappingKey(btpKey.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(CKGShareRef share, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryCKGShare(share.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(RKGShareRef share, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryRKGShare(share.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(CKSShareRef share, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryCKSShare(share.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    uint64_t marshalInto(RTGShareRef share, void *buffer, uint64_t size) {
+        uint64_t written = lattigo_marshalIntoBinaryRTGShare(share.getRawHandle(), static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    Ciphertext unmarshalBinaryCiphertext(const void *buffer, uint64_t size) {
+        return Ciphertext(lattigo_unmarshalBinaryCiphertext(bufferPtr(buffer), size));
+    }
+
+    Parameters unmarshalBinaryParameters(const void *buffer, uint64_t size) {
+        return Parameters(lattigo_unmarshalBinaryParameters(bufferPtr(buffer), size));
+    }
+
+    SecretKey unmarshalBinarySecretKey(const void *buffer, uint64_t size) {
+        return SecretKey(lattigo_unmarshalBinarySecretKey(bufferPtr(buffer), size));
+    }
+
+    PublicKey unmarshalBinaryPublicKey(const void *buffer, uint64_t size) {
+        return PublicKey(lattigo_unmarshalBinaryPublicKey(bufferPtr(buffer), size));
+    }
+
+    RelinearizationKey unmarshalBinaryRelinearizationKey(const void *buffer, uint64_t size) {
+        return RelinearizationKey(lattigo_unmarshalBinaryRelinearizationKey(bufferPtr(buffer), size));
+    }
+
+    RotationKeys unmarshalBinaryRotationKeys(const void *buffer, uint64_t size) {
+        return RotationKeys(lattigo_unmarshalBinaryRotationKeys(bufferPtr(buffer), size));
+    }
+
+    Plaintext unmarshalBinaryPlaintext(const void *buffer, uint64_t size) {
+        return Plaintext(lattigo_unmarshalBinaryPlaintext(bufferPtr(buffer), size));
+    }
+
+    SwitchingKey unmarshalBinarySwitchingKey(const void *buffer, uint64_t size) {
+        return SwitchingKey(lattigo_unmarshalBinarySwitchingKey(bufferPtr(buffer), size));
+    }
+
+    BootstrappingKey unmarshalBinaryBootstrappingKey(const void *buffer, uint64_t size) {
+        return BootstrappingKey(lattigo_unmarshalBinaryBootstrappingKey(bufferPtr(buffer), size));
+    }
+
+    CKGShare unmarshalBinaryCKGShare(const void *buffer, uint64_t size) {
+        return CKGShare(lattigo_unmarshalBinaryCKGShare(bufferPtr(buffer), size));
+    }
+
+    RKGShare unmarshalBinaryRKGShare(const void *buffer, uint64_t size) {
+        return RKGShare(lattigo_unmarshalBinaryRKGShare(bufferPtr(buffer), size));
+    }
+
+    CKSShare unmarshalBinaryCKSShare(const void *buffer, uint64_t size) {
+        return CKSShare(lattigo_unmarshalBinaryCKSShare(bufferPtr(buffer), size));
+    }
+
+    RTGShare unmarshalBinaryRTGShare(const void *buffer, uint64_t size) {
+        return RTGShare(lattigo_unmarshalBinaryRTGShare(bufferPtr(buffer), size));
+    }
+
+    // Length prefixes are big-endian, like the section prefixes the Go marshalers write
+    static void writeLengthPrefix(uint64_t len, ostream &stream) {
+        char prefix[8];
+        for (int i = 0; i < 8; i++) {
+            prefix[i] = (char)(len >> (8 * (7 - i)));
+        }
+        stream.write(prefix, sizeof(prefix));
+    }
+
+    static uint64_t decodeLengthPrefix(const char *prefix) {
+        uint64_t len = 0;
+        for (int i = 0; i < 8; i++) {
+            len = (len << 8) | (unsigned char)prefix[i];
+        }
+        return len;
+    }
+
+    // The buffer for a length-prefixed object grows by at most this many bytes per read, so
+    // that a corrupt prefix fails on a short read rather than on a huge allocation
+    static const size_t PREFIXED_READ_CHUNK = 1 << 20;
+
+    // Read `len` bytes into a buffer with readChunk(dst, n), which reads exactly n bytes
+    // or throws
+    template<typename ReadChunk>
+    static vector<char> readChunked(uint64_t len, ReadChunk readChunk) {
+        vector<char> buffer;
+        while (buffer.size() < len) {
+            size_t chunk = min<uint64_t>(PREFIXED_READ_CHUNK, len - buffer.size());
+            size_t offset = buffer.size();
+            buffer.resize(offset + chunk);
+            readChunk(buffer.data() + offset, chunk);
+        }
+        return buffer;
+    }
+
+    // Read exactly one length-prefixed object from the stream
+    static vector<char> readPrefixedBytes(istream &stream) {
+        char prefix[8];
+        if (!stream.read(prefix, sizeof(prefix))) {
+            throw runtime_error("Unexpected end of stream while reading a length prefix");
+        }
+        return readChunked(decodeLengthPrefix(prefix), [&stream](char *dst, size_t n) {
+            if (!stream.read(dst, n)) {
+                throw runtime_error("Unexpected end of stream while reading a length-prefixed object");
+            }
+        });
+    }
+
+    static void readFully(int fd, char *buf, size_t len) {
+        while (len > 0) {
+            ssize_t n = read(fd, buf, len);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                throw runtime_error(n == 0 ? "Unexpected end of file while reading a length-prefixed object"
+                                           : string("Error reading a length-prefixed object: ") + strerror(errno));
+            }
+            buf += n;
+            len -= n;
+        }
+    }
+
+    static vector<char> readPrefixedBytes(int fd) {
+        char prefix[8];
+        readFully(fd, prefix, sizeof(prefix));
+        return readChunked(decodeLengthPrefix(prefix), [fd](char *dst, size_t n) { readFully(fd, dst, n); });
+    }
+
+    void writeLengthPrefixed(CiphertextRef ct, ostream &stream) {
+        writeLengthPrefix(lattigo_marshalBinarySizeCiphertext(ct.getRawHandle()), stream);
+        marshalBinaryCiphertext(ct, stream);
+    }
+
+    void writeLengthPrefixed(ParametersRef params, ostream &stream) {
+        writeLengthPrefix(lattigo_marshalBinarySizeParameters(params.getRawHandle()), stream);
+        marshalBinaryParameters(params, stream);
+    }
+
+    void writeLengthPrefixed(SecretKeyRef sk, ostream &stream) {
+        writeLengthPrefix(lattigo_marshalBinarySizeSecretKey(sk.getRawHandle()), stream);
+        marshalBinarySecretKey(sk, stream);
+    }
+
+    void writeLengthPrefixed(PublicKeyRef pk, ostream &stream) {
+        writeLengthPrefix(lattigo_marshalBinarySizePublicKey(pk.getRawHandle()), stream);
+        marshalBinaryPublicKey(pk, stream);
+    }
+
+    void writeLengthPrefixed(RelinearizationKeyRef relinKey, ostream &stream) {
+        writeLengthPrefix(lattigo_marshalBinarySizeRelinearizationKey(relinKey.getRawHandle()), stream);
+        marshalBinaryRelinearizationKey(relinKey, stream);
+    }
+
+    void writeLengthPrefixed(RotationKeysRef rotKeys, ostream &stream) {
+        writeLengthPrefix(lattigo_marshalBinarySizeRotationKeys(rotKeys.getRawHandle()), stream);
+        marshalBinaryRotationKeys(rotKeys, stream);
+    }
+
+    void writeLengthPrefixed(PlaintextRef pt, ostream &stream) {
+        // plaintexts have no stream marshaler, and are small enough to serialize in memory
+        vector<char> buffer(marshalBinarySize(pt));
+        marshalInto(pt, buffer.data(), buffer.size());
+        writeLengthPrefix(buffer.size(), stream);
+        stream.write(buffer.data(), buffer.size());
+    }
+
+    void writeLengthPrefixed(BootstrappingKeyRef btpKey, ostream &stream) {
+        writeLengthPrefix(lattigo_marshalBinarySizeBootstrappingKey(btpKey.getRawHandle()), stream);
+        marshalBinaryBootstrappingKey(btpKey, stream);
+    }
+
+    template<>
+    Ciphertext readLengthPrefixed<Ciphertext>(istream &stream) {
+        vector<char> buffer = readPrefixedBytes(stream);
+        return Ciphertext(lattigo_unmarshalBinaryCiphertext(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    Parameters readLengthPrefixed<Parameters>(istream &stream) {
+        vector<char> buffer = readPrefixedBytes(stream);
+        return Parameters(lattigo_unmarshalBinaryParameters(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    SecretKey readLengthPrefixed<SecretKey>(istream &stream) {
+        vector<char> buffer = readPrefixedBytes(stream);
+        return SecretKey(lattigo_unmarshalBinarySecretKey(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    PublicKey readLengthPrefixed<PublicKey>(istream &stream) {
+        vector<char> buffer = readPrefixedBytes(stream);
+        return PublicKey(lattigo_unmarshalBinaryPublicKey(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    RelinearizationKey readLengthPrefixed<RelinearizationKey>(istream &stream) {
+        vector<char> buffer = readPrefixedBytes(stream);
+        return RelinearizationKey(lattigo_unmarshalBinaryRelinearizationKey(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    RotationKeys readLengthPrefixed<RotationKeys>(istream &stream) {
+        vector<char> buffer = readPrefixedBytes(stream);
+        return RotationKeys(lattigo_unmarshalBinaryRotationKeys(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    Plaintext readLengthPrefixed<Plaintext>(istream &stream) {
+        vector<char> buffer = readPrefixedBytes(stream);
+        return unmarshalBinaryPlaintext(buffer.data(), buffer.size());
+    }
+
+    template<>
+    BootstrappingKey readLengthPrefixed<BootstrappingKey>(istream &stream) {
+        vector<char> buffer = readPrefixedBytes(stream);
+        return unmarshalBinaryBootstrappingKey(buffer.data(), buffer.size());
+    }
+
+    template<>
+    Ciphertext readLengthPrefixed<Ciphertext>(int fd) {
+        vector<char> buffer = readPrefixedBytes(fd);
+        return Ciphertext(lattigo_unmarshalBinaryCiphertext(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    Parameters readLengthPrefixed<Parameters>(int fd) {
+        vector<char> buffer = readPrefixedBytes(fd);
+        return Parameters(lattigo_unmarshalBinaryParameters(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    SecretKey readLengthPrefixed<SecretKey>(int fd) {
+        vector<char> buffer = readPrefixedBytes(fd);
+        return SecretKey(lattigo_unmarshalBinarySecretKey(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    PublicKey readLengthPrefixed<PublicKey>(int fd) {
+        vector<char> buffer = readPrefixedBytes(fd);
+        return PublicKey(lattigo_unmarshalBinaryPublicKey(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    RelinearizationKey readLengthPrefixed<RelinearizationKey>(int fd) {
+        vector<char> buffer = readPrefixedBytes(fd);
+        return RelinearizationKey(lattigo_unmarshalBinaryRelinearizationKey(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    RotationKeys readLengthPrefixed<RotationKeys>(int fd) {
+        vector<char> buffer = readPrefixedBytes(fd);
+        return RotationKeys(lattigo_unmarshalBinaryRotationKeys(buffer.data(), buffer.size()));
+    }
+
+    template<>
+    Plaintext readLengthPrefixed<Plaintext>(int fd) {
+        vector<char> buffer = readPrefixedBytes(fd);
+        return unmarshalBinaryPlaintext(buffer.data(), buffer.size());
+    }
+
+    template<>
+    BootstrappingKey readLengthPrefixed<BootstrappingKey>(int fd) {
+        vector<char> buffer = readPrefixedBytes(fd);
+        return unmarshalBinaryBootstrappingKey(buffer.data(), buffer.size());
+    }
+
+    uint64_t marshalBinarySizePacked(ParametersRef params, CiphertextRef ct, uint64_t maxLevel) {
+        return lattigo_marshalBinarySizePackedCiphertext(params.getRawHandle(), ct.getRawHandle(), maxLevel);
+    }
+
+    void marshalBinaryPackedCiphertext(ParametersRef params, CiphertextRef ct, std::ostream &stream, uint64_t maxLevel) {
+        writeLengthPrefix(marshalBinarySizePacked(params, ct, maxLevel), stream);
+        lattigo_marshalBinaryPackedCiphertext(params.getRawHandle(), ct.getRawHandle(), maxLevel,
+                                              &writeToStream, (void*)(&stream));
+    }
+
+    uint64_t marshalIntoPacked(ParametersRef params, CiphertextRef ct, void *buffer, uint64_t size, uint64_t maxLevel) {
+        uint64_t written = lattigo_marshalIntoBinaryPackedCiphertext(params.getRawHandle(), ct.getRawHandle(), maxLevel,
+                                                                    static_cast<char*>(buffer), size);
+        checkBufferSize(written, size);
+        return written;
+    }
+
+    Ciphertext unmarshalBinaryPackedCiphertext(ParametersRef params, istream &stream) {
+        vector<char> buffer = readPrefixedBytes(stream);
+        return Ciphertext(lattigo_unmarshalBinaryPackedCiphertext(params.getRawHandle(), buffer.data(), buffer.size()));
+    }
+
+    Ciphertext unmarshalBinaryPackedCiphertext(ParametersRef params, const void *buffer, uint64_t size) {
+        return Ciphertext(lattigo_unmarshalBinaryPackedCiphertext(params.getRawHandle(), bufferPtr(buffer), size));
+    }
+
+}  // namespace latticpp
@@ -5,22 +5,31 @@
 
 #include "latticpp/marshal/gohandle.h"
 #include "cgo/marshaler.h"
+#include <limits>
 
 namespace latticpp {
 
-    void marshalBinaryCiphertext(const Ciphertext &ct, std::ostream &stream);
+    void marshalBinaryCiphertext(CiphertextRef ct, std::ostream &stream);
 
-    void marshalBinaryParameters(const Parameters &params, std::ostream &stream);
+    void marshalBinaryParameters(ParametersRef params, std::ostream &stream);
 
-    void marshalBinaryBootstrapParameters(const BootstrappingParameters &btp_params, std::ostream &stream);
+    void marshalBinaryBootstrapParameters(BootstrappingParametersRef btp_params, std::ostream &stream);
 
-    void marshalBinarySecretKey(const SecretKey &sk, std::ostream &stream);
+    void marshalBinarySecretKey(SecretKeyRef sk, std::ostream &stream);
 
-    void marshalBinaryPublicKey(const PublicKey &pk, std::ostream &stream);
+    void marshalBinaryPublicKey(PublicKeyRef pk, std::ostream &stream);
 
-    void marshalBinaryRelinearizationKey(const RelinearizationKey &relinKey, std::ostream &stream);
+    void marshalBinaryRelinearizationKey(RelinearizationKeyRef relinKey, std::ostream &stream);
 
-    void marshalBinaryRotationKeys(const RotationKeys &rotKeys, std::ostream &stream);
+    // Rotation keys (including those in a bootstrapping key) are written to the stream one key
+    // at a time, so serializing them only needs enough extra memory for a single key.
+    void marshalBinaryRotationKeys(RotationKeysRef rotKeys, std::ostream &stream);
+
+    void marshalBinaryBootstrappingKey(BootstrappingKeyRef btpKey, std::ostream &stream);
+
+    // Write rotation keys as an indexed key file, which can be opened with openRotationKeyFile
+    // (see keyfile.h) to load individual keys on demand.
+    void writeRotationKeyFile(RotationKeysRef rotKeys, std::ostream &stream);
 
     Ciphertext unmarshalBinaryCiphertext(std::istream &stream);
 
@@ -35,4 +44,183 @@ namespace latticpp {
     RelinearizationKey unmarshalBinaryRelinearizationKey(std::istream &stream);
 
     RotationKeys unmarshalBinaryRotationKeys(std::istream &stream);
-}  // namespace latticpp
\ No newline at end of file
+
+    // Reads the bootstrapping key one rotation key at a time, so deserializing it only needs
+    // enough extra memory for a single key. Unlike the other functions above, this reads only
+    // the bytes of the key rather than the rest of the stream.
+    BootstrappingKey unmarshalBinaryBootstrappingKey(std::istream &stream);
+
+    // Compact format for objects seeded with seed() (see seeded.h), which stores the seed in
+    // place of the uniformly random half of the object. The random half is regenerated when the
+    // object is read back, which needs the parameters. Throws std::invalid_argument if the object
+    // has no seed or has been modified since it was seeded.
+    void marshalBinarySeededCiphertext(CiphertextRef ct, std::ostream &stream);
+
+    void marshalBinarySeededPublicKey(PublicKeyRef pk, std::ostream &stream);
+
+    void marshalBinarySeededRelinearizationKey(RelinearizationKeyRef relinKey, std::ostream &stream);
+
+    void marshalBinarySeededRotationKeys(RotationKeysRef rotKeys, std::ostream &stream);
+
+    Ciphertext unmarshalBinarySeededCiphertext(ParametersRef params, std::istream &stream);
+
+    PublicKey unmarshalBinarySeededPublicKey(ParametersRef params, std::istream &stream);
+
+    RelinearizationKey unmarshalBinarySeededRelinearizationKey(ParametersRef params, std::istream &stream);
+
+    RotationKeys unmarshalBinarySeededRotationKeys(ParametersRef params, std::istream &stream);
+
+    // Serialization into caller memory, such as a pre-registered network buffer or a shared
+    // memory slot, in the same format as the stream marshalers. marshalBinarySize returns the
+    // exact number of bytes which marshalInto writes. marshalInto returns the number of bytes
+    // written, and throws std::invalid_argument if the buffer is too small.
+    uint64_t marshalBinarySize(CiphertextRef ct);
+
+    uint64_t marshalBinarySize(ParametersRef params);
+
+    uint64_t marshalBinarySize(SecretKeyRef sk);
+
+    uint64_t marshalBinarySize(PublicKeyRef pk);
+
+    uint64_t marshalBinarySize(RelinearizationKeyRef relinKey);
+
+    uint64_t marshalBinarySize(RotationKeysRef rotKeys);
+
+    uint64_t marshalBinarySize(PlaintextRef pt);
+
+    uint64_t marshalBinarySize(SwitchingKeyRef swk);
+
+    uint64_t marshalBinarySize(BootstrappingKeyRef btpKey);
+
+    uint64_t marshalBinarySize(CKGShareRef share);
+
+    uint64_t marshalBinarySize(RKGShareRef share);
+
+    uint64_t marshalBinarySize(CKSShareRef share);
+
+    uint64_t marshalBinarySize(RTGShareRef share);
+
+    uint64_t marshalInto(CiphertextRef ct, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(ParametersRef params, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(SecretKeyRef sk, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(PublicKeyRef pk, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(RelinearizationKeyRef relinKey, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(RotationKeysRef rotKeys, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(PlaintextRef pt, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(SwitchingKeyRef swk, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(BootstrappingKeyRef btpKey, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(CKGShareRef share, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(RKGShareRef share, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(CKSShareRef share, void *buffer, uint64_t size);
+
+    uint64_t marshalInto(RTGShareRef share, void *buffer, uint64_t size);
+
+    // Deserialize an object from caller memory
+    Ciphertext unmarshalBinaryCiphertext(const void *buffer, uint64_t size);
+
+    Parameters unmarshalBinaryParameters(const void *buffer, uint64_t size);
+
+    SecretKey unmarshalBinarySecretKey(const void *buffer, uint64_t size);
+
+    PublicKey unmarshalBinaryPublicKey(const void *buffer, uint64_t size);
+
+    RelinearizationKey unmarshalBinaryRelinearizationKey(const void *buffer, uint64_t size);
+
+    RotationKeys unmarshalBinaryRotationKeys(const void *buffer, uint64_t size);
+
+    Plaintext unmarshalBinaryPlaintext(const void *buffer, uint64_t size);
+
+    SwitchingKey unmarshalBinarySwitchingKey(const void *buffer, uint64_t size);
+
+    BootstrappingKey unmarshalBinaryBootstrappingKey(const void *buffer, uint64_t size);
+
+    CKGShare unmarshalBinaryCKGShare(const void *buffer, uint64_t size);
+
+    RKGShare unmarshalBinaryRKGShare(const void *buffer, uint64_t size);
+
+    CKSShare unmarshalBinaryCKSShare(const void *buffer, uint64_t size);
+
+    RTGShare unmarshalBinaryRTGShare(const void *buffer, uint64_t size);
+
+    // Length-prefixed container format. Each object is preceded by the size of its serialized
+    // form as a big-endian uint64, so many objects can be stored back to back in one stream
+    // or file and read back one at a time. Objects are read in blocks of at most 1 MiB, so a
+    // corrupt or truncated prefix fails with std::runtime_error before allocating much more
+    // than the data actually present.
+    void writeLengthPrefixed(CiphertextRef ct, std::ostream &stream);
+
+    void writeLengthPrefixed(ParametersRef params, std::ostream &stream);
+
+    void writeLengthPrefixed(SecretKeyRef sk, std::ostream &stream);
+
+    void writeLengthPrefixed(PublicKeyRef pk, std::ostream &stream);
+
+    void writeLengthPrefixed(RelinearizationKeyRef relinKey, std::ostream &stream);
+
+    void writeLengthPrefixed(RotationKeysRef rotKeys, std::ostream &stream);
+
+    void writeLengthPrefixed(PlaintextRef pt, std::ostream &stream);
+
+    void writeLengthPrefixed(BootstrappingKeyRef btpKey, std::ostream &stream);
+
+    // Read the next object written by writeLengthPrefixed, e.g., readLengthPrefixed<Ciphertext>(in).
+    // Throws std::runtime_error if the stream ends early.
+    template<typename T>
+    T readLengthPrefixed(std::istream &stream);
+
+    // As above, but read directly from a file descriptor, bypassing iostreams
+    template<typename T>
+    T readLengthPrefixed(int fd);
+
+    template<> Ciphertext readLengthPrefixed<Ciphertext>(std::istream &stream);
+    template<> Parameters readLengthPrefixed<Parameters>(std::istream &stream);
+    template<> SecretKey readLengthPrefixed<SecretKey>(std::istream &stream);
+    template<> PublicKey readLengthPrefixed<PublicKey>(std::istream &stream);
+    template<> RelinearizationKey readLengthPrefixed<RelinearizationKey>(std::istream &stream);
+    template<> RotationKeys readLengthPrefixed<RotationKeys>(std::istream &stream);
+    template<> Plaintext readLengthPrefixed<Plaintext>(std::istream &stream);
+    template<> BootstrappingKey readLengthPrefixed<BootstrappingKey>(std::istream &stream);
+
+    template<> Ciphertext readLengthPrefixed<Ciphertext>(int fd);
+    template<> Parameters readLengthPrefixed<Parameters>(int fd);
+    template<> SecretKey readLengthPrefixed<SecretKey>(int fd);
+    template<> PublicKey readLengthPrefixed<PublicKey>(int fd);
+    template<> RelinearizationKey readLengthPrefixed<RelinearizationKey>(int fd);
+    template<> RotationKeys readLengthPrefixed<RotationKeys>(int fd);
+    template<> Plaintext readLengthPrefixed<Plaintext>(int fd);
+    template<> BootstrappingKey readLengthPrefixed<BootstrappingKey>(int fd);
+
+    // Compact wire format for ciphertexts which are sent rather than stored. Limbs above
+    // `maxLevel` are dropped, which for CKKS switches to a smaller modulus without changing the
+    // message or scale, and each coefficient is bit-packed to ceil(log2 qi) bits instead of a
+    // 64-bit word. The scale is carried as a double. Reading a packed ciphertext needs the
+    // parameters it was written with. On a stream, each packed ciphertext is preceded by its
+    // size as a big-endian uint64, as in writeLengthPrefixed, so several can be written back
+    // to back and unmarshalBinaryPackedCiphertext reads exactly one. The buffer functions
+    // take and produce the packed bytes alone, whose size is marshalBinarySizePacked.
+    const uint64_t KEEP_LEVEL = std::numeric_limits<uint64_t>::max();
+
+    uint64_t marshalBinarySizePacked(ParametersRef params, CiphertextRef ct, uint64_t maxLevel = KEEP_LEVEL);
+
+    void marshalBinaryPackedCiphertext(ParametersRef params, CiphertextRef ct, std::ostream &stream,
+                                       uint64_t maxLevel = KEEP_LEVEL);
+
+    uint64_t marshalIntoPacked(ParametersRef params, CiphertextRef ct, void *buffer, uint64_t size,
+                               uint64_t maxLevel = KEEP_LEVEL);
+
+    Ciphertext unmarshalBinaryPackedCiphertext(ParametersRef params, std::istream &stream);
+
+    Ciphertext unmarshalBinaryPackedCiphertext(ParametersRef params, const void *buffer, uint64_t size);
+
+}  // namespace latticpp
@@ -29,85 +29,85 @@ namespace latticpp {
         return Parameters(lattigo_newParametersFromLogModuli(logN, logQi.data(), logQi.size(), logPi.data(), logPi.size(), logScale));
     }
 
-    uint64_t numSlots(const Parameters &params) {
+    uint64_t numSlots(ParametersRef params) {
         return lattigo_numSlots(params.getRawHandle());
     }
 
-    uint64_t logN(const Parameters &params) {
+    uint64_t logN(ParametersRef params) {
         return lattigo_logN(params.getRawHandle());
     }
 
-    Ring ringQ(const Parameters &params) {
+    Ring ringQ(ParametersRef params) {
       return Ring(lattigo_ringQ(params.getRawHandle()));
     }
 
-    Ring ringP(const Parameters &params) {
+    Ring ringP(ParametersRef params) {
       return Ring(lattigo_ringP(params.getRawHandle()));
     }
 
-    RingQP ringQP(const Parameters &params) {
+    RingQP ringQP(ParametersRef params) {
       return RingQP(lattigo_ringQP(params.getRawHandle()));
     }
 
-    uint64_t logQP(const Parameters &params) {
+    uint64_t logQP(ParametersRef params) {
         return lattigo_logQP(params.getRawHandle());
     }
 
-    uint64_t maxLevel(const Parameters &params) {
+    uint64_t maxLevel(ParametersRef params) {
         return lattigo_maxLevel(params.getRawHandle());
     }
 
-    double scale(const Parameters &params) {
+    double scale(ParametersRef params) {
         return lattigo_paramsScale(params.getRawHandle());
     }
 
-    double sigma(const Parameters &params) {
+    double sigma(ParametersRef params) {
         return lattigo_sigma(params.getRawHandle());
     }
 
-    uint64_t qi(const Parameters &params, uint64_t i) {
+    uint64_t qi(ParametersRef params, uint64_t i) {
         return lattigo_getQi(params.getRawHandle(), i);
     }
 
-    uint64_t pi(const Parameters &params, uint64_t i) {
+    uint64_t pi(ParametersRef params, uint64_t i) {
         return lattigo_getPi(params.getRawHandle(), i);
     }
 
-    uint64_t qiCount(const Parameters &params) {
+    uint64_t qiCount(ParametersRef params) {
         return lattigo_qiCount(params.getRawHandle());
     }
 
-    uint64_t piCount(const Parameters &params) {
+    uint64_t piCount(ParametersRef params) {
         return lattigo_piCount(params.getRawHandle());
     }
 
-    uint64_t logQLvl(const Parameters &params, uint64_t lvl) {
+    uint64_t logQLvl(ParametersRef params, uint64_t lvl) {
         return lattigo_logQLvl(params.getRawHandle(), lvl);
     }
 
-    uint64_t logSlots(const Parameters &params) {
+    uint64_t logSlots(ParametersRef params) {
         return lattigo_logSlots(params.getRawHandle());
     }
 
-    uint64_t galoisElementForRowRotation(const Parameters &params) {
+    uint64_t galoisElementForRowRotation(ParametersRef params) {
       return lattigo_galoisElementForRowRotation(params.getRawHandle());
     }
 
-    vector<uint64_t> galoisElementsForRowInnerSum(const Parameters &params) {
+    vector<uint64_t> galoisElementsForRowInnerSum(ParametersRef params) {
       vector<uint64_t> res(logN(params) + 1);
       lattigo_galoisElementsForRowInnerSum(params.getRawHandle(), res.data());
       return res;
     }
 
-    uint64_t inverseGaloisElement(const Parameters &params, uint64_t galEl) {
+    uint64_t inverseGaloisElement(ParametersRef params, uint64_t galEl) {
       return lattigo_inverseGaloisElement(params.getRawHandle(), galEl);
     }
 
-    uint64_t rotationFromGaloisElement(const Parameters &params, uint64_t galEl) {
+    uint64_t rotationFromGaloisElement(ParametersRef params, uint64_t galEl) {
         return lattigo_rotationFromGaloisElement(params.getRawHandle(), galEl);
     }
 
-    uint64_t noiseBound(const Parameters &params) {
+    uint64_t noiseBound(ParametersRef params) {
       return lattigo_noiseBound(params.getRawHandle());
     }
 
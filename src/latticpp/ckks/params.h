@@ -45,43 +45,43 @@ namespace latticpp {
     // logN is the log of the polynomial ring degree. Alternatively, it is log(num_slots) + 1
     Parameters newParametersFromLogModuli(uint64_t logN, const std::vector<uint8_t> &logQi, const std::vector<uint8_t> &logPi, uint8_t logScale);
 
-    uint64_t numSlots(const Parameters &params);
+    uint64_t numSlots(ParametersRef params);
 
-    uint64_t logN(const Parameters &params);
+    uint64_t logN(ParametersRef params);
 
-    Ring ringQ(const Parameters &params);
+    Ring ringQ(ParametersRef params);
 
-    Ring ringP(const Parameters &params);
+    Ring ringP(ParametersRef params);
 
-    RingQP ringQP(const Parameters &params);
+    RingQP ringQP(ParametersRef params);
 
-    uint64_t logQP(const Parameters &params);
+    uint64_t logQP(ParametersRef params);
 
-    uint64_t maxLevel(const Parameters &params);
+    uint64_t maxLevel(ParametersRef params);
 
-    double scale(const Parameters &params);
+    double scale(ParametersRef params);
 
-    double sigma(const Parameters &params);
+    double sigma(ParametersRef params);
 
-    uint64_t qi(const Parameters &params, uint64_t i);
+    uint64_t qi(ParametersRef params, uint64_t i);
 
-    uint64_t pi(const Parameters &params, uint64_t i);
+    uint64_t pi(ParametersRef params, uint64_t i);
 
-    uint64_t qiCount(const Parameters &params);
+    uint64_t qiCount(ParametersRef params);
 
-    uint64_t piCount(const Parameters &params);
+    uint64_t piCount(ParametersRef params);
 
-    uint64_t logQLvl(const Parameters &params, uint64_t lvl);
+    uint64_t logQLvl(ParametersRef params, uint64_t lvl);
 
-    uint64_t logSlots(const Parameters &params);
+    uint64_t logSlots(ParametersRef params);
 
-    uint64_t galoisElementForRowRotation(const Parameters &params);
+    uint64_t galoisElementForRowRotation(ParametersRef params);
 
-    std::vector<uint64_t> galoisElementsForRowInnerSum(const Parameters &params);
+    std::vector<uint64_t> galoisElementsForRowInnerSum(ParametersRef params);
     
-    uint64_t inverseGaloisElement(const Parameters &params, uint64_t galEl);
+    uint64_t inverseGaloisElement(ParametersRef params, uint64_t galEl);
 
-    uint64_t rotationFromGaloisElement(const Parameters &params, uint64_t galEl);
+    uint64_t rotationFromGaloisElement(ParametersRef params, uint64_t galEl);
     
-    uint64_t noiseBound(const Parameters &params);
+    uint64_t noiseBound(ParametersRef params);
 }  // namespace latticpp
\ No newline at end of file
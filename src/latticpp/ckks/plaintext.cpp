@@ -5,15 +5,15 @@
 
 namespace latticpp {
 
-    Plaintext newPlaintext(const Parameters &params, uint64_t level){
+    Plaintext newPlaintext(ParametersRef params, uint64_t level){
         return Plaintext(lattigo_newPlaintext(params.getRawHandle(), level));
     }
 
-    Plaintext newPlaintextFromPoly(const Parameters &params, const Poly &poly, uint64_t level){
+    Plaintext newPlaintextFromPoly(ParametersRef params, PolyRef poly, uint64_t level){
         return Plaintext(lattigo_newPlaintextFromPoly(params.getRawHandle(), poly.getRawHandle(), level));
     }
 
-    double scale(const Plaintext &ct) {
+    double scale(PlaintextRef ct) {
         return lattigo_plaintextGetScale(ct.getRawHandle());
     }
 
@@ -21,7 +21,7 @@ namespace latticpp {
         lattigo_plaintextSetScale(ct.getRawHandle(), scale);
     }    
 
-    Poly poly(const Plaintext &plaintext) {
+    Poly poly(PlaintextRef plaintext) {
         return Poly(lattigo_getPlaintextPoly(plaintext.getRawHandle()));
     }
 
@@ -8,13 +8,13 @@
 
 namespace latticpp {
 
-    Plaintext newPlaintext(const Parameters &params, uint64_t level);
+    Plaintext newPlaintext(ParametersRef params, uint64_t level);
 
-    Plaintext newPlaintextFromPoly(const Parameters &params, const Poly &poly, uint64_t level);
+    Plaintext newPlaintextFromPoly(ParametersRef params, PolyRef poly, uint64_t level);
 
-    double scale(const Plaintext &ct);
+    double scale(PlaintextRef ct);
 
     void setScale(Plaintext &ct, double scale);
 
-    Poly poly(const Plaintext &plaintext);
+    Poly poly(PlaintextRef plaintext);
 }  // namespace latticpp
\ No newline at end of file
@@ -0,0 +1,127 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "plaintextcache.h"
+#include "ciphertext.h"
+#include "encoder.h"
+#include "evaluator.h"
+#include "params.h"
+#include <cstring>
+
+using namespace std;
+
+namespace latticpp {
+
+    static uint64_t bitsOf(double x) {
+        uint64_t bits;
+        memcpy(&bits, &x, sizeof(bits));
+        return bits;
+    }
+
+    // 64-bit FNV-1a, applied to whole words rather than bytes
+    static uint64_t hashValues(const vector<double> &values) {
+        uint64_t h = 14695981039346656037ULL ^ values.size();
+        for (double x : values) {
+            h = (h ^ bitsOf(x)) * 1099511628211ULL;
+        }
+        return h;
+    }
+
+    size_t PlaintextCache::KeyHash::operator() (const Key &key) const {
+        uint64_t h = key.hash;
+        h = (h ^ key.level) * 1099511628211ULL;
+        h = (h ^ key.scaleBits) * 1099511628211ULL;
+        return h;
+    }
+
+    PlaintextCache::PlaintextCache(ParametersRef params, EncoderRef encoder, uint64_t maxBytes)
+        : params(params), encoder(encoder), ringDegree(((uint64_t)1) << logN(params)), maxBytes(maxBytes) { }
+
+    Plaintext PlaintextCache::get(const vector<double> &values, uint64_t level, double scale) {
+        Key key{hashValues(values), level, bitsOf(scale)};
+
+        lock_guard<mutex> guard(lock);
+        auto it = index.find(key);
+        if (it != index.end()) {
+            if (it->second->values == values) {
+                numHits++;
+                entries.splice(entries.begin(), entries, it->second);
+                return it->second->pt;
+            }
+            // hash collision: replace the old entry
+            usedBytes -= it->second->bytes;
+            entries.erase(it->second);
+            index.erase(it);
+        }
+
+        numMisses++;
+        Plaintext pt = encodeNew(encoder, values, level, scale);
+        // one 64-bit word per coefficient for each of the level+1 moduli, plus the key values
+        uint64_t entryBytes = ringDegree * (level + 1) * sizeof(uint64_t) + values.size() * sizeof(double);
+        if (entryBytes > maxBytes) {
+            // too large to ever cache
+            return pt;
+        }
+        evictTo(maxBytes - entryBytes);
+        entries.push_front(Entry{key, values, pt, entryBytes});
+        index[key] = entries.begin();
+        usedBytes += entryBytes;
+        return pt;
+    }
+
+    void PlaintextCache::evictTo(uint64_t limit) {
+        while (usedBytes > limit && !entries.empty()) {
+            usedBytes -= entries.back().bytes;
+            index.erase(entries.back().key);
+            entries.pop_back();
+            numEvictions++;
+        }
+    }
+
+    void PlaintextCache::clear() {
+        lock_guard<mutex> guard(lock);
+        entries.clear();
+        index.clear();
+        usedBytes = 0;
+    }
+
+    uint64_t PlaintextCache::hits() const {
+        lock_guard<mutex> guard(lock);
+        return numHits;
+    }
+
+    uint64_t PlaintextCache::misses() const {
+        lock_guard<mutex> guard(lock);
+        return numMisses;
+    }
+
+    uint64_t PlaintextCache::evictions() const {
+        lock_guard<mutex> guard(lock);
+        return numEvictions;
+    }
+
+    size_t PlaintextCache::size() const {
+        lock_guard<mutex> guard(lock);
+        return entries.size();
+    }
+
+    uint64_t PlaintextCache::bytes() const {
+        lock_guard<mutex> guard(lock);
+        return usedBytes;
+    }
+
+    void mulPlain(EvaluatorRef eval, PlaintextCache &cache, CiphertextRef ctIn, const vector<double> &values,
+                  double ptScale, Ciphertext &ctOut) {
+        mulPlain(eval, ctIn, cache.get(values, level(ctIn), ptScale), ctOut);
+    }
+
+    void addPlain(EvaluatorRef eval, PlaintextCache &cache, CiphertextRef ctIn, const vector<double> &values,
+                  Ciphertext &ctOut) {
+        addPlain(eval, ctIn, cache.get(values, level(ctIn), scale(ctIn)), ctOut);
+    }
+
+    void subPlain(EvaluatorRef eval, PlaintextCache &cache, CiphertextRef ctIn, const vector<double> &values,
+                  Ciphertext &ctOut) {
+        subPlain(eval, ctIn, cache.get(values, level(ctIn), scale(ctIn)), ctOut);
+    }
+}  // namespace latticpp
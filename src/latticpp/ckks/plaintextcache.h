@@ -0,0 +1,97 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace latticpp {
+
+    // Caches encoded plaintexts, so that constant vectors (e.g., model weights) which are used
+    // over and over are only encoded once for each level and scale. Entries are keyed by a hash
+    // of their values together with the level and scale; a hit also compares the values
+    // themselves, so a hash collision can never return the wrong plaintext. The cached
+    // plaintexts are in the NTT domain, as produced by the encoder.
+    //
+    // The cache holds at most `maxBytes` of plaintexts (as estimated from the ring degree and
+    // level) and evicts the least recently used entries first. It is safe to use from several
+    // threads, but encoding happens under the cache's lock, since it shares one encoder.
+    class PlaintextCache {
+    public:
+        PlaintextCache(ParametersRef params, EncoderRef encoder, uint64_t maxBytes);
+
+        PlaintextCache(const PlaintextCache&) = delete;
+        PlaintextCache& operator= (const PlaintextCache&) = delete;
+
+        // The encoding of `values` at the given level and scale, encoded on a miss. The
+        // returned plaintext must not be modified.
+        Plaintext get(const std::vector<double> &values, uint64_t level, double scale);
+
+        void clear();
+
+        uint64_t hits() const;
+
+        uint64_t misses() const;
+
+        uint64_t evictions() const;
+
+        // number of cached plaintexts
+        size_t size() const;
+
+        // estimated memory held by the cache, in bytes
+        uint64_t bytes() const;
+
+    private:
+        struct Key {
+            uint64_t hash;
+            uint64_t level;
+            uint64_t scaleBits;
+
+            bool operator== (const Key &other) const {
+                return hash == other.hash && level == other.level && scaleBits == other.scaleBits;
+            }
+        };
+
+        struct KeyHash {
+            size_t operator() (const Key &key) const;
+        };
+
+        struct Entry {
+            Key key;
+            std::vector<double> values;
+            Plaintext pt;
+            uint64_t bytes;
+        };
+
+        void evictTo(uint64_t limit);
+
+        Parameters params;
+        Encoder encoder;
+        uint64_t ringDegree;
+        uint64_t maxBytes;
+
+        mutable std::mutex lock;
+        // most recently used first
+        std::list<Entry> entries;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+        uint64_t usedBytes = 0;
+        uint64_t numHits = 0;
+        uint64_t numMisses = 0;
+        uint64_t numEvictions = 0;
+    };
+
+    // Multiply by (or add, or subtract) a constant vector, encoded through `cache` at the level
+    // of `ctIn`. Addition and subtraction use the scale of `ctIn`; multiplication uses `ptScale`.
+    void mulPlain(EvaluatorRef eval, PlaintextCache &cache, CiphertextRef ctIn, const std::vector<double> &values,
+                  double ptScale, Ciphertext &ctOut);
+
+    void addPlain(EvaluatorRef eval, PlaintextCache &cache, CiphertextRef ctIn, const std::vector<double> &values,
+                  Ciphertext &ctOut);
+
+    void subPlain(EvaluatorRef eval, PlaintextCache &cache, CiphertextRef ctIn, const std::vector<double> &values,
+                  Ciphertext &ctOut);
+}  // namespace latticpp
@@ -0,0 +1,298 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "planner.h"
+#include "bootstrap.h"
+#include "bootstrap_params.h"
+#include "ciphertext.h"
+#include "evaluator.h"
+#include "params.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+namespace latticpp {
+
+    // Repetitions of each operation timed by measureCosts, except bootstrapping
+    const int COST_REPETITIONS = 8;
+
+    template<typename F>
+    static double timeOp(F f, int repetitions) {
+        high_resolution_clock::time_point start = high_resolution_clock::now();
+        for (int i = 0; i < repetitions; i++) {
+            f();
+        }
+        return duration_cast<duration<double>>(high_resolution_clock::now() - start).count() / repetitions;
+    }
+
+    CostModel measureCosts(ParametersRef params, EvaluatorRef eval) {
+        uint64_t level = maxLevel(params);
+        double limbs = level + 1;
+        // the contents of the ciphertexts do not affect the running time
+        Ciphertext ct = newCiphertext(params, 1, level);
+        Ciphertext tensor = newCiphertext(params, 2, level);
+        Ciphertext out = newCiphertext(params, 1, level);
+        Ciphertext rescaled = newCiphertext(params, 2, level);
+
+        CostModel costs;
+        costs.add = timeOp([&]() { add(eval, ct, ct, out); }, COST_REPETITIONS) / limbs;
+        costs.mul = timeOp([&]() { mul(eval, ct, ct, tensor); }, COST_REPETITIONS) / limbs;
+        costs.keySwitch = timeOp([&]() { relinearize(eval, tensor, out); }, COST_REPETITIONS) / limbs;
+        // `tensor` is at the square of the default scale, so this divides by one modulus
+        costs.rescale = timeOp([&]() { rescale(eval, tensor, scale(params), rescaled); }, COST_REPETITIONS) / limbs;
+        return costs;
+    }
+
+    CostModel measureCosts(ParametersRef params, EvaluatorRef eval, BootstrapperRef btp) {
+        CostModel costs = measureCosts(params, eval);
+        Ciphertext ct = newCiphertext(params, 1, 0);
+        costs.bootstrap = timeOp([&]() { bootstrap(btp, ct); }, 1);
+        return costs;
+    }
+
+    // Plans one circuit. Nodes of the input circuit are visited in the order they were added,
+    // which is a topological order, and each is emitted into the planned circuit after any
+    // bootstraps and level drops its operands need.
+    class Planner {
+    public:
+        using Op = Circuit::Op;
+        using Node = Circuit::Node;
+        using Value = Circuit::Value;
+
+        Planner(const Circuit &in, ParametersRef params, uint64_t inputLevel, bool canBootstrap,
+                uint64_t bootstrapLevel, const CostModel &costs)
+            : in(in), params(params), inputLevel(inputLevel), canBootstrap(canBootstrap),
+              bootstrapLevel(bootstrapLevel), costs(costs), source(in.nodes.size()), mapped(in.nodes.size()) {
+            if (inputLevel > maxLevel(params)) {
+                throw invalid_argument("Input level " + to_string(inputLevel) + " is above the maximum level " +
+                                       to_string(maxLevel(params)));
+            }
+            if (canBootstrap && bootstrapLevel == 0) {
+                throw invalid_argument("Bootstrapping must produce ciphertexts above level 0");
+            }
+        }
+
+        LevelPlan plan() {
+            for (size_t i = 0; i < in.nodes.size(); i++) {
+                visit(i);
+            }
+            for (Value o : in.outputs) {
+                Value v = mapped[source[o]];
+                result.circuit.output(v);
+                result.outputLevels.push_back(levels[v]);
+            }
+            result.listing = listing.str();
+            return move(result);
+        }
+
+    private:
+        // Levels consumed by an operation of the input circuit
+        static uint64_t consumed(const Node &node) {
+            switch (node.op) {
+                case Op::Mul:
+                case Op::MulRelin:
+                case Op::MulPlain:
+                    return 1;
+                // Lattigo scales a non-integer constant by the current modulus, and leaves
+                // an integer unscaled
+                case Op::MultByConst:
+                    return trunc(node.constant) == node.constant ? 0 : 1;
+                case Op::DropLevel:
+                    return node.k;
+                default:
+                    return 0;
+            }
+        }
+
+        void visit(size_t i) {
+            const Node &node = in.nodes[i];
+            source[i] = i;
+            if (node.op == Op::Input) {
+                Value v = result.circuit.input();
+                levels.push_back(inputLevel);
+                describe(v);
+                mapped[i] = v;
+                return;
+            }
+            if (node.op == Op::Rescale) {
+                // rescaling is planned; this node is an alias of its operand
+                source[i] = source[node.args[0]];
+                return;
+            }
+            if (node.op == Op::Bootstrap) {
+                mapped[i] = bootstrap(mapped[source[node.args[0]]]);
+                return;
+            }
+
+            uint64_t needed = consumed(node);
+            uint64_t target = UINT64_MAX;
+            for (Value arg : node.args) {
+                size_t s = source[arg];
+                if (levels[mapped[s]] < needed) {
+                    refresh(s, needed, i);
+                }
+                target = min(target, levels[mapped[s]]);
+            }
+
+            Node out = node;
+            for (size_t a = 0; a < out.args.size(); a++) {
+                out.args[a] = alignTo(mapped[source[node.args[a]]], target);
+            }
+
+            Value v;
+            if (node.op == Op::DropLevel) {
+                v = emit(move(out), target - needed, 0);
+                result.levelDrops++;
+            } else {
+                v = emit(move(out), target, cost(node.op, target));
+                if (needed > 0) {
+                    Node r{Op::Rescale, {v}};
+                    r.constant = scale(params);
+                    v = emit(move(r), target - needed, costs.rescale * (target + 1));
+                    result.rescales++;
+                }
+            }
+            mapped[i] = v;
+        }
+
+        // Bootstrap the current value of input node `s` for all its later uses
+        void refresh(size_t s, uint64_t needed, size_t consumer) {
+            if (!canBootstrap) {
+                throw invalid_argument("Circuit node " + to_string(consumer) + " consumes " + to_string(needed) +
+                                       " levels, but its operand is at level " + to_string(levels[mapped[s]]) +
+                                       "; the circuit needs bootstrapping");
+            }
+            if (bootstrapLevel < needed) {
+                throw invalid_argument("Circuit node " + to_string(consumer) + " consumes " + to_string(needed) +
+                                       " levels, but bootstrapping only provides " + to_string(bootstrapLevel));
+            }
+            mapped[s] = bootstrap(mapped[s]);
+        }
+
+        Value bootstrap(Value v) {
+            if (!canBootstrap) {
+                throw invalid_argument("Circuit has bootstrap operations, but no bootstrapping parameters were given");
+            }
+            result.bootstraps++;
+            result.bootstrapSeconds += costs.bootstrap;
+            return emit(Node{Op::Bootstrap, {v}}, bootstrapLevel, costs.bootstrap);
+        }
+
+        // `v` dropped to `target`, sharing the dropped copy between all uses at that level
+        Value alignTo(Value v, uint64_t target) {
+            if (levels[v] == target) {
+                return v;
+            }
+            auto it = dropped.find({v, target});
+            if (it != dropped.end()) {
+                return it->second;
+            }
+            Node d{Op::DropLevel, {v}};
+            d.k = levels[v] - target;
+            Value out = emit(move(d), target, 0);
+            result.levelDrops++;
+            dropped[{v, target}] = out;
+            return out;
+        }
+
+        // Cost of an operation whose operands are at `level`
+        double cost(Op op, uint64_t level) const {
+            double limbs = level + 1;
+            switch (op) {
+                case Op::Mul:
+                case Op::MulPlain:
+                    return costs.mul * limbs;
+                case Op::MulRelin:
+                    return (costs.mul + costs.keySwitch) * limbs;
+                case Op::Relinearize:
+                case Op::Rotate:
+                    return costs.keySwitch * limbs;
+                case Op::Add:
+                case Op::Sub:
+                case Op::Neg:
+                case Op::MultByConst:
+                case Op::AddConst:
+                case Op::AddPlain:
+                case Op::SubPlain:
+                    return costs.add * limbs;
+                default:
+                    return 0;
+            }
+        }
+
+        Value emit(Node &&node, uint64_t level, double seconds) {
+            Value v = result.circuit.addNode(move(node));
+            levels.push_back(level);
+            result.predictedSeconds += seconds;
+            describe(v);
+            return v;
+        }
+
+        // Append a planned node to the listing
+        void describe(Value v) {
+            static const char *const NAMES[] = {
+                "input", "add", "sub", "neg", "mul", "mulRelin", "relinearize", "rescale", "rotate",
+                "multByConst", "addConst", "mulPlain", "addPlain", "subPlain", "dropLevel", "bootstrap"};
+            const Node &node = result.circuit.nodes[v];
+            listing << "v" << v << " = " << NAMES[static_cast<size_t>(node.op)] << "(";
+            if (node.op == Op::Input) {
+                listing << node.k;
+            }
+            for (size_t a = 0; a < node.args.size(); a++) {
+                listing << (a > 0 ? ", " : "") << "v" << node.args[a];
+            }
+            switch (node.op) {
+                case Op::Rotate:
+                case Op::DropLevel:
+                    listing << ", " << node.k;
+                    break;
+                case Op::Rescale:
+                case Op::MultByConst:
+                case Op::AddConst:
+                    listing << ", " << node.constant;
+                    break;
+                case Op::MulPlain:
+                case Op::AddPlain:
+                case Op::SubPlain:
+                    listing << ", <plaintext>";
+                    break;
+                default:
+                    break;
+            }
+            listing << ")  // level " << levels[v] << "\n";
+        }
+
+        const Circuit &in;
+        ParametersRef params;
+        uint64_t inputLevel;
+        bool canBootstrap;
+        uint64_t bootstrapLevel;
+        const CostModel &costs;
+
+        // The input node whose value each input node stands for (itself, except for rescales)
+        vector<size_t> source;
+        // The planned value of each input node, replaced by its bootstrapped value when refreshed
+        vector<Value> mapped;
+        // The level of each planned value
+        vector<uint64_t> levels;
+        map<pair<Value, uint64_t>, Value> dropped;
+
+        LevelPlan result;
+        ostringstream listing;
+    };
+
+    LevelPlan planLevels(const Circuit &circuit, ParametersRef params, uint64_t inputLevel, const CostModel &costs) {
+        return Planner(circuit, params, inputLevel, false, 0, costs).plan();
+    }
+
+    LevelPlan planLevels(const Circuit &circuit, ParametersRef params, BootstrappingParametersRef bootParams,
+                         uint64_t inputLevel, const CostModel &costs) {
+        return Planner(circuit, params, inputLevel, true, outputLevel(bootParams), costs).plan();
+    }
+}  // namespace latticpp
@@ -0,0 +1,75 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+#include "latticpp/ckks/circuit.h"
+#include <string>
+#include <vector>
+
+namespace latticpp {
+
+    // Estimated running time of each kind of operation, in seconds. All but `bootstrap` are per
+    // RNS limb (level + 1) of the operands, which these operations are roughly linear in. The
+    // default model is all zeros, so a plan made with it only counts operations.
+    struct CostModel {
+        // add, sub, neg, multByConst, and the constant and plaintext operations other than mulPlain
+        double add = 0;
+        // the tensor product of mul and mulRelin, or a mulPlain
+        double mul = 0;
+        // one key switch, as in relinearize, mulRelin and rotate
+        double keySwitch = 0;
+        double rescale = 0;
+        double bootstrap = 0;
+    };
+
+    // Time each operation at the top level of `params`, leaving the bootstrap cost at 0.
+    // `eval` must have a relinearization key.
+    CostModel measureCosts(ParametersRef params, EvaluatorRef eval);
+
+    // As above, also timing one bootstrap with `btp` (which takes ~20 s with N16 parameters)
+    CostModel measureCosts(ParametersRef params, EvaluatorRef eval, BootstrapperRef btp);
+
+    struct LevelPlan {
+        // The input circuit with rescale, dropLevel and bootstrap operations inserted, ready to
+        // execute on inputs at the planned input level
+        Circuit circuit;
+
+        // The level of each output of `circuit`
+        std::vector<uint64_t> outputLevels;
+
+        // Number of operations of each kind in `circuit`
+        size_t bootstraps = 0;
+        size_t rescales = 0;
+        size_t levelDrops = 0;
+
+        // Predicted time to execute `circuit` on one thread, and the part of it spent
+        // bootstrapping, according to the cost model
+        double predictedSeconds = 0;
+        double bootstrapSeconds = 0;
+
+        // `circuit` as a sequence of evaluator calls, one per line, with the level of each result
+        std::string listing;
+    };
+
+    // Plan the levels of a circuit written without rescale or dropLevel operations. The planner
+    // owns rescaling: every mul, mulRelin, mulPlain and multByConst (by a non-integer) is
+    // followed by a rescale to the default scale of `params`, which consumes one level, and
+    // rescales in the input circuit are ignored. The operands of each binary operation are
+    // brought to the same level by dropping levels from the higher one.
+    //
+    // This assumes that every input is at `inputLevel` with the default scale, and that the
+    // moduli of `params` are close to the default scale, as in Lattigo's default parameters.
+    // Throws std::invalid_argument if the circuit needs more levels than its inputs have.
+    LevelPlan planLevels(const Circuit &circuit, ParametersRef params, uint64_t inputLevel,
+                         const CostModel &costs = CostModel());
+
+    // As above, but bootstrap wherever an operation needs more levels than its operand has left.
+    // Bootstraps are placed as late as possible, and a bootstrapped value replaces the original
+    // for all its later uses, so no value is bootstrapped twice. This gives the fewest
+    // bootstraps on a chain of operations, and on a general DAG it lets additions merge values
+    // before they are refreshed together, but it is a heuristic rather than an optimum there.
+    LevelPlan planLevels(const Circuit &circuit, ParametersRef params, BootstrappingParametersRef bootParams,
+                         uint64_t inputLevel, const CostModel &costs = CostModel());
+}  // namespace latticpp
@@ -8,7 +8,7 @@ using namespace std;
 namespace latticpp {
 
 
-    std::string precisionStats(const Parameters &params, const Encoder &encoder, const std::vector<double> &expectedValues, const std::vector<double> &actualValues) {
+    std::string precisionStats(ParametersRef params, EncoderRef encoder, const std::vector<double> &expectedValues, const std::vector<double> &actualValues) {
         int len = expectedValues.size();
         if (len != actualValues.size()) {
             throw invalid_argument("Inputs to precisionStats do not have the same length.");
@@ -0,0 +1,52 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "seeded.h"
+#include "encryptor.h"
+#include "keygen.h"
+
+using namespace std;
+
+namespace latticpp {
+
+    void seed(ParametersRef params, SecretKeyRef sk, CiphertextRef ct) {
+        lattigo_seedCiphertext(params.getRawHandle(), sk.getRawHandle(), ct.getRawHandle());
+    }
+
+    void seed(ParametersRef params, SecretKeyRef sk, PublicKeyRef pk) {
+        lattigo_seedPublicKey(params.getRawHandle(), sk.getRawHandle(), pk.getRawHandle());
+    }
+
+    void seed(ParametersRef params, SecretKeyRef sk, RelinearizationKeyRef relinKey) {
+        lattigo_seedRelinearizationKey(params.getRawHandle(), sk.getRawHandle(), relinKey.getRawHandle());
+    }
+
+    void seed(ParametersRef params, SecretKeyRef sk, RotationKeysRef rotKeys) {
+        lattigo_seedRotationKeys(params.getRawHandle(), sk.getRawHandle(), rotKeys.getRawHandle());
+    }
+
+    Ciphertext encryptSeededNew(ParametersRef params, EncryptorRef encryptor, SecretKeyRef sk, PlaintextRef pt) {
+        Ciphertext ct = encryptNew(encryptor, pt);
+        seed(params, sk, ct);
+        return ct;
+    }
+
+    PublicKey genPublicKeySeeded(ParametersRef params, KeyGeneratorRef keygen, SecretKeyRef sk) {
+        PublicKey pk = genPublicKey(keygen, sk);
+        seed(params, sk, pk);
+        return pk;
+    }
+
+    RelinearizationKey genRelinKeySeeded(ParametersRef params, KeyGeneratorRef keygen, SecretKeyRef sk) {
+        RelinearizationKey relinKey = genRelinKey(keygen, sk);
+        seed(params, sk, relinKey);
+        return relinKey;
+    }
+
+    RotationKeys genRotationKeysForRotationsSeeded(ParametersRef params, KeyGeneratorRef keygen, SecretKeyRef sk, vector<int> shifts) {
+        RotationKeys rotKeys = genRotationKeysForRotations(keygen, sk, shifts);
+        seed(params, sk, rotKeys);
+        return rotKeys;
+    }
+
+}  // namespace latticpp
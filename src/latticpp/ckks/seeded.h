@@ -0,0 +1,32 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+#include "cgo/seeded.h"
+#include <vector>
+
+namespace latticpp {
+
+    // Replace the uniformly random half of a ciphertext or key with one expanded from a fresh
+    // PRNG seed, adjusting the other half with the secret key so that the object is unchanged in
+    // meaning. Seeded objects can be written with the marshalBinarySeeded* functions in about
+    // half the space. Ciphertexts must have degree 1.
+    void seed(ParametersRef params, SecretKeyRef sk, CiphertextRef ct);
+
+    void seed(ParametersRef params, SecretKeyRef sk, PublicKeyRef pk);
+
+    void seed(ParametersRef params, SecretKeyRef sk, RelinearizationKeyRef relinKey);
+
+    void seed(ParametersRef params, SecretKeyRef sk, RotationKeysRef rotKeys);
+
+    Ciphertext encryptSeededNew(ParametersRef params, EncryptorRef encryptor, SecretKeyRef sk, PlaintextRef pt);
+
+    PublicKey genPublicKeySeeded(ParametersRef params, KeyGeneratorRef keygen, SecretKeyRef sk);
+
+    RelinearizationKey genRelinKeySeeded(ParametersRef params, KeyGeneratorRef keygen, SecretKeyRef sk);
+
+    RotationKeys genRotationKeysForRotationsSeeded(ParametersRef params, KeyGeneratorRef keygen, SecretKeyRef sk, std::vector<int> shifts);
+
+}  // namespace latticpp
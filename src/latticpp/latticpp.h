@@ -5,17 +5,28 @@
 
 #include "latticpp/ckks/bootstrap.h"
 #include "latticpp/ckks/bootstrap_params.h"
+#include "latticpp/ckks/bootstrapperpool.h"
 #include "latticpp/ckks/ciphertext.h"
+#include "latticpp/ckks/circuit.h"
+#include "latticpp/ckks/commandbuffer.h"
 #include "latticpp/ckks/dckks.h"
 #include "latticpp/ckks/decryptor.h"
 #include "latticpp/ckks/encoder.h"
 #include "latticpp/ckks/encryptor.h"
 #include "latticpp/ckks/evaluator.h"
+#include "latticpp/ckks/evaluatorpool.h"
+#include "latticpp/ckks/keyfile.h"
 #include "latticpp/ckks/keygen.h"
+#include "latticpp/ckks/lazyciphertext.h"
+#include "latticpp/ckks/linear_transform.h"
 #include "latticpp/ckks/marshaler.h"
 #include "latticpp/ckks/params.h"
+#include "latticpp/ckks/planner.h"
 #include "latticpp/ckks/plaintext.h"
+#include "latticpp/ckks/plaintextcache.h"
 #include "latticpp/ckks/precision.h"
+#include "latticpp/ckks/seeded.h"
 #include "latticpp/marshal/gohandle.h"
 #include "latticpp/ring/ring.h"
+#include "latticpp/utils/stats.h"
 #include "latticpp/utils/utils.h"
@@ -0,0 +1,64 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "latticpp/marshal/gohandle.h"
+#include <stdexcept>
+#include <vector>
+
+namespace latticpp {
+
+    // Batch operations pass arrays of raw handles to Go. These convert between such arrays and
+    // vectors of GoHandles.
+
+    // Throws if `objs` does not have `expectedSize` elements, so that callers can check that
+    // all inputs and outputs of a batch line up.
+    template<GoType t>
+    std::vector<uint64_t> rawHandles(const std::vector<GoHandle<t>> &objs, size_t expectedSize) {
+        if (objs.size() != expectedSize) {
+            throw std::invalid_argument("Batch inputs and outputs must have the same length");
+        }
+        std::vector<uint64_t> handles(objs.size());
+        for (size_t i = 0; i < objs.size(); i++) {
+            handles[i] = objs[i].getRawHandle();
+        }
+        return handles;
+    }
+
+    // Pointers to the rows of a batch of values, which must all have the same non-zero
+    // power-of-two length. logLen is set to log2 of that length (0 if there are no rows).
+    inline std::vector<const double*> rowPointers(const std::vector<std::vector<double>> &rows, uint64_t &logLen) {
+        std::vector<const double*> ptrs(rows.size());
+        if (rows.empty()) {
+            logLen = 0;
+            return ptrs;
+        }
+        size_t len = rows[0].size();
+        if (len == 0 || (len & (len - 1)) != 0) {
+            throw std::invalid_argument("The rows of a batch must have a power-of-two length");
+        }
+        logLen = 0;
+        while ((size_t(1) << logLen) < len) {
+            logLen++;
+        }
+        for (size_t i = 0; i < rows.size(); i++) {
+            if (rows[i].size() != len) {
+                throw std::invalid_argument("All rows of a batch must have the same length");
+            }
+            ptrs[i] = rows[i].data();
+        }
+        return ptrs;
+    }
+
+    // Take ownership of handles returned by Go
+    template<typename T>
+    std::vector<T> fromRawHandles(const std::vector<uint64_t> &handles) {
+        std::vector<T> objs;
+        objs.reserve(handles.size());
+        for (uint64_t h : handles) {
+            objs.push_back(T(h));
+        }
+        return objs;
+    }
+}  // namespace latticpp
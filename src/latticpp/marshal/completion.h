@@ -0,0 +1,49 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <stdexcept>
+
+namespace latticpp {
+
+    // Asynchronous Go calls take a completion callback and an opaque context pointer.
+    // The context is a heap-allocated std::promise, which the callback fulfills with the
+    // handle produced by the call and then frees. If the call failed, the promise instead
+    // holds a std::runtime_error with Go's message, which the future rethrows. Go invokes
+    // the callback from one of its own threads.
+    template<typename T>
+    void completeAsync(void *ctx, uint64_t handle, const char *error) {
+        std::unique_ptr<std::promise<T>> p(static_cast<std::promise<T>*>(ctx));
+        if (error != nullptr) {
+            p->set_exception(std::make_exception_ptr(std::runtime_error(error)));
+        } else {
+            p->set_value(T(handle));
+        }
+    }
+
+    template<>
+    inline void completeAsync<void>(void *ctx, uint64_t, const char *error) {
+        std::unique_ptr<std::promise<void>> p(static_cast<std::promise<void>*>(ctx));
+        if (error != nullptr) {
+            p->set_exception(std::make_exception_ptr(std::runtime_error(error)));
+        } else {
+            p->set_value();
+        }
+    }
+
+    // Start an asynchronous Go call. `call` is passed the completion callback and its
+    // context, and must pass both on to the Go function.
+    template<typename T, typename F>
+    std::future<T> callAsync(F call) {
+        std::promise<T> *p = new std::promise<T>();
+        // get the future first: the callback may run (and free the promise) before `call` returns
+        std::future<T> result = p->get_future();
+        call(&completeAsync<T>, static_cast<void*>(p));
+        return result;
+    }
+}  // namespace latticpp
@@ -49,9 +49,15 @@ namespace latticpp {
         MetaData,
         RingQP,
         PolyQP,
-        BasisExtender
+        BasisExtender,
+        RotationPlan,
+        LinearTransform,
+        RotationKeyFile
     };
 
+    template<GoType t>
+    struct GoHandleRef;
+
     template<GoType t>
     struct GoHandle {
     public:
@@ -96,21 +102,18 @@ namespace latticpp {
             return *this;
         }
 
-        // move contructor: the moved-from object *will still be destructed*, so increment the ref counter
-        // https://stackoverflow.com/a/20589077/925978
-        GoHandle (const GoHandle&& other) noexcept {
-            handle = other.handle;
-            // a handle of 0 is an invalid Go reference (my equivalent of a nil/null pointer)
-            if (handle != 0) {
-                incref(handle);
-            }
+        // move constructor: take over the reference held by `other` without calling into Go.
+        // The moved-from object *will still be destructed*, so we null it out to make its
+        // destructor a no-op.
+        GoHandle (GoHandle&& other) noexcept : handle(other.handle) {
+            other.handle = 0;
         }
 
         // move assignment operator: we are overwriting the contents of this handle,
-        // so decrement references to the current handle, and increment references to the moved-from handle
-        // (see move constructor for details)
-        GoHandle& operator= (const GoHandle&& other) noexcept {
-            if (handle == other.handle) {
+        // so decrement the references to the current handle, then take over the reference
+        // held by the moved-from handle (see move constructor for details)
+        GoHandle& operator= (GoHandle&& other) noexcept {
+            if (this == &other) {
                 return *this;
             }
             // a handle of 0 is an invalid Go reference (my equivalent of a nil/null pointer)
@@ -118,38 +121,15 @@ namespace latticpp {
                 decref(handle);
             }
             handle = other.handle;
-            if (handle != 0) {
-                incref(handle);
-            }
+            other.handle = 0;
             return *this;
         }
 
-        // move contructor: the moved-from object *will still be destructed*, so increment the ref counter
-        // https://stackoverflow.com/a/20589077/925978
-        GoHandle (GoHandle&& other) noexcept {
-            handle = other.handle;
-            // a handle of 0 is an invalid Go reference (my equivalent of a nil/null pointer)
-            if (handle != 0) {
-                incref(handle);
-            }
-        }
-
-        // move assignment operator: we are overwriting the contents of this handle,
-        // so decrement references to the current handle, and increment references to the moved-from handle
-        // (see move constructor for details)
-        GoHandle& operator= (GoHandle&& other) noexcept {
-            if (handle == other.handle) {
-                return *this;
-            }
-            // a handle of 0 is an invalid Go reference (my equivalent of a nil/null pointer)
-            if (handle != 0) {
-                decref(handle);
-            }
-            handle = other.handle;
+        // acquire a new reference to the object behind a borrowed handle
+        explicit GoHandle(GoHandleRef<t> ref) : handle(ref.getRawHandle()) {
             if (handle != 0) {
                 incref(handle);
             }
-            return *this;
         }
 
         bool operator == (const GoHandle& other) const {
@@ -168,6 +148,35 @@ namespace latticpp {
         uint64_t handle;
     };
 
+    // A borrowed, non-owning view of a GoHandle. Creating, copying, and destroying a
+    // GoHandleRef never calls into Go, so it can be passed by value wherever a handle
+    // is only read. The GoHandle it was created from must outlive it.
+    template<GoType t>
+    struct GoHandleRef {
+    public:
+        GoHandleRef() : handle(0) { }
+
+        GoHandleRef(const GoHandle<t>& owner) : handle(owner.getRawHandle()) { }
+
+        // wrap a raw handle which is kept alive by someone else
+        explicit GoHandleRef(uint64_t handle) : handle(handle) { }
+
+        bool operator == (const GoHandleRef& other) const {
+           return handle == other.handle;
+        }
+
+        bool operator != (const GoHandleRef& other) const {
+           return handle != other.handle;
+        }
+
+        uint64_t getRawHandle() const {
+            return handle;
+        }
+
+    private:
+        uint64_t handle;
+    };
+
     using Bootstrapper = GoHandle<GoType::Bootstrapper>;
     using BootstrappingKey = GoHandle<GoType::BootstrappingKey>;
     using BootstrappingParameters = GoHandle<GoType::BootstrappingParameters>;
@@ -205,6 +214,50 @@ namespace latticpp {
     using PRNG = GoHandle<GoType::PRNG>;
     using MetaData = GoHandle<GoType::MetaData>;
     using BasisExtender = GoHandle<GoType::BasisExtender>;
+    using RotationPlan = GoHandle<GoType::RotationPlan>;
+    using LinearTransform = GoHandle<GoType::LinearTransform>;
+    using RotationKeyFile = GoHandle<GoType::RotationKeyFile>;
+
+    using BootstrapperRef = GoHandleRef<GoType::Bootstrapper>;
+    using BootstrappingKeyRef = GoHandleRef<GoType::BootstrappingKey>;
+    using BootstrappingParametersRef = GoHandleRef<GoType::BootstrappingParameters>;
+    using ParametersRef = GoHandleRef<GoType::Parameters>;
+    using EncoderRef = GoHandleRef<GoType::Encoder>;
+    using KeyGeneratorRef = GoHandleRef<GoType::KeyGenerator>;
+    using RelinearizationKeyRef = GoHandleRef<GoType::RelinearizationKey>;
+    using EvaluationKeyRef = GoHandleRef<GoType::EvaluationKey>;
+    using EncryptorRef = GoHandleRef<GoType::Encryptor>;
+    using DecryptorRef = GoHandleRef<GoType::Decryptor>;
+    using EvaluatorRef = GoHandleRef<GoType::Evaluator>;
+    using SecretKeyRef = GoHandleRef<GoType::SecretKey>;
+    using PublicKeyRef = GoHandleRef<GoType::PublicKey>;
+    using PlaintextRef = GoHandleRef<GoType::Plaintext>;
+    using CiphertextRef = GoHandleRef<GoType::Ciphertext>;
+    using CiphertextQPRef = GoHandleRef<GoType::CiphertextQP>;
+    using RotationKeysRef = GoHandleRef<GoType::RotationKeys>;
+    using SwitchingKeyRef = GoHandleRef<GoType::SwitchingKey>;
+    using CKGProtocolRef = GoHandleRef<GoType::CKGProtocol>;
+    using CKGCRPRef = GoHandleRef<GoType::CKGCRP>;
+    using CKGShareRef = GoHandleRef<GoType::CKGShare>;
+    using RKGProtocolRef = GoHandleRef<GoType::RKGProtocol>;
+    using RKGCRPRef = GoHandleRef<GoType::RKGCRP>;
+    using RKGShareRef = GoHandleRef<GoType::RKGShare>;
+    using CKSProtocolRef = GoHandleRef<GoType::CKSProtocol>;
+    using CKSShareRef = GoHandleRef<GoType::CKSShare>;
+    using RTGProtocolRef = GoHandleRef<GoType::RTGProtocol>;
+    using RTGCRPRef = GoHandleRef<GoType::RTGCRP>;
+    using RTGShareRef = GoHandleRef<GoType::RTGShare>;
+    using RingRef = GoHandleRef<GoType::Ring>;
+    using RingQPRef = GoHandleRef<GoType::RingQP>;
+    using PolyRef = GoHandleRef<GoType::Poly>;
+    using PolyQPRef = GoHandleRef<GoType::PolyQP>;
+    using UniformSamplerRef = GoHandleRef<GoType::UniformSampler>;
+    using PRNGRef = GoHandleRef<GoType::PRNG>;
+    using MetaDataRef = GoHandleRef<GoType::MetaData>;
+    using BasisExtenderRef = GoHandleRef<GoType::BasisExtender>;
+    using RotationPlanRef = GoHandleRef<GoType::RotationPlan>;
+    using LinearTransformRef = GoHandleRef<GoType::LinearTransform>;
+    using RotationKeyFileRef = GoHandleRef<GoType::RotationKeyFile>;
 
 
 }  // namespace latticpp
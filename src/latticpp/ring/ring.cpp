@@ -10,123 +10,123 @@ namespace latticpp {
         return Ring(lattigo_newRing(n, moduli.data(), moduli.size()));
     }
 
-    PolyQP newPolyQP(const RingQP &ring) {
+    PolyQP newPolyQP(RingQPRef ring) {
         return PolyQP(lattigo_newPolyQP(ring.getRawHandle()));
     }
 
-    PolyQP copyNew(const PolyQP &src) {
+    PolyQP copyNew(PolyQPRef src) {
         return PolyQP(lattigo_copyNewPolyQP(src.getRawHandle()));
     }
 
-    void addLvl(const RingQP &ring, uint64_t levelQ, uint64_t levelP, const PolyQP &p1, const PolyQP &p2, PolyQP &pOut) {
+    void addLvl(RingQPRef ring, uint64_t levelQ, uint64_t levelP, PolyQPRef p1, PolyQPRef p2, PolyQP &pOut) {
         lattigo_ringQPAddLvl(ring.getRawHandle(), levelQ, levelP, p1.getRawHandle(), p2.getRawHandle(),
                         pOut.getRawHandle());
     }
 
-    void copy(PolyQP &pTarget, const PolyQP &pSrc) {
+    void copy(PolyQP &pTarget, PolyQPRef pSrc) {
         lattigo_copyPolyQP(pTarget.getRawHandle(), pSrc.getRawHandle());
     }
 
-    UniformSampler newUniformSampler(const PRNG &prng, const Ring &ring) {
+    UniformSampler newUniformSampler(PRNGRef prng, RingRef ring) {
         return UniformSampler(
             lattigo_newUniformSampler(prng.getRawHandle(), ring.getRawHandle()));
     }
 
-    Poly polyQ(const PolyQP &polyQp) {
+    Poly polyQ(PolyQPRef polyQp) {
         return Poly(lattigo_polyQ(polyQp.getRawHandle()));
     }
 
-    Poly polyP(const PolyQP &polyQp) {
+    Poly polyP(PolyQPRef polyQp) {
         return Poly(lattigo_polyP(polyQp.getRawHandle()));
     }
 
-    void copyLvl(uint64_t level, const Poly &sourcePoly, Poly &targetPoly) {
+    void copyLvl(uint64_t level, PolyRef sourcePoly, Poly &targetPoly) {
         lattigo_copyLvl(level, sourcePoly.getRawHandle(), targetPoly.getRawHandle());
     }
 
-    void copyLvlToOtherLvl(uint64_t srcLevel, uint64_t dstLevel, const Poly &srcPoly, Poly &dstPoly) {
+    void copyLvlToOtherLvl(uint64_t srcLevel, uint64_t dstLevel, PolyRef srcPoly, Poly &dstPoly) {
         lattigo_copyLvlToOtherLvl(srcLevel, dstLevel, srcPoly.getRawHandle(), dstPoly.getRawHandle());
     }
 
-    BasisExtender newBasisExtender(const Ring &ringQ, const Ring &ringP) {
+    BasisExtender newBasisExtender(RingRef ringQ, RingRef ringP) {
         return lattigo_newBasisExtender(ringQ.getRawHandle(), ringP.getRawHandle());
     }
 
-    void modUpQtoP(const BasisExtender &ext, uint64_t levelQ, uint64_t levelP, const Poly &polQ, Poly &polP) {
+    void modUpQtoP(BasisExtenderRef ext, uint64_t levelQ, uint64_t levelP, PolyRef polQ, Poly &polP) {
         lattigo_modUpQtoP(ext.getRawHandle(), levelQ, levelP, polQ.getRawHandle(), polP.getRawHandle());
     }
 
-    void invNTTLvl(const RingQP &ringQP, uint64_t levelQ, uint64_t levelP, const PolyQP &pIn, PolyQP &pOut) {
+    void invNTTLvl(RingQPRef ringQP, uint64_t levelQ, uint64_t levelP, PolyQPRef pIn, PolyQP &pOut) {
         lattigo_invNTTLvlRingQP(ringQP.getRawHandle(), levelQ, levelP, pIn.getRawHandle(), pOut.getRawHandle());
     }
 
-    void nttLvl(const RingQP &ringQP, uint64_t levelQ, uint64_t levelP, const PolyQP &pIn, PolyQP &pOut) {
+    void nttLvl(RingQPRef ringQP, uint64_t levelQ, uint64_t levelP, PolyQPRef pIn, PolyQP &pOut) {
         lattigo_nttLvlRingQP(ringQP.getRawHandle(), levelQ, levelP, pIn.getRawHandle(), pOut.getRawHandle());
     }
 
-    void invNTTLvl(const Ring &ring, uint64_t level, const Poly &pIn, Poly &pOut) {
+    void invNTTLvl(RingRef ring, uint64_t level, PolyRef pIn, Poly &pOut) {
         lattigo_invNTTLvlRing(ring.getRawHandle(), level, pIn.getRawHandle(), pOut.getRawHandle());
     }
 
-    void nttLvl(const Ring &ring, uint64_t level, const Poly &pIn, Poly &pOut) {
+    void nttLvl(RingRef ring, uint64_t level, PolyRef pIn, Poly &pOut) {
         lattigo_nttLvlRing(ring.getRawHandle(), level, pIn.getRawHandle(), pOut.getRawHandle());
     }
 
-    void invMFormLvl(const RingQP &ringQP, uint64_t levelQ, uint64_t levelP, const PolyQP &pIn, PolyQP &pOut) {
+    void invMFormLvl(RingQPRef ringQP, uint64_t levelQ, uint64_t levelP, PolyQPRef pIn, PolyQP &pOut) {
         lattigo_invMFormLvlRingQP(ringQP.getRawHandle(), levelQ, levelP, pIn.getRawHandle(), pOut.getRawHandle());
     }
 
-    void mFormLvl(const RingQP &ringQP, uint64_t levelQ, uint64_t levelP, const PolyQP &pIn, PolyQP &pOut) {
+    void mFormLvl(RingQPRef ringQP, uint64_t levelQ, uint64_t levelP, PolyQPRef pIn, PolyQP &pOut) {
        lattigo_mFormLvlRingQP(ringQP.getRawHandle(), levelQ, levelP, pIn.getRawHandle(), pOut.getRawHandle());
     }
 
-    void invMFormLvl(const Ring &ring, uint64_t level, const Poly &pIn, Poly &pOut) {
+    void invMFormLvl(RingRef ring, uint64_t level, PolyRef pIn, Poly &pOut) {
        lattigo_invMFormLvlRing(ring.getRawHandle(), level, pIn.getRawHandle(), pOut.getRawHandle());
     }
 
-    void mFormLvl(const Ring &ring, uint64_t level, const Poly &pIn, Poly &pOut) {
+    void mFormLvl(RingRef ring, uint64_t level, PolyRef pIn, Poly &pOut) {
        lattigo_mFormLvlRing(ring.getRawHandle(), level, pIn.getRawHandle(), pOut.getRawHandle());
     }
 
-    Poly newPoly(const Ring &ring){
+    Poly newPoly(RingRef ring){
         return Poly(lattigo_newPoly(ring.getRawHandle()));
     }
 
-    void copy(Poly &dst, const Poly &src){
+    void copy(Poly &dst, PolyRef src){
         lattigo_copyPoly(dst.getRawHandle(), src.getRawHandle());
     }
 
-    uint64_t degree(const Poly &p) { 
+    uint64_t degree(PolyRef p) { 
         return lattigo_polyDegree(p.getRawHandle()); 
     }
 
-    uint64_t ringN(const Ring &ring) { 
+    uint64_t ringN(RingRef ring) { 
         return lattigo_ringN(ring.getRawHandle()); 
     }
 
-    vector<uint64_t> permuteNTTIndex(const Ring &ring, uint64_t galEl) {
+    vector<uint64_t> permuteNTTIndex(RingRef ring, uint64_t galEl) {
         vector<uint64_t> res(ringN(ring));
         lattigo_permuteNTTIndex(ring.getRawHandle(), galEl, res.data());
         return res;
     }
 
-    void permuteNTTWithIndexLvl(const Ring &ring, uint64_t level, const Poly &polyIn, const vector<uint64_t> &index, Poly &polyOut) {
+    void permuteNTTWithIndexLvl(RingRef ring, uint64_t level, PolyRef polyIn, const vector<uint64_t> &index, Poly &polyOut) {
         lattigo_permuteNTTWithIndexLvl(ring.getRawHandle(), level, polyIn.getRawHandle(), index.data(), polyOut.getRawHandle());
     }
 
-    uint64_t log2OfInnerSum(uint64_t level, const Ring &ring, const Poly &poly){
+    uint64_t log2OfInnerSum(uint64_t level, RingRef ring, PolyRef poly){
         return lattigo_log2OfInnerSum(level, ring.getRawHandle(), poly.getRawHandle());
     }
 
-    void mulCoeffsMontgomeryAndAddLvl(const RingQP &ringQP, uint64_t levelQ, uint64_t levelP, const PolyQP &p1, const PolyQP &p2, PolyQP &polyOut) {
+    void mulCoeffsMontgomeryAndAddLvl(RingQPRef ringQP, uint64_t levelQ, uint64_t levelP, PolyQPRef p1, PolyQPRef p2, PolyQP &polyOut) {
         lattigo_mulCoeffsMontgomeryAndAddLvl(ringQP.getRawHandle(), levelQ, levelP, p1.getRawHandle(), p2.getRawHandle(), polyOut.getRawHandle());
     }
 
-    void mulCoeffsMontgomeryAndAddLvl(const Ring &ring, uint64_t level, const Poly &p1, const Poly &p2, Poly &polyOut) {
+    void mulCoeffsMontgomeryAndAddLvl(RingRef ring, uint64_t level, PolyRef p1, PolyRef p2, Poly &polyOut) {
         lattigo_mulCoeffsMontgomeryAndAddLvlRing(ring.getRawHandle(), level, p1.getRawHandle(), p2.getRawHandle(), polyOut.getRawHandle());
     }
 
-    uint64_t equals(const Poly &p1, const Poly &p2){
+    uint64_t equals(PolyRef p1, PolyRef p2){
         return lattigo_equals(p1.getRawHandle(), p2.getRawHandle());
     }
 
@@ -10,62 +10,62 @@ namespace latticpp {
 
     Ring newRing(uint64_t n, std::vector<uint64_t> moduli);
 
-    Poly newPoly(const Ring &ring);
+    Poly newPoly(RingRef ring);
 
-    PolyQP newPolyQP(const RingQP &ring);
+    PolyQP newPolyQP(RingQPRef ring);
 
-    void copy(Poly &dst, const Poly &src);
+    void copy(Poly &dst, PolyRef src);
 
-    void copy(PolyQP &pTarget, const PolyQP &pSrc);
+    void copy(PolyQP &pTarget, PolyQPRef pSrc);
 
-    PolyQP copyNew(const PolyQP &src);
+    PolyQP copyNew(PolyQPRef src);
 
-    UniformSampler newUniformSampler(const PRNG &prng, const Ring &ring);
+    UniformSampler newUniformSampler(PRNGRef prng, RingRef ring);
 
-    Poly polyQ(const PolyQP &polyQp);
+    Poly polyQ(PolyQPRef polyQp);
 
-    Poly polyP(const PolyQP &polyQp);
+    Poly polyP(PolyQPRef polyQp);
 
-    void copyLvl(uint64_t level, const Poly &sourcePoly, Poly &targetPoly);
+    void copyLvl(uint64_t level, PolyRef sourcePoly, Poly &targetPoly);
 
-    void copyLvlToOtherLvl(uint64_t srcLevel, uint64_t dstLevel, const Poly &srcPoly, Poly &dstPoly);
+    void copyLvlToOtherLvl(uint64_t srcLevel, uint64_t dstLevel, PolyRef srcPoly, Poly &dstPoly);
 
-    BasisExtender newBasisExtender(const Ring &ringQ, const Ring &ringP);
+    BasisExtender newBasisExtender(RingRef ringQ, RingRef ringP);
 
-    void modUpQtoP(const BasisExtender &ext, uint64_t levelQ, uint64_t levelP, const Poly &polQ, Poly &polP);
+    void modUpQtoP(BasisExtenderRef ext, uint64_t levelQ, uint64_t levelP, PolyRef polQ, Poly &polP);
 
-    void invNTTLvl(const RingQP &ringqp, uint64_t levelQ, uint64_t levelP, const PolyQP &pIn, PolyQP &pOut);
+    void invNTTLvl(RingQPRef ringqp, uint64_t levelQ, uint64_t levelP, PolyQPRef pIn, PolyQP &pOut);
 
-    void nttLvl(const RingQP &ringqp, uint64_t levelQ, uint64_t levelP, const PolyQP &pIn, PolyQP &pOut);
+    void nttLvl(RingQPRef ringqp, uint64_t levelQ, uint64_t levelP, PolyQPRef pIn, PolyQP &pOut);
 
-    void invNTTLvl(const Ring &ring, uint64_t level, const Poly &pIn, Poly &pOut);
+    void invNTTLvl(RingRef ring, uint64_t level, PolyRef pIn, Poly &pOut);
 
-    void nttLvl(const Ring &ring, uint64_t level, const Poly &pIn, Poly &pOut);
+    void nttLvl(RingRef ring, uint64_t level, PolyRef pIn, Poly &pOut);
 
-    void invMFormLvl(const RingQP &ringqp, uint64_t levelQ, uint64_t levelP, const PolyQP &pIn, PolyQP &pOut);
+    void invMFormLvl(RingQPRef ringqp, uint64_t levelQ, uint64_t levelP, PolyQPRef pIn, PolyQP &pOut);
 
-    void mFormLvl(const RingQP &ringqp, uint64_t levelQ, uint64_t levelP, const PolyQP &pIn, PolyQP &pOut);
+    void mFormLvl(RingQPRef ringqp, uint64_t levelQ, uint64_t levelP, PolyQPRef pIn, PolyQP &pOut);
 
-    void invMFormLvl(const Ring &ring, uint64_t level, const Poly &pIn, Poly &pOut);
+    void invMFormLvl(RingRef ring, uint64_t level, PolyRef pIn, Poly &pOut);
 
-    void mFormLvl(const Ring &ring, uint64_t level, const Poly &pIn, Poly &pOut);
+    void mFormLvl(RingRef ring, uint64_t level, PolyRef pIn, Poly &pOut);
 
-    uint64_t degree(const Poly &p);
+    uint64_t degree(PolyRef p);
 
-    uint64_t ringN(const Ring &ring);
+    uint64_t ringN(RingRef ring);
 
-    std::vector<uint64_t> permuteNTTIndex(const Ring &ring, uint64_t galEl);
+    std::vector<uint64_t> permuteNTTIndex(RingRef ring, uint64_t galEl);
 
-    void permuteNTTWithIndexLvl(const Ring &ring, uint64_t level, const Poly &polyIn, const std::vector<uint64_t> &index, Poly &polyOut);
+    void permuteNTTWithIndexLvl(RingRef ring, uint64_t level, PolyRef polyIn, const std::vector<uint64_t> &index, Poly &polyOut);
 
-    uint64_t log2OfInnerSum(uint64_t level, const Ring &ring, const Poly &poly);
+    uint64_t log2OfInnerSum(uint64_t level, RingRef ring, PolyRef poly);
 
-    void addLvl(const RingQP &ring, uint64_t levelQ, uint64_t levelP, const PolyQP &p1, const PolyQP &p2, PolyQP &polyOut);
+    void addLvl(RingQPRef ring, uint64_t levelQ, uint64_t levelP, PolyQPRef p1, PolyQPRef p2, PolyQP &polyOut);
 
-    void mulCoeffsMontgomeryAndAddLvl(const RingQP &ringQP, uint64_t levelQ, uint64_t levelP, const PolyQP &p1, const PolyQP &p2, PolyQP &polyOut);
+    void mulCoeffsMontgomeryAndAddLvl(RingQPRef ringQP, uint64_t levelQ, uint64_t levelP, PolyQPRef p1, PolyQPRef p2, PolyQP &polyOut);
 
-    void mulCoeffsMontgomeryAndAddLvl(const Ring &ring, uint64_t level, const Poly &p1, const Poly &p2, Poly &polyOut);
+    void mulCoeffsMontgomeryAndAddLvl(RingRef ring, uint64_t level, PolyRef p1, PolyRef p2, Poly &polyOut);
 
-    uint64_t equals(const Poly &p1, const Poly &p2);
+    uint64_t equals(PolyRef p1, PolyRef p2);
     
 } // namespace latticpp
\ No newline at end of file
@@ -0,0 +1,141 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "stats.h"
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <sstream>
+#include <utility>
+
+using namespace std;
+
+namespace latticpp {
+
+    // Number of latency buckets reported by Go, one per power of two nanoseconds
+    const int NUM_LATENCY_BUCKETS = 64;
+
+    // Range of the Prometheus histogram buckets, as powers of two nanoseconds (~1 us to ~69 s)
+    const int PROMETHEUS_MIN_BUCKET = 10;
+    const int PROMETHEUS_MAX_BUCKET = 36;
+
+    double CallStats::latency(double q) const {
+        uint64_t total = accumulate(latencyBuckets.begin(), latencyBuckets.end(), uint64_t(0));
+        if (total == 0) {
+            return 0;
+        }
+        double rank = q * total;
+        uint64_t below = 0;
+        for (int i = 0; i < latencyBuckets.size(); i++) {
+            uint64_t count = latencyBuckets[i];
+            if (count == 0 || below + count < rank) {
+                below += count;
+                continue;
+            }
+            double f = (rank - below) / count;
+            double ns;
+            if (i <= 1) {
+                ns = i == 0 ? 0 : 1 + f;
+            } else {
+                // interpolate geometrically within [2^(i-1), 2^i)
+                ns = ldexp(pow(2, f), i - 1);
+            }
+            return ns * 1e-9;
+        }
+        return ldexp(1, latencyBuckets.size()) * 1e-9;
+    }
+
+    double CallStats::bytesPerCall() const {
+        return allocSamples == 0 ? 0 : double(allocBytes) / allocSamples;
+    }
+
+    string Stats::toPrometheus() const {
+        ostringstream out;
+        out.precision(9);
+        out << "# HELP latticpp_call_duration_seconds Time spent in Go by each exported function\n"
+            << "# TYPE latticpp_call_duration_seconds histogram\n";
+        for (const CallStats &s : functions) {
+            string label = "function=\"" + s.name + "\"";
+            uint64_t cumulative = 0;
+            for (int i = 0; i < NUM_LATENCY_BUCKETS; i++) {
+                cumulative += s.latencyBuckets[i];
+                if (i >= PROMETHEUS_MIN_BUCKET && i <= PROMETHEUS_MAX_BUCKET) {
+                    out << "latticpp_call_duration_seconds_bucket{" << label << ",le=\"" << ldexp(1e-9, i)
+                        << "\"} " << cumulative << "\n";
+                }
+            }
+            out << "latticpp_call_duration_seconds_bucket{" << label << ",le=\"+Inf\"} " << cumulative << "\n"
+                << "latticpp_call_duration_seconds_sum{" << label << "} " << s.totalSeconds << "\n"
+                << "latticpp_call_duration_seconds_count{" << label << "} " << cumulative << "\n";
+        }
+        for (const pair<const char *, double> &quantile : {make_pair("p50", 0.5), make_pair("p99", 0.99)}) {
+            string metric = string("latticpp_call_duration_") + quantile.first + "_seconds";
+            out << "# HELP " << metric << " Estimated latency quantile of each exported function\n"
+                << "# TYPE " << metric << " gauge\n";
+            for (const CallStats &s : functions) {
+                out << metric << "{function=\"" << s.name << "\"} " << s.latency(quantile.second) << "\n";
+            }
+        }
+        out << "# HELP latticpp_alloc_sampled_calls_total Calls whose Go allocations were measured\n"
+            << "# TYPE latticpp_alloc_sampled_calls_total counter\n";
+        for (const CallStats &s : functions) {
+            out << "latticpp_alloc_sampled_calls_total{function=\"" << s.name << "\"} " << s.allocSamples << "\n";
+        }
+        out << "# HELP latticpp_alloc_sampled_bytes_total Bytes allocated in Go by the sampled calls\n"
+            << "# TYPE latticpp_alloc_sampled_bytes_total counter\n";
+        for (const CallStats &s : functions) {
+            out << "latticpp_alloc_sampled_bytes_total{function=\"" << s.name << "\"} " << s.allocBytes << "\n";
+        }
+        return out.str();
+    }
+
+    string Stats::toJson() const {
+        ostringstream out;
+        out.precision(9);
+        out << "{\"functions\":[";
+        for (size_t f = 0; f < functions.size(); f++) {
+            const CallStats &s = functions[f];
+            out << (f > 0 ? "," : "") << "{\"name\":\"" << s.name << "\""
+                << ",\"calls\":" << s.calls
+                << ",\"total_seconds\":" << s.totalSeconds
+                << ",\"p50_seconds\":" << s.latency(0.5)
+                << ",\"p99_seconds\":" << s.latency(0.99)
+                << ",\"alloc_samples\":" << s.allocSamples
+                << ",\"alloc_bytes\":" << s.allocBytes
+                << ",\"bytes_per_call\":" << s.bytesPerCall()
+                << ",\"latency_buckets\":[";
+            for (size_t i = 0; i < s.latencyBuckets.size(); i++) {
+                out << (i > 0 ? "," : "") << s.latencyBuckets[i];
+            }
+            out << "]}";
+        }
+        out << "]}";
+        return out.str();
+    }
+
+    void setStatsCollection(bool enabled, uint64_t allocSamplePeriod) {
+        lattigo_setStatsCollection(enabled, allocSamplePeriod);
+    }
+
+    Stats stats() {
+        char *data = lattigo_statsSnapshot();
+        istringstream lines(data);
+        free(data);
+
+        Stats result;
+        string line;
+        while (getline(lines, line)) {
+            istringstream fields(line);
+            CallStats s;
+            uint64_t nanos;
+            fields >> s.name >> s.calls >> nanos >> s.allocSamples >> s.allocBytes;
+            s.totalSeconds = nanos * 1e-9;
+            s.latencyBuckets.resize(NUM_LATENCY_BUCKETS);
+            for (uint64_t &count : s.latencyBuckets) {
+                fields >> count;
+            }
+            result.functions.push_back(move(s));
+        }
+        return result;
+    }
+}  // namespace latticpp
@@ -0,0 +1,53 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "cgo/stats.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace latticpp {
+
+    // Statistics of one exported lattigo_* function, measured inside Go (so excluding the cost
+    // of crossing the cgo boundary itself)
+    struct CallStats {
+        std::string name;
+        uint64_t calls = 0;
+        double totalSeconds = 0;
+        // latencyBuckets[i] counts calls which took [2^(i-1), 2^i) ns
+        std::vector<uint64_t> latencyBuckets;
+        // Calls whose Go allocations were measured, and the bytes they allocated in total
+        uint64_t allocSamples = 0;
+        uint64_t allocBytes = 0;
+
+        // Latency quantile (e.g. 0.99) in seconds, interpolated within a histogram bucket
+        double latency(double q) const;
+
+        // Mean bytes allocated by a sampled call, or 0 if no calls were sampled
+        double bytesPerCall() const;
+    };
+
+    struct Stats {
+        // One entry per function called since statistics were turned on, sorted by name
+        std::vector<CallStats> functions;
+
+        // Prometheus text exposition format: a latency histogram and p50/p99 gauges per function,
+        // and counters of sampled calls and their allocated bytes
+        std::string toPrometheus() const;
+
+        std::string toJson() const;
+    };
+
+    // Turn statistics of calls into Go on or off; turning them on clears those collected so far.
+    // Every `allocSamplePeriod`-th call of each function is also bracketed by
+    // runtime.ReadMemStats, which stops the world, to measure the bytes it allocates (0 disables
+    // allocation sampling). Allocations made concurrently by other threads are attributed to the
+    // sampled call, so bytesPerCall is an upper bound under concurrency. When statistics are off,
+    // each call pays one atomic load.
+    void setStatsCollection(bool enabled, uint64_t allocSamplePeriod = 64);
+
+    // A snapshot of the statistics collected so far
+    Stats stats();
+}  // namespace latticpp